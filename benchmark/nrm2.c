@@ -128,7 +128,7 @@ int main(int argc, char *argv[]){
   int step =   1;
 
   struct timeval start, stop;
-  double time1,timeg;
+  double timeg;
 
   argc--;argv++;
 
@@ -158,25 +158,22 @@ int main(int argc, char *argv[]){
 
    fprintf(stderr, " %6d : ", (int)m);
 
+   for(i = 0; i < m * COMPSIZE * abs(inc_x); i++){
+		x[i] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
+   }
+
+   /* time the loops back to back: a single call on a short vector */
+   /* is below the resolution of gettimeofday                      */
+   gettimeofday( &start, (struct timezone *)0);
 
    for (l=0; l<loops; l++)
    {
-
-   	for(i = 0; i < m * COMPSIZE * abs(inc_x); i++){
-			x[i] = ((FLOAT) rand() / (FLOAT) RAND_MAX) - 0.5;
-   	}
-
-    	gettimeofday( &start, (struct timezone *)0);
-
     	NRM2 (&m, x, &inc_x);
+   }
 
-    	gettimeofday( &stop, (struct timezone *)0);
+   gettimeofday( &stop, (struct timezone *)0);
 
-    	time1 = (double)(stop.tv_sec - start.tv_sec) + (double)((stop.tv_usec - start.tv_usec)) * 1.e-6;
-
-	timeg += time1;
-
-    }
+   timeg = (double)(stop.tv_sec - start.tv_sec) + (double)((stop.tv_usec - start.tv_usec)) * 1.e-6;
 
     timeg /= loops;
 
@@ -0,0 +1,38 @@
+#!/bin/bash
+#
+# Node-local layout of the threaded level 3 drivers (OPENBLAS_NUMA_LEVEL3=1)
+# against the default layout, on the first 1, 2 and 4 NUMA nodes, run from
+# this directory after "make goto". Each run is bound with numactl to the
+# cores and memory of those nodes and uses all of their cores.
+#
+# The layouts differ in how the threads are grouped : by default one group
+# shares every packed B panel, with the node-local layout there is one group
+# per node (nthreads_n = nodes), its threads placed on that node and sharing
+# B panels only among themselves. On one node both take the same path.
+#
+# On a machine with fewer nodes than asked for, the node-local run uses that
+# many thread groups instead (OPENBLAS_NUMA_LEVEL3=<nodes>), which shows the
+# cost of the grouping without the gain in locality.
+#
+# usage: ./numa_level3.sh [nodes ...]
+
+NODES=${@:-1 2 4}
+HAVE=$(numactl --hardware 2>/dev/null | awk '/^available:/ { print $2 }')
+HAVE=${HAVE:-1}
+
+for n in $NODES ; do
+  bind=
+  layout=1
+  if [ "$n" -le "$HAVE" ] ; then
+    command -v numactl > /dev/null && bind="numactl --cpunodebind=0-$((n - 1)) --membind=0-$((n - 1))"
+  else
+    layout=$n
+  fi
+  for l in 0 $layout ; do
+    echo "== nodes $n ${bind:+(bound) }OPENBLAS_NUMA_LEVEL3=$l"
+    OPENBLAS_NUMA_LEVEL3=$l OPENBLAS_LOOPS=5 $bind ./dgemm.goto 4000 4000 1
+    OPENBLAS_NUMA_LEVEL3=$l OPENBLAS_LOOPS=5 OPENBLAS_PARAM_N=16000 \
+      $bind ./dgemm.goto 2000 2000 1
+    OPENBLAS_NUMA_LEVEL3=$l OPENBLAS_LOOPS=5 $bind ./zgemm.goto 2000 2000 1
+  done
+done
@@ -0,0 +1,34 @@
+#!/bin/bash
+#
+# Cost of the reproducible mode (OPENBLAS_REPRODUCIBLE=1) for dgemm,
+# dgemv and ddot, run from this directory after "make goto".
+#
+# What the mode gives up:
+#  - gemm : K blocks of 128 instead of GEMM_Q, so C is read and written
+#           about twice as often; no K split for small-C, long-K shapes.
+#           Single thread on Haswell (1000^3) measured 0-8% slower; a
+#           64 x 64 x 200000 shape runs on one thread, as C is one block.
+#  - gemv : no splitting of x for gemv_n with few rows, the row and
+#           column ranges rounded to multiples of 64.
+#  - dot  : vectors above 4096 elements are summed in at most 64 fixed
+#           chunks, also on one thread; within noise on Haswell.
+#
+# usage: ./reproducible.sh [threads ...]
+
+THREADS=${@:-1 2 4}
+
+for t in $THREADS ; do
+  for r in 0 1 ; do
+    echo "== OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r"
+    OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r OPENBLAS_LOOPS=5 \
+      ./dgemm.goto 1000 1000 1
+    OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r OPENBLAS_LOOPS=5 \
+      OPENBLAS_PARAM_M=64 OPENBLAS_PARAM_N=64 ./dgemm.goto 200000 200000 1
+    OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r OPENBLAS_LOOPS=50 \
+      ./dgemv.goto 2000 2000 1
+    OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r OPENBLAS_LOOPS=50 \
+      OPENBLAS_TRANS=T ./dgemv.goto 2000 2000 1
+    OPENBLAS_NUM_THREADS=$t OPENBLAS_REPRODUCIBLE=$r OPENBLAS_LOOPS=200 \
+      ./ddot.goto 1000000 1000000 1
+  done
+done
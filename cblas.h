@@ -34,6 +34,91 @@ int openblas_get_parallel(void);
 /* OpenBLAS is compiled using OpenMP threading model */
 #define OPENBLAS_OPENMP 2
 
+/* Enable (1) or disable (0) the work-stealing scheduler of the threaded
+   level 3 drivers (off by default); only effective when built with
+   USE_WORK_STEALING=1 */
+void openblas_set_work_stealing(int enable);
+int openblas_get_work_stealing(void);
+
+/* Enable (1) or disable (0) the node-local layout of the threaded level 3
+   drivers (B panels shared per NUMA node only); Linux pthreads builds.
+   A value n > 1 uses n thread groups whatever the number of nodes */
+void openblas_set_numa_level3(int enable);
+int openblas_get_numa_level3(void);
+
+/* Enable (1) or disable (0) results that are bitwise identical for any
+   thread count and any core of a kernel family (gemm, gemv, the level 1
+   reductions), at some cost in speed; also OPENBLAS_REPRODUCIBLE=1 */
+void openblas_set_reproducible(int enable);
+int openblas_get_reproducible(void);
+
+/* Threaded dgetrf, dpotrf and dgeqrf (and their s/c/z forms) on a task
+   DAG over tiles: 0 never (the default), 1 from order 2048 on 4 or more
+   threads, 2 whenever threaded; also OPENBLAS_TILED_LAPACK */
+void openblas_set_tiled_lapack(int mode);
+int openblas_get_tiled_lapack(void);
+
+/* Output size in bytes of one kernel call from which the x86_64 copy,
+   scal (alpha = 0), axpby (beta = 0) and gemm (beta = 0) kernels use
+   non-temporal stores; 0 restores the default, the size of the last
+   level cache, also OPENBLAS_STREAM_THRESHOLD (negative: never) */
+void openblas_set_stream_threshold(size_t bytes);
+size_t openblas_get_stream_threshold(void);
+
+/* Put idle worker threads to sleep now instead of after the spin timeout */
+void openblas_park_threads(void);
+/* Average wake-up latency of sleeping worker threads in nanoseconds */
+double openblas_get_wakeup_latency(void);
+
+/* Execution contexts: per-thread thread count and pool-thread set that
+   override openblas_set_num_threads() for calls made by the thread the
+   context is attached to with openblas_set_context() */
+typedef struct openblas_context openblas_context_t;
+openblas_context_t *openblas_context_create(int num_threads);
+void openblas_context_destroy(openblas_context_t *ctx);
+void openblas_context_set_num_threads(openblas_context_t *ctx, int num_threads);
+int openblas_context_get_num_threads(openblas_context_t *ctx);
+int openblas_context_set_cpus(openblas_context_t *ctx, const int *cpus, int ncpus);
+openblas_context_t *openblas_set_context(openblas_context_t *ctx);
+openblas_context_t *openblas_get_context(void);
+
+/* Asynchronous requests: a queue runs its requests in submission order
+   on a dispatcher thread of its own, with num_threads - 1 pool threads
+   that no other queue holds (0 takes all that are left).  Requests on
+   different queues run concurrently; a NULL queue is a shared default
+   queue with the normal thread settings.  Callbacks run on the
+   dispatcher when a request finishes, or at once if it already has.
+   A forked child gets a new default queue; queues created and requests
+   pending before the fork cannot be used in the child */
+typedef struct openblas_queue openblas_queue_t;
+typedef struct openblas_request openblas_request_t;
+typedef void (*openblas_request_callback_t)(openblas_request_t *request, void *data);
+openblas_queue_t *openblas_queue_create(int num_threads);
+void openblas_queue_destroy(openblas_queue_t *queue);
+int openblas_queue_synchronize(openblas_queue_t *queue);
+int openblas_request_wait(openblas_request_t *request);
+int openblas_request_test(openblas_request_t *request);
+int openblas_request_set_callback(openblas_request_t *request, openblas_request_callback_t callback, void *data);
+void openblas_request_free(openblas_request_t *request);
+
+/* Bytes of BLAS work buffers currently handed out, and the most ever
+   mapped, i.e. the high-water mark of concurrent use */
+size_t openblas_get_memory_in_use(void);
+size_t openblas_get_memory_high_water(void);
+
+/* Thread count the cost model chose for the last threadable call of
+   the calling thread (gemm, symm, syrk, trsm, gemv); OPENBLAS_VERBOSE=2
+   also prints each choice */
+int openblas_get_last_num_threads(void);
+
+/* Sweep the GEMM blocking (P, Q) and SWITCH_RATIO of each precision on
+   this CPU and store the best values in the profile file `path` (NULL
+   for $OPENBLAS_PROFILE), which is loaded at start-up when
+   OPENBLAS_PROFILE names it.  Run while no other BLAS calls are active.
+   Returns 0 on success, -1 if no path is given or the file cannot be
+   written */
+int openblas_autotune(const char *path);
+
 
 /*
  * Since all of GotoBlas was written without const,
@@ -51,6 +136,8 @@ typedef enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=1
 typedef enum CBLAS_UPLO      {CblasUpper=121, CblasLower=122} CBLAS_UPLO;
 typedef enum CBLAS_DIAG      {CblasNonUnit=131, CblasUnit=132} CBLAS_DIAG;
 typedef enum CBLAS_SIDE      {CblasLeft=141, CblasRight=142} CBLAS_SIDE;
+typedef enum CBLAS_STORAGE   {CblasPacked=151} CBLAS_STORAGE;
+typedef enum CBLAS_IDENTIFIER {CblasAMatrix=161, CblasBMatrix=162} CBLAS_IDENTIFIER;
 typedef CBLAS_ORDER CBLAS_LAYOUT;
 	
 float  cblas_sdsdot(OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float *y, OPENBLAS_CONST blasint incy);
@@ -362,6 +449,126 @@ void cblas_cgeadd(OPENBLAS_CONST enum CBLAS_ORDER CORDER,OPENBLAS_CONST blasint
 void cblas_zgeadd(OPENBLAS_CONST enum CBLAS_ORDER CORDER,OPENBLAS_CONST blasint crows, OPENBLAS_CONST blasint ccols, OPENBLAS_CONST double *calpha, double *a, OPENBLAS_CONST blasint clda, OPENBLAS_CONST double *cbeta, 
 		  double *c, OPENBLAS_CONST blasint cldc); 
 
+/*** Batched GEMM ***/
+
+void cblas_sgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransB_array,
+		       OPENBLAS_CONST blasint *M_array, OPENBLAS_CONST blasint *N_array, OPENBLAS_CONST blasint *K_array,
+		       OPENBLAS_CONST float *alpha_array, OPENBLAS_CONST float **A_array, OPENBLAS_CONST blasint *lda_array,
+		       OPENBLAS_CONST float **B_array, OPENBLAS_CONST blasint *ldb_array, OPENBLAS_CONST float *beta_array,
+		       float **C_array, OPENBLAS_CONST blasint *ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint *group_size);
+void cblas_dgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransB_array,
+		       OPENBLAS_CONST blasint *M_array, OPENBLAS_CONST blasint *N_array, OPENBLAS_CONST blasint *K_array,
+		       OPENBLAS_CONST double *alpha_array, OPENBLAS_CONST double **A_array, OPENBLAS_CONST blasint *lda_array,
+		       OPENBLAS_CONST double **B_array, OPENBLAS_CONST blasint *ldb_array, OPENBLAS_CONST double *beta_array,
+		       double **C_array, OPENBLAS_CONST blasint *ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint *group_size);
+void cblas_cgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransB_array,
+		       OPENBLAS_CONST blasint *M_array, OPENBLAS_CONST blasint *N_array, OPENBLAS_CONST blasint *K_array,
+		       OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **A_array, OPENBLAS_CONST blasint *lda_array,
+		       OPENBLAS_CONST void **B_array, OPENBLAS_CONST blasint *ldb_array, OPENBLAS_CONST void *beta_array,
+		       void **C_array, OPENBLAS_CONST blasint *ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint *group_size);
+void cblas_zgemm_batch(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransA_array, OPENBLAS_CONST enum CBLAS_TRANSPOSE *TransB_array,
+		       OPENBLAS_CONST blasint *M_array, OPENBLAS_CONST blasint *N_array, OPENBLAS_CONST blasint *K_array,
+		       OPENBLAS_CONST void *alpha_array, OPENBLAS_CONST void **A_array, OPENBLAS_CONST blasint *lda_array,
+		       OPENBLAS_CONST void **B_array, OPENBLAS_CONST blasint *ldb_array, OPENBLAS_CONST void *beta_array,
+		       void **C_array, OPENBLAS_CONST blasint *ldc_array, OPENBLAS_CONST blasint group_count, OPENBLAS_CONST blasint *group_size);
+
+void cblas_sgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+			       OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST float alpha,
+			       OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea,
+			       OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb, OPENBLAS_CONST float beta,
+			       float *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+void cblas_dgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+			       OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST double alpha,
+			       OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea,
+			       OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb, OPENBLAS_CONST double beta,
+			       double *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+void cblas_cgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+			       OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST void *alpha,
+			       OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea,
+			       OPENBLAS_CONST void *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb, OPENBLAS_CONST void *beta,
+			       void *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+void cblas_zgemm_batch_strided(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+			       OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST void *alpha,
+			       OPENBLAS_CONST void *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST blasint stridea,
+			       OPENBLAS_CONST void *B, OPENBLAS_CONST blasint ldb, OPENBLAS_CONST blasint strideb, OPENBLAS_CONST void *beta,
+			       void *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST blasint stridec, OPENBLAS_CONST blasint batch_size);
+
+
+/*** GEMM with pre-packed operands ***/
+
+size_t cblas_sgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+size_t cblas_dgemm_pack_get_size(OPENBLAS_CONST enum CBLAS_IDENTIFIER identifier, OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K);
+
+void cblas_sgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans,
+		      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST float alpha,
+		      OPENBLAS_CONST float *src, OPENBLAS_CONST blasint ld, float *dest);
+void cblas_dgemm_pack(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_IDENTIFIER identifier, OPENBLAS_CONST enum CBLAS_TRANSPOSE Trans,
+		      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K, OPENBLAS_CONST double alpha,
+		      OPENBLAS_CONST double *src, OPENBLAS_CONST blasint ld, double *dest);
+
+/* TransA/TransB take a CBLAS_TRANSPOSE value or CblasPacked */
+void cblas_sgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB,
+			 OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb,
+			 OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+void cblas_dgemm_compute(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST blasint TransA, OPENBLAS_CONST blasint TransB,
+			 OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+			 OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb,
+			 OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc);
+
+/*** GEMM with a fused epilogue ***/
+
+typedef enum CBLAS_ACTIVATION {CblasNoActivation=0, CblasReLU=1, CblasGELU=2} CBLAS_ACTIVATION;
+
+/* Applied to C once alpha*op(A)*op(B) + beta*C is complete:
+     C[i,j] = act(row_scale[i] * col_scale[j] * C[i,j] + row_bias[i] + col_bias[j])
+   row_* have M entries, col_* have N; NULL vectors are skipped */
+typedef struct {
+  OPENBLAS_CONST float *row_bias, *col_bias, *row_scale, *col_scale;
+  enum CBLAS_ACTIVATION activation;
+} openblas_sgemm_epilogue_t;
+
+typedef struct {
+  OPENBLAS_CONST double *row_bias, *col_bias, *row_scale, *col_scale;
+  enum CBLAS_ACTIVATION activation;
+} openblas_dgemm_epilogue_t;
+
+void cblas_sgemm_ex(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+		    OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		    OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb,
+		    OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST openblas_sgemm_epilogue_t *epilogue);
+void cblas_dgemm_ex(OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+		    OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+		    OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb,
+		    OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc, OPENBLAS_CONST openblas_dgemm_epilogue_t *epilogue);
+
+/*** Asynchronous calls (see openblas_queue_create) ***/
+
+/* Return NULL if the request cannot be allocated.  Operands must stay
+   valid until the request finishes; argument errors reach xerbla when
+   it runs */
+openblas_request_t *cblas_sgemm_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+				      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+				      OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST float *B, OPENBLAS_CONST blasint ldb,
+				      OPENBLAS_CONST float beta, float *C, OPENBLAS_CONST blasint ldc);
+openblas_request_t *cblas_dgemm_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_TRANSPOSE TransB,
+				      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST blasint K,
+				      OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda, OPENBLAS_CONST double *B, OPENBLAS_CONST blasint ldb,
+				      OPENBLAS_CONST double beta, double *C, OPENBLAS_CONST blasint ldc);
+openblas_request_t *cblas_sgemv_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER order, OPENBLAS_CONST enum CBLAS_TRANSPOSE trans,
+				      OPENBLAS_CONST blasint m, OPENBLAS_CONST blasint n, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *a, OPENBLAS_CONST blasint lda,
+				      OPENBLAS_CONST float *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST float beta, float *y, OPENBLAS_CONST blasint incy);
+openblas_request_t *cblas_dgemv_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER order, OPENBLAS_CONST enum CBLAS_TRANSPOSE trans,
+				      OPENBLAS_CONST blasint m, OPENBLAS_CONST blasint n, OPENBLAS_CONST double alpha, OPENBLAS_CONST double *a, OPENBLAS_CONST blasint lda,
+				      OPENBLAS_CONST double *x, OPENBLAS_CONST blasint incx, OPENBLAS_CONST double beta, double *y, OPENBLAS_CONST blasint incy);
+openblas_request_t *cblas_strsm_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE Side, OPENBLAS_CONST enum CBLAS_UPLO Uplo,
+				      OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_DIAG Diag,
+				      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST float alpha, OPENBLAS_CONST float *A, OPENBLAS_CONST blasint lda,
+				      float *B, OPENBLAS_CONST blasint ldb);
+openblas_request_t *cblas_dtrsm_async(openblas_queue_t *queue, OPENBLAS_CONST enum CBLAS_ORDER Order, OPENBLAS_CONST enum CBLAS_SIDE Side, OPENBLAS_CONST enum CBLAS_UPLO Uplo,
+				      OPENBLAS_CONST enum CBLAS_TRANSPOSE TransA, OPENBLAS_CONST enum CBLAS_DIAG Diag,
+				      OPENBLAS_CONST blasint M, OPENBLAS_CONST blasint N, OPENBLAS_CONST double alpha, OPENBLAS_CONST double *A, OPENBLAS_CONST blasint lda,
+				      double *B, OPENBLAS_CONST blasint ldb);
 
 #ifdef __cplusplus
 }
@@ -223,6 +223,14 @@ if (USE_THREAD)
   if (BIGNUMA)
     set(CCOMMON_OPT "${CCOMMON_OPT} -DBIGNUMA")
   endif ()
+
+  if (USE_WORK_STEALING)
+    set(CCOMMON_OPT "${CCOMMON_OPT} -DUSE_WORK_STEALING")
+  endif ()
+
+  if (USE_FUTEX)
+    set(CCOMMON_OPT "${CCOMMON_OPT} -DUSE_FUTEX")
+  endif ()
 endif ()
 
 if (NO_WARMUP)
@@ -628,6 +628,8 @@ static void __inline blas_lock(volatile BLASULONG *address){
 
 /* Common Memory Management Routine */
 void  blas_set_parameter(void);
+void  blas_load_profile(void);
+extern int blas_switch_ratio[];
 int   blas_get_cpu_number(void);
 void *blas_memory_alloc  (int);
 void  blas_memory_free   (void *);
@@ -644,6 +646,31 @@ int get_node_equal (void);
 
 void goto_set_num_threads(int);
 
+/* Level of the diagnostics printed to stderr (OPENBLAS_VERBOSE) */
+int openblas_verbose(void);
+
+/* Nonzero when results must not depend on the thread count */
+int openblas_reproducible(void);
+
+/* 0, 1 or 2 as set by openblas_set_tiled_lapack */
+int openblas_tiled_lapack(void);
+
+/* Output bytes of one kernel call from which the x86_64 copy, scal */
+/* and axpby kernels use non-temporal stores                        */
+size_t openblas_get_stream_threshold(void);
+
+#define BLAS_STREAM_MIN		(1L << 20)
+#define BLAS_STREAM(bytes)	((bytes) >= BLAS_STREAM_MIN && \
+				 (size_t)(bytes) >= openblas_get_stream_threshold())
+
+/* Asynchronous requests (driver/others/openblas_async.c) : routine */
+/* runs on args, copied into the request, on the queue's dispatcher */
+typedef struct openblas_request blas_request_t;
+typedef struct openblas_queue   blas_async_queue_t;
+
+blas_request_t *blas_async_submit(blas_async_queue_t *queue, void (*routine)(void *),
+				  const void *args, size_t size);
+
 void gotoblas_affinity_init(void);
 void gotoblas_affinity_quit(void);
 void gotoblas_dynamic_init(void);
@@ -687,6 +714,12 @@ static __inline void blas_unlock(volatile BLASULONG *address){
   *address = 0;
 }
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#define BLAS_THREAD_LOCAL __declspec(thread)
+#else
+#define BLAS_THREAD_LOCAL __thread
+#endif
+
 #ifdef OS_WINDOWSSTORE
 static __inline int readenv_atoi(char *env) {
 	return 0;
@@ -156,6 +156,14 @@
 #define DIMATCOPY_K_RT      dimatcopy_k_rt
 #define DGEADD_K                dgeadd_k 
 
+#define DGEMM_SMALL_KERNEL_NN	dgemm_small_kernel_nn
+#define DGEMM_SMALL_KERNEL_NT	dgemm_small_kernel_nt
+#define DGEMM_SMALL_KERNEL_TN	dgemm_small_kernel_tn
+#define DGEMM_SMALL_KERNEL_TT	dgemm_small_kernel_tt
+
+#define DGEMM_SKINNY_KERNEL_N	dgemm_skinny_kernel_n
+#define DGEMM_SKINNY_KERNEL_T	dgemm_skinny_kernel_t
+
 #else
 
 #define	DAMAX_K			gotoblas -> damax_k
@@ -279,6 +287,14 @@
 
 #define DGEADD_K                gotoblas -> dgeadd_k 
 
+#define DGEMM_SMALL_KERNEL_NN	gotoblas -> dgemm_small_kernel_nn
+#define DGEMM_SMALL_KERNEL_NT	gotoblas -> dgemm_small_kernel_nt
+#define DGEMM_SMALL_KERNEL_TN	gotoblas -> dgemm_small_kernel_tn
+#define DGEMM_SMALL_KERNEL_TT	gotoblas -> dgemm_small_kernel_tt
+
+#define DGEMM_SKINNY_KERNEL_N	gotoblas -> dgemm_skinny_kernel_n
+#define DGEMM_SKINNY_KERNEL_T	gotoblas -> dgemm_skinny_kernel_t
+
 #endif
 
 #define	DGEMM_NN		dgemm_nn
@@ -298,6 +314,19 @@
 #define	DGEMM_RC		dgemm_nt
 #define	DGEMM_RR		dgemm_nn
 
+#define	DGEMM_PN		dgemm_pn
+#define	DGEMM_PT		dgemm_pt
+#define	DGEMM_NP		dgemm_np
+#define	DGEMM_TP		dgemm_tp
+#define	DGEMM_PP		dgemm_pp
+
+#define	DGEMM_EX_NN		dgemm_ex_nn
+#define	DGEMM_EX_NT		dgemm_ex_nt
+#define	DGEMM_EX_TN		dgemm_ex_tn
+#define	DGEMM_EX_TT		dgemm_ex_tt
+
+#define	DGEMM_SKINNY		dgemm_skinny
+
 #define	DSYMM_LU		dsymm_LU
 #define	DSYMM_LL		dsymm_LL
 #define	DSYMM_RU		dsymm_RU
@@ -658,6 +658,21 @@ int BLASFUNC(cgetrf)(blasint *, blasint *, float  *, blasint *, blasint *, blasi
 int BLASFUNC(zgetrf)(blasint *, blasint *, double *, blasint *, blasint *, blasint *);
 int BLASFUNC(xgetrf)(blasint *, blasint *, xdouble *, blasint *, blasint *, blasint *);
 
+int BLASFUNC(sgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+int BLASFUNC(cgeqrf)(blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(zgeqrf)(blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+
+int BLASFUNC(sorgqr)(blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(dorgqr)(blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+int BLASFUNC(cungqr)(blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, blasint *);
+int BLASFUNC(zungqr)(blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, blasint *);
+
+int BLASFUNC(sormqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(dormqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, double *, blasint *, blasint *);
+int BLASFUNC(cunmqr)(char *, char *, blasint *, blasint *, blasint *, float  *, blasint *, float  *, float  *, blasint *, float  *, blasint *, blasint *);
+int BLASFUNC(zunmqr)(char *, char *, blasint *, blasint *, blasint *, double *, blasint *, double *, double *, blasint *, double *, blasint *, blasint *);
+
 int BLASFUNC(slaswp)(blasint *, float  *, blasint *, blasint *, blasint *, blasint *, blasint *);
 int BLASFUNC(dlaswp)(blasint *, double *, blasint *, blasint *, blasint *, blasint *, blasint *);
 int BLASFUNC(qlaswp)(blasint *, xdouble *, blasint *, blasint *, blasint *, blasint *, blasint *);
@@ -700,6 +715,27 @@ int BLASFUNC(cpotrs)(char *, blasint *, blasint *, float   *, blasint *, float
 int BLASFUNC(zpotrs)(char *, blasint *, blasint *, double  *, blasint *, double  *, blasint *, blasint *);
 int BLASFUNC(xpotrs)(char *, blasint *, blasint *, xdouble *, blasint *, xdouble *, blasint *, blasint *);
 
+/* Batched real factorizations and solves, grouped and strided */
+int BLASFUNC(sgetrf_batch)(blasint *, blasint *, float  **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrf_batch)(blasint *, blasint *, double **, blasint *, blasint **, blasint *, blasint *, blasint *);
+int BLASFUNC(sgetrf_batch_strided)(blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrf_batch_strided)(blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(sgetrs_batch)(char *, blasint *, blasint *, float  **, blasint *, blasint **, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrs_batch)(char *, blasint *, blasint *, double **, blasint *, blasint **, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(sgetrs_batch_strided)(char *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dgetrs_batch_strided)(char *, blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(spotrf_batch)(char *, blasint *, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrf_batch)(char *, blasint *, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(spotrf_batch_strided)(char *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrf_batch_strided)(char *, blasint *, double *, blasint *, blasint *, blasint *, blasint *);
+
+int BLASFUNC(spotrs_batch)(char *, blasint *, blasint *, float  **, blasint *, float  **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrs_batch)(char *, blasint *, blasint *, double **, blasint *, double **, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(spotrs_batch_strided)(char *, blasint *, blasint *, float  *, blasint *, blasint *, float  *, blasint *, blasint *, blasint *, blasint *);
+int BLASFUNC(dpotrs_batch_strided)(char *, blasint *, blasint *, double *, blasint *, blasint *, double *, blasint *, blasint *, blasint *, blasint *);
+
 int BLASFUNC(slauu2)(char *, blasint *, float  *, blasint *, blasint *);
 int BLASFUNC(dlauu2)(char *, blasint *, double *, blasint *, blasint *);
 int BLASFUNC(qlauu2)(char *, blasint *, xdouble *, blasint *, blasint *);
@@ -61,6 +61,16 @@ blasint cgetrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *,
 blasint zgetrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 blasint xgetrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+blasint sgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint qgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+blasint cgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint xgetrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
+blasint sgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgetrf_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 int slaswp_plus (BLASLONG, BLASLONG, BLASLONG, float,   float   *, BLASLONG, float  *, BLASLONG, blasint *, BLASLONG);
 int slaswp_minus(BLASLONG, BLASLONG, BLASLONG, float,   float   *, BLASLONG, float  *, BLASLONG, blasint *, BLASLONG);
 int dlaswp_plus (BLASLONG, BLASLONG, BLASLONG, double,  double  *, BLASLONG, double *, BLASLONG, blasint *, BLASLONG);
@@ -120,6 +130,11 @@ blasint xgetrs_T_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdoub
 blasint xgetrs_R_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 blasint xgetrs_C_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+blasint sgetrs_N_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sgetrs_T_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgetrs_N_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dgetrs_T_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 blasint spotf2_U(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint spotf2_L(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint dpotf2_U(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
@@ -159,6 +174,58 @@ blasint zpotrf_L_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double
 blasint xpotrf_U_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 blasint xpotrf_L_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+blasint spotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint qpotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+blasint qpotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+blasint cpotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint cpotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zpotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zpotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint xpotrf_U_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+blasint xpotrf_L_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
+
+blasint spotrf_U_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrf_L_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrf_U_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrf_L_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint spotrs_U_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrs_L_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrs_U_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrs_L_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint spotrs_U_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrs_L_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrs_U_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrs_L_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint spotrs_U_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrs_L_small(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrs_U_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrs_L_small(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+/* Compact batch kernels : BATCH_LANES matrices interleaved so that */
+/* element (i, j) of each shares one cache line                     */
+#define BATCH_LANES	(64 / SIZE)
+/* largest order the batched interfaces hand to them */
+#define BATCH_COMPACT_MAX	64
+
+blasint sgetrf_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgetrf_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sgetrs_N_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sgetrs_T_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgetrs_N_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dgetrs_T_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint spotrf_U_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrf_L_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrf_U_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrf_L_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint spotrs_U_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint spotrs_L_compact(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dpotrs_U_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dpotrs_L_compact(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 blasint slauu2_U(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint slauu2_L(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
 blasint dlauu2_U(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
@@ -293,4 +360,73 @@ blasint zlarf_R(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLO
 blasint xlarf_L(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 blasint xlarf_R(blas_arg_t *, BLASLONG *, BLASLONG *, xdouble *, xdouble *, BLASLONG);
 
+/* Native QR : geqr2_k, larft_k and larfb_?? are shared by geqrf, orgqr and ormqr */
+blasint sgeqr2_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqr2_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgeqr2_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zgeqr2_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zgeqrf_single(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zgeqrf_parallel(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint sgeqrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dgeqrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cgeqrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zgeqrf_tiled(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sorg2r_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dorg2r_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint corg2r_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zorg2r_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sorgqr_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dorgqr_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint corgqr_k(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zorgqr_k(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+int slarft_k(BLASLONG, BLASLONG, float *, BLASLONG, float *, float *, BLASLONG, float *);
+int dlarft_k(BLASLONG, BLASLONG, double *, BLASLONG, double *, double *, BLASLONG, double *);
+int clarft_k(BLASLONG, BLASLONG, float *, BLASLONG, float *, float *, BLASLONG, float *);
+int zlarft_k(BLASLONG, BLASLONG, double *, BLASLONG, double *, double *, BLASLONG, double *);
+
+blasint slarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint slarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint slarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint slarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dlarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dlarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dlarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dlarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint clarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint clarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint clarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint clarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zlarfb_LN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zlarfb_LT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zlarfb_RN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zlarfb_RT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+blasint sormqr_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_LT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint sormqr_RT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint dormqr_LN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_LT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint dormqr_RT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint cormqr_LN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint cormqr_LT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint cormqr_RN(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint cormqr_RT(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+blasint zormqr_LN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zormqr_LT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zormqr_RN(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+blasint zormqr_RT(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 #endif
@@ -54,6 +54,32 @@ extern void sgemm_kernel_direct(BLASLONG M, BLASLONG N, BLASLONG K,
 
 extern int sgemm_kernel_direct_performant(BLASLONG M, BLASLONG N, BLASLONG K);
 
+int sgemm_small_kernel_nn(BLASLONG, BLASLONG, BLASLONG, float,
+	  float  *, BLASLONG, float  *, BLASLONG, float,  float  *, BLASLONG);
+int sgemm_small_kernel_nt(BLASLONG, BLASLONG, BLASLONG, float,
+	  float  *, BLASLONG, float  *, BLASLONG, float,  float  *, BLASLONG);
+int sgemm_small_kernel_tn(BLASLONG, BLASLONG, BLASLONG, float,
+	  float  *, BLASLONG, float  *, BLASLONG, float,  float  *, BLASLONG);
+int sgemm_small_kernel_tt(BLASLONG, BLASLONG, BLASLONG, float,
+	  float  *, BLASLONG, float  *, BLASLONG, float,  float  *, BLASLONG);
+int dgemm_small_kernel_nn(BLASLONG, BLASLONG, BLASLONG, double,
+	  double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+int dgemm_small_kernel_nt(BLASLONG, BLASLONG, BLASLONG, double,
+	  double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+int dgemm_small_kernel_tn(BLASLONG, BLASLONG, BLASLONG, double,
+	  double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+int dgemm_small_kernel_tt(BLASLONG, BLASLONG, BLASLONG, double,
+	  double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+
+int sgemm_skinny_kernel_n(BLASLONG, BLASLONG, BLASLONG,
+	  float  *, BLASLONG, float  *, float,  float  *, BLASLONG, BLASLONG);
+int sgemm_skinny_kernel_t(BLASLONG, BLASLONG, BLASLONG,
+	  float  *, BLASLONG, float  *, float,  float  *, BLASLONG, BLASLONG);
+int dgemm_skinny_kernel_n(BLASLONG, BLASLONG, BLASLONG,
+	  double *, BLASLONG, double *, double, double *, BLASLONG, BLASLONG);
+int dgemm_skinny_kernel_t(BLASLONG, BLASLONG, BLASLONG,
+	  double *, BLASLONG, double *, double, double *, BLASLONG, BLASLONG);
+
 
 int sgemm_beta(BLASLONG, BLASLONG, BLASLONG, float,
 	       float  *, BLASLONG, float   *, BLASLONG, float  *, BLASLONG);
@@ -537,6 +563,49 @@ int dgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG)
 int dgemm_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 int dgemm_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
 
+int sgemm_pn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_pt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_np(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_tp(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_pp(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int dgemm_pn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_pt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_np(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_tp(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_pp(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
+/* K block of the level 3 drivers in reproducible mode : one depth for */
+/* every core of a kernel family, capped by GEMM_Q for the pack buffers */
+#define GEMM_REPRO_Q	MIN(128, GEMM_Q)
+
+/* Widest narrow side (N, or M) that ?gemm hands to the skinny driver */
+#define GEMM_SKINNY_N	16
+
+int sgemm_skinny(blas_arg_t *, int, float  *);
+int dgemm_skinny(blas_arg_t *, int, double *);
+
+/* Epilogue of cblas_?gemm_ex in column major terms, handed to the */
+/* ?gemm_ex_?? drivers through blas_arg_t.d; NULL vectors are skipped */
+#define GEMM_EPILOGUE_NONE	0
+#define GEMM_EPILOGUE_RELU	1
+#define GEMM_EPILOGUE_GELU	2
+
+typedef struct {
+  void *row_bias, *col_bias, *row_scale, *col_scale;
+  int activation;
+} gemm_epilogue_t;
+
+int sgemm_ex_nn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_nt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_tn(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+int sgemm_ex_tt(blas_arg_t *, BLASLONG *, BLASLONG *, float *, float *, BLASLONG);
+
+int dgemm_ex_nn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_ex_nt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_ex_tn(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+int dgemm_ex_tt(blas_arg_t *, BLASLONG *, BLASLONG *, double *, double *, BLASLONG);
+
 #ifdef QUAD_PRECISION
 int qgemm_nn(blas_arg_t *, BLASLONG *, BLASLONG *, xidouble *, xidouble *, BLASLONG);
 int qgemm_nt(blas_arg_t *, BLASLONG *, BLASLONG *, xidouble *, xidouble *, BLASLONG);
@@ -473,6 +473,19 @@
 #define	GEMM_RC			DGEMM_NT
 #define	GEMM_RR			DGEMM_NN
 
+#define	GEMM_PN			DGEMM_PN
+#define	GEMM_PT			DGEMM_PT
+#define	GEMM_NP			DGEMM_NP
+#define	GEMM_TP			DGEMM_TP
+#define	GEMM_PP			DGEMM_PP
+
+#define	GEMM_EX_NN		DGEMM_EX_NN
+#define	GEMM_EX_NT		DGEMM_EX_NT
+#define	GEMM_EX_TN		DGEMM_EX_TN
+#define	GEMM_EX_TT		DGEMM_EX_TT
+
+#define	GEMM_SKINNY		DGEMM_SKINNY
+
 #define	SYMM_LU			DSYMM_LU
 #define	SYMM_LL			DSYMM_LL
 #define	SYMM_RU			DSYMM_RU
@@ -640,6 +653,14 @@
 #define IMATCOPY_K_RT		DIMATCOPY_K_RT
 
 #define GEADD_K                 DGEADD_K 
+
+#define GEMM_SMALL_KERNEL_NN	DGEMM_SMALL_KERNEL_NN
+#define GEMM_SMALL_KERNEL_NT	DGEMM_SMALL_KERNEL_NT
+#define GEMM_SMALL_KERNEL_TN	DGEMM_SMALL_KERNEL_TN
+#define GEMM_SMALL_KERNEL_TT	DGEMM_SMALL_KERNEL_TT
+
+#define GEMM_SKINNY_KERNEL_N	DGEMM_SKINNY_KERNEL_N
+#define GEMM_SKINNY_KERNEL_T	DGEMM_SKINNY_KERNEL_T
 #else
 
 #define	AMAX_K			SAMAX_K
@@ -775,6 +796,19 @@
 #define	GEMM_RC			SGEMM_NT
 #define	GEMM_RR			SGEMM_NN
 
+#define	GEMM_PN			SGEMM_PN
+#define	GEMM_PT			SGEMM_PT
+#define	GEMM_NP			SGEMM_NP
+#define	GEMM_TP			SGEMM_TP
+#define	GEMM_PP			SGEMM_PP
+
+#define	GEMM_EX_NN		SGEMM_EX_NN
+#define	GEMM_EX_NT		SGEMM_EX_NT
+#define	GEMM_EX_TN		SGEMM_EX_TN
+#define	GEMM_EX_TT		SGEMM_EX_TT
+
+#define	GEMM_SKINNY		SGEMM_SKINNY
+
 #define	SYMM_LU			SSYMM_LU
 #define	SYMM_LL			SSYMM_LL
 #define	SYMM_RU			SSYMM_RU
@@ -942,6 +976,14 @@
 #define IMATCOPY_K_RT		SIMATCOPY_K_RT
 
 #define GEADD_K 		SGEADD_K 
+
+#define GEMM_SMALL_KERNEL_NN	SGEMM_SMALL_KERNEL_NN
+#define GEMM_SMALL_KERNEL_NT	SGEMM_SMALL_KERNEL_NT
+#define GEMM_SMALL_KERNEL_TN	SGEMM_SMALL_KERNEL_TN
+#define GEMM_SMALL_KERNEL_TT	SGEMM_SMALL_KERNEL_TT
+
+#define GEMM_SKINNY_KERNEL_N	SGEMM_SKINNY_KERNEL_N
+#define GEMM_SKINNY_KERNEL_T	SGEMM_SKINNY_KERNEL_T
 #endif
 #else
 #ifdef XDOUBLE
@@ -2530,6 +2572,7 @@ typedef struct {
 #define GETRS_T		QGETRS_T
 #define GETRF_SINGLE	qgetrf_single
 #define GETRF_PARALLEL	qgetrf_parallel
+#define GETRF_TILED	qgetrf_tiled
 #define NEG_TCOPY	QNEG_TCOPY
 #define	LARF_L		QLARF_L
 #define	LARF_R		QLARF_R
@@ -2551,6 +2594,13 @@ typedef struct {
 #define GETRS_T		DGETRS_T
 #define GETRF_SINGLE	dgetrf_single
 #define GETRF_PARALLEL	dgetrf_parallel
+#define GETRF_TILED	dgetrf_tiled
+#define GETRF_SMALL	dgetrf_small
+#define GETRS_N_SMALL	dgetrs_N_small
+#define GETRS_T_SMALL	dgetrs_T_small
+#define GETRF_COMPACT	dgetrf_compact
+#define GETRS_N_COMPACT	dgetrs_N_compact
+#define GETRS_T_COMPACT	dgetrs_T_compact
 #define NEG_TCOPY	DNEG_TCOPY
 #define	LARF_L		DLARF_L
 #define	LARF_R		DLARF_R
@@ -2572,6 +2622,13 @@ typedef struct {
 #define GETRS_T		SGETRS_T
 #define GETRF_SINGLE	sgetrf_single
 #define GETRF_PARALLEL	sgetrf_parallel
+#define GETRF_TILED	sgetrf_tiled
+#define GETRF_SMALL	sgetrf_small
+#define GETRS_N_SMALL	sgetrs_N_small
+#define GETRS_T_SMALL	sgetrs_T_small
+#define GETRF_COMPACT	sgetrf_compact
+#define GETRS_N_COMPACT	sgetrs_N_compact
+#define GETRS_T_COMPACT	sgetrs_T_compact
 #define NEG_TCOPY	SNEG_TCOPY
 #define	LARF_L		SLARF_L
 #define	LARF_R		SLARF_R
@@ -2595,6 +2652,7 @@ typedef struct {
 #define GETRS_T		XGETRS_T
 #define GETRF_SINGLE	xgetrf_single
 #define GETRF_PARALLEL	xgetrf_parallel
+#define GETRF_TILED	xgetrf_tiled
 #define NEG_TCOPY	XNEG_TCOPY
 #define	LARF_L		XLARF_L
 #define	LARF_R		XLARF_R
@@ -2616,6 +2674,7 @@ typedef struct {
 #define GETRS_T		ZGETRS_T
 #define GETRF_SINGLE	zgetrf_single
 #define GETRF_PARALLEL	zgetrf_parallel
+#define GETRF_TILED	zgetrf_tiled
 #define NEG_TCOPY	ZNEG_TCOPY
 #define	LARF_L		ZLARF_L
 #define	LARF_R		ZLARF_R
@@ -2637,6 +2696,7 @@ typedef struct {
 #define GETRS_T		CGETRS_T
 #define GETRF_SINGLE	cgetrf_single
 #define GETRF_PARALLEL	cgetrf_parallel
+#define GETRF_TILED	cgetrf_tiled
 #define NEG_TCOPY	CNEG_TCOPY
 #define	LARF_L		CLARF_L
 #define	LARF_R		CLARF_R
@@ -2653,6 +2713,8 @@ typedef struct {
 #define  POTRF_L_SINGLE qpotrf_L_single
 #define  POTRF_U_PARALLEL qpotrf_U_parallel
 #define  POTRF_L_PARALLEL qpotrf_L_parallel
+#define  POTRF_U_TILED qpotrf_U_tiled
+#define  POTRF_L_TILED qpotrf_L_tiled
 #define  LAUUM_U_SINGLE qlauum_U_single
 #define  LAUUM_L_SINGLE qlauum_L_single
 #define  LAUUM_U_PARALLEL qlauum_U_parallel
@@ -2678,6 +2740,20 @@ typedef struct {
 #define  POTRF_L_SINGLE dpotrf_L_single
 #define  POTRF_U_PARALLEL dpotrf_U_parallel
 #define  POTRF_L_PARALLEL dpotrf_L_parallel
+#define  POTRF_U_TILED dpotrf_U_tiled
+#define  POTRF_L_TILED dpotrf_L_tiled
+#define  POTRF_U_SMALL dpotrf_U_small
+#define  POTRF_L_SMALL dpotrf_L_small
+#define  POTRS_U_SINGLE dpotrs_U_single
+#define  POTRS_L_SINGLE dpotrs_L_single
+#define  POTRS_U_PARALLEL dpotrs_U_parallel
+#define  POTRS_L_PARALLEL dpotrs_L_parallel
+#define  POTRS_U_SMALL dpotrs_U_small
+#define  POTRS_L_SMALL dpotrs_L_small
+#define  POTRF_U_COMPACT dpotrf_U_compact
+#define  POTRF_L_COMPACT dpotrf_L_compact
+#define  POTRS_U_COMPACT dpotrs_U_compact
+#define  POTRS_L_COMPACT dpotrs_L_compact
 #define  LAUUM_U_SINGLE dlauum_U_single
 #define  LAUUM_L_SINGLE dlauum_L_single
 #define  LAUUM_U_PARALLEL dlauum_U_parallel
@@ -2703,6 +2779,20 @@ typedef struct {
 #define  POTRF_L_SINGLE spotrf_L_single
 #define  POTRF_U_PARALLEL spotrf_U_parallel
 #define  POTRF_L_PARALLEL spotrf_L_parallel
+#define  POTRF_U_TILED spotrf_U_tiled
+#define  POTRF_L_TILED spotrf_L_tiled
+#define  POTRF_U_SMALL spotrf_U_small
+#define  POTRF_L_SMALL spotrf_L_small
+#define  POTRS_U_SINGLE spotrs_U_single
+#define  POTRS_L_SINGLE spotrs_L_single
+#define  POTRS_U_PARALLEL spotrs_U_parallel
+#define  POTRS_L_PARALLEL spotrs_L_parallel
+#define  POTRS_U_SMALL spotrs_U_small
+#define  POTRS_L_SMALL spotrs_L_small
+#define  POTRF_U_COMPACT spotrf_U_compact
+#define  POTRF_L_COMPACT spotrf_L_compact
+#define  POTRS_U_COMPACT spotrs_U_compact
+#define  POTRS_L_COMPACT spotrs_L_compact
 #define  LAUUM_U_SINGLE slauum_U_single
 #define  LAUUM_L_SINGLE slauum_L_single
 #define  LAUUM_U_PARALLEL slauum_U_parallel
@@ -2730,6 +2820,8 @@ typedef struct {
 #define  POTRF_L_SINGLE xpotrf_L_single
 #define  POTRF_U_PARALLEL xpotrf_U_parallel
 #define  POTRF_L_PARALLEL xpotrf_L_parallel
+#define  POTRF_U_TILED xpotrf_U_tiled
+#define  POTRF_L_TILED xpotrf_L_tiled
 #define  LAUUM_U_SINGLE xlauum_U_single
 #define  LAUUM_L_SINGLE xlauum_L_single
 #define  LAUUM_U_PARALLEL xlauum_U_parallel
@@ -2755,6 +2847,8 @@ typedef struct {
 #define  POTRF_L_SINGLE zpotrf_L_single
 #define  POTRF_U_PARALLEL zpotrf_U_parallel
 #define  POTRF_L_PARALLEL zpotrf_L_parallel
+#define  POTRF_U_TILED zpotrf_U_tiled
+#define  POTRF_L_TILED zpotrf_L_tiled
 #define  LAUUM_U_SINGLE zlauum_U_single
 #define  LAUUM_L_SINGLE zlauum_L_single
 #define  LAUUM_U_PARALLEL zlauum_U_parallel
@@ -2780,6 +2874,8 @@ typedef struct {
 #define  POTRF_L_SINGLE cpotrf_L_single
 #define  POTRF_U_PARALLEL cpotrf_U_parallel
 #define  POTRF_L_PARALLEL cpotrf_L_parallel
+#define  POTRF_U_TILED cpotrf_U_tiled
+#define  POTRF_L_TILED cpotrf_L_tiled
 #define  LAUUM_U_SINGLE clauum_U_single
 #define  LAUUM_L_SINGLE clauum_L_single
 #define  LAUUM_U_PARALLEL clauum_U_parallel
@@ -2799,4 +2895,82 @@ typedef struct {
 #endif
 #endif
 
+
+/* Native QR drivers (lapack/geqrf); LT and RT apply the (conjugate) */
+/* transpose of the block reflector                                  */
+#ifndef XDOUBLE
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define  GEQR2 dgeqr2_k
+#define  LARFT dlarft_k
+#define  LARFB_LN dlarfb_LN
+#define  LARFB_LT dlarfb_LT
+#define  LARFB_RN dlarfb_RN
+#define  LARFB_RT dlarfb_RT
+#define  GEQRF_SINGLE dgeqrf_single
+#define  GEQRF_PARALLEL dgeqrf_parallel
+#define  GEQRF_TILED dgeqrf_tiled
+#define  ORG2R dorg2r_k
+#define  ORGQR dorgqr_k
+#define  ORMQR_LN dormqr_LN
+#define  ORMQR_LT dormqr_LT
+#define  ORMQR_RN dormqr_RN
+#define  ORMQR_RT dormqr_RT
+#else
+#define  GEQR2 sgeqr2_k
+#define  LARFT slarft_k
+#define  LARFB_LN slarfb_LN
+#define  LARFB_LT slarfb_LT
+#define  LARFB_RN slarfb_RN
+#define  LARFB_RT slarfb_RT
+#define  GEQRF_SINGLE sgeqrf_single
+#define  GEQRF_PARALLEL sgeqrf_parallel
+#define  GEQRF_TILED sgeqrf_tiled
+#define  ORG2R sorg2r_k
+#define  ORGQR sorgqr_k
+#define  ORMQR_LN sormqr_LN
+#define  ORMQR_LT sormqr_LT
+#define  ORMQR_RN sormqr_RN
+#define  ORMQR_RT sormqr_RT
+#endif
+#else
+#ifdef DOUBLE
+#define  GEQR2 zgeqr2_k
+#define  LARFT zlarft_k
+#define  LARFB_LN zlarfb_LN
+#define  LARFB_LT zlarfb_LT
+#define  LARFB_RN zlarfb_RN
+#define  LARFB_RT zlarfb_RT
+#define  GEQRF_SINGLE zgeqrf_single
+#define  GEQRF_PARALLEL zgeqrf_parallel
+#define  GEQRF_TILED zgeqrf_tiled
+#define  ORG2R zorg2r_k
+#define  ORGQR zorgqr_k
+#define  ORMQR_LN zormqr_LN
+#define  ORMQR_LT zormqr_LT
+#define  ORMQR_RN zormqr_RN
+#define  ORMQR_RT zormqr_RT
+#else
+#define  GEQR2 cgeqr2_k
+#define  LARFT clarft_k
+#define  LARFB_LN clarfb_LN
+#define  LARFB_LT clarfb_LT
+#define  LARFB_RN clarfb_RN
+#define  LARFB_RT clarfb_RT
+#define  GEQRF_SINGLE cgeqrf_single
+#define  GEQRF_PARALLEL cgeqrf_parallel
+#define  GEQRF_TILED cgeqrf_tiled
+#define  ORG2R corg2r_k
+#define  ORGQR corgqr_k
+#define  ORMQR_LN cormqr_LN
+#define  ORMQR_LT cormqr_LT
+#define  ORMQR_RN cormqr_RN
+#define  ORMQR_RT cormqr_RT
+#endif
+#endif
+
+/* Panel width of the blocked QR drivers */
+#define  QR_BLOCKING ((GEMM_Q / 4 < 16) ? 16 : GEMM_Q / 4)
+#endif
+
 #endif
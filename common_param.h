@@ -890,6 +890,26 @@ BLASLONG (*ixamin_k)(BLASLONG, xdouble *, BLASLONG);
   int    (*cgeadd_k) (BLASLONG, BLASLONG, float, float,  float *,  BLASLONG, float, float, float *, BLASLONG); 
   int    (*zgeadd_k) (BLASLONG, BLASLONG, double, double, double *, BLASLONG, double, double, double *, BLASLONG); 
 
+  int sgemm_small_threshold, dgemm_small_threshold;
+
+  int lapack_small_threshold;
+  int potrf_thread_threshold, getrf_thread_threshold, lauum_thread_threshold, trtri_thread_threshold;
+
+  int    (*sgemm_small_kernel_nn)(BLASLONG, BLASLONG, BLASLONG, float, float *, BLASLONG, float *, BLASLONG, float, float *, BLASLONG);
+  int    (*sgemm_small_kernel_nt)(BLASLONG, BLASLONG, BLASLONG, float, float *, BLASLONG, float *, BLASLONG, float, float *, BLASLONG);
+  int    (*sgemm_small_kernel_tn)(BLASLONG, BLASLONG, BLASLONG, float, float *, BLASLONG, float *, BLASLONG, float, float *, BLASLONG);
+  int    (*sgemm_small_kernel_tt)(BLASLONG, BLASLONG, BLASLONG, float, float *, BLASLONG, float *, BLASLONG, float, float *, BLASLONG);
+
+  int    (*dgemm_small_kernel_nn)(BLASLONG, BLASLONG, BLASLONG, double, double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+  int    (*dgemm_small_kernel_nt)(BLASLONG, BLASLONG, BLASLONG, double, double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+  int    (*dgemm_small_kernel_tn)(BLASLONG, BLASLONG, BLASLONG, double, double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+  int    (*dgemm_small_kernel_tt)(BLASLONG, BLASLONG, BLASLONG, double, double *, BLASLONG, double *, BLASLONG, double, double *, BLASLONG);
+
+  int    (*sgemm_skinny_kernel_n)(BLASLONG, BLASLONG, BLASLONG, float *, BLASLONG, float *, float, float *, BLASLONG, BLASLONG);
+  int    (*sgemm_skinny_kernel_t)(BLASLONG, BLASLONG, BLASLONG, float *, BLASLONG, float *, float, float *, BLASLONG, BLASLONG);
+  int    (*dgemm_skinny_kernel_n)(BLASLONG, BLASLONG, BLASLONG, double *, BLASLONG, double *, double, double *, BLASLONG, BLASLONG);
+  int    (*dgemm_skinny_kernel_t)(BLASLONG, BLASLONG, BLASLONG, double *, BLASLONG, double *, double, double *, BLASLONG, BLASLONG);
+
 } gotoblas_t;
 
 extern gotoblas_t *gotoblas;
@@ -901,6 +921,18 @@ extern gotoblas_t *gotoblas;
 
 #define HAVE_EX_L2	gotoblas -> exclusive_cache
 
+#define SGEMM_SMALL_THRESHOLD	gotoblas -> sgemm_small_threshold
+#define DGEMM_SMALL_THRESHOLD	gotoblas -> dgemm_small_threshold
+
+#define LAPACK_SMALL_THRESHOLD	gotoblas -> lapack_small_threshold
+#define POTRF_THREAD_THRESHOLD	gotoblas -> potrf_thread_threshold
+#define GETRF_THREAD_THRESHOLD	gotoblas -> getrf_thread_threshold
+#define LAUUM_THREAD_THRESHOLD	gotoblas -> lauum_thread_threshold
+#define TRTRI_THREAD_THRESHOLD	gotoblas -> trtri_thread_threshold
+
+/* GEMM_P, GEMM_Q and GEMM_R below can be changed at run time */
+#define GEMM_BLOCKING_RUNTIME
+
 #define	SGEMM_P		gotoblas -> sgemm_p
 #define	SGEMM_Q		gotoblas -> sgemm_q
 #define	SGEMM_R		gotoblas -> sgemm_r
@@ -978,6 +1010,15 @@ extern gotoblas_t *gotoblas;
 #define HAVE_EX_L2	0
 #endif
 
+#define SGEMM_SMALL_THRESHOLD	SGEMM_DEFAULT_SMALL_THRESHOLD
+#define DGEMM_SMALL_THRESHOLD	DGEMM_DEFAULT_SMALL_THRESHOLD
+
+#define LAPACK_SMALL_THRESHOLD	LAPACK_DEFAULT_SMALL_THRESHOLD
+#define POTRF_THREAD_THRESHOLD	POTRF_DEFAULT_THREAD_THRESHOLD
+#define GETRF_THREAD_THRESHOLD	GETRF_DEFAULT_THREAD_THRESHOLD
+#define LAUUM_THREAD_THRESHOLD	LAUUM_DEFAULT_THREAD_THRESHOLD
+#define TRTRI_THREAD_THRESHOLD	TRTRI_DEFAULT_THREAD_THRESHOLD
+
 #define	SGEMM_P		SGEMM_DEFAULT_P
 #define	SGEMM_Q		SGEMM_DEFAULT_Q
 #define	SGEMM_R		SGEMM_DEFAULT_R
@@ -1113,6 +1154,7 @@ extern gotoblas_t *gotoblas;
 #define GEMM_DEFAULT_R		DGEMM_DEFAULT_R
 #define GEMM_DEFAULT_UNROLL_M	DGEMM_DEFAULT_UNROLL_M
 #define GEMM_DEFAULT_UNROLL_N	DGEMM_DEFAULT_UNROLL_N
+#define GEMM_SMALL_THRESHOLD	DGEMM_SMALL_THRESHOLD
 #else
 #define GEMM_P			SGEMM_P
 #define GEMM_Q			SGEMM_Q
@@ -1125,6 +1167,7 @@ extern gotoblas_t *gotoblas;
 #define GEMM_DEFAULT_R		SGEMM_DEFAULT_R
 #define GEMM_DEFAULT_UNROLL_M	SGEMM_DEFAULT_UNROLL_M
 #define GEMM_DEFAULT_UNROLL_N	SGEMM_DEFAULT_UNROLL_N
+#define GEMM_SMALL_THRESHOLD	SGEMM_SMALL_THRESHOLD
 #endif
 #else
 #if   defined(XDOUBLE)
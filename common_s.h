@@ -159,6 +159,14 @@
 
 #define SGEADD_K                sgeadd_k 
 
+#define SGEMM_SMALL_KERNEL_NN	sgemm_small_kernel_nn
+#define SGEMM_SMALL_KERNEL_NT	sgemm_small_kernel_nt
+#define SGEMM_SMALL_KERNEL_TN	sgemm_small_kernel_tn
+#define SGEMM_SMALL_KERNEL_TT	sgemm_small_kernel_tt
+
+#define SGEMM_SKINNY_KERNEL_N	sgemm_skinny_kernel_n
+#define SGEMM_SKINNY_KERNEL_T	sgemm_skinny_kernel_t
+
 #else
 
 #define	SAMAX_K			gotoblas -> samax_k
@@ -285,6 +293,14 @@
 
 #define SGEADD_K                gotoblas -> sgeadd_k 
 
+#define SGEMM_SMALL_KERNEL_NN	gotoblas -> sgemm_small_kernel_nn
+#define SGEMM_SMALL_KERNEL_NT	gotoblas -> sgemm_small_kernel_nt
+#define SGEMM_SMALL_KERNEL_TN	gotoblas -> sgemm_small_kernel_tn
+#define SGEMM_SMALL_KERNEL_TT	gotoblas -> sgemm_small_kernel_tt
+
+#define SGEMM_SKINNY_KERNEL_N	gotoblas -> sgemm_skinny_kernel_n
+#define SGEMM_SKINNY_KERNEL_T	gotoblas -> sgemm_skinny_kernel_t
+
 #endif
 
 #define	SGEMM_NN		sgemm_nn
@@ -304,6 +320,19 @@
 #define	SGEMM_RC		sgemm_nt
 #define	SGEMM_RR		sgemm_nn
 
+#define	SGEMM_PN		sgemm_pn
+#define	SGEMM_PT		sgemm_pt
+#define	SGEMM_NP		sgemm_np
+#define	SGEMM_TP		sgemm_tp
+#define	SGEMM_PP		sgemm_pp
+
+#define	SGEMM_EX_NN		sgemm_ex_nn
+#define	SGEMM_EX_NT		sgemm_ex_nt
+#define	SGEMM_EX_TN		sgemm_ex_tn
+#define	SGEMM_EX_TT		sgemm_ex_tt
+
+#define	SGEMM_SKINNY		sgemm_skinny
+
 #define	SSYMM_LU		ssymm_LU
 #define	SSYMM_LL		ssymm_LL
 #define	SSYMM_RU		ssymm_RU
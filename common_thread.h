@@ -44,6 +44,11 @@
 extern void goto_set_num_threads(int nthreads);
 #endif
 
+/* The work-stealing scheduler is only implemented in the pthreads server */
+#if defined(USE_WORK_STEALING) && (defined(USE_OPENMP) || defined(OS_WINDOWS))
+#undef USE_WORK_STEALING
+#endif
+
 /* Basic Thread Debugging */
 #undef SMP_DEBUG
 
@@ -55,9 +60,26 @@ extern int blas_cpu_number;
 extern int blas_num_threads;
 extern int blas_omp_linked;
 
+/* Per-thread execution context (see driver/others/openblas_context.c) */
+typedef struct openblas_context {
+  int nthreads;
+  int ncpus;
+  int cpu[MAX_CPU_NUMBER];
+  int reserved;		/* cpu[] held by this context alone */
+} blas_context_t;
+
+extern blas_context_t *blas_get_context(void);
+extern blas_context_t *openblas_set_context(blas_context_t *ctx);
+
+extern int  blas_cpu_claim(const int *cpus, int ncpus);
+extern int  blas_cpu_claim_free(int *cpus, int want, int pool);
+extern void blas_cpu_release(const int *cpus, int ncpus);
+extern void blas_cpu_release_queues(void);
+
 #define BLAS_LEGACY	0x8000U
 #define BLAS_PTHREAD	0x4000U
 #define BLAS_NODE	0x2000U
+#define BLAS_NODE_HINT	0x1000U	/* with BLAS_NODE : run on node queue->node */
 
 #define BLAS_PREC	0x0003U
 #define BLAS_SINGLE	0x0000U
@@ -113,6 +135,10 @@ typedef struct blas_queue {
 
   int mode, status;
 
+  /* Node index for BLAS_NODE_HINT; 0 is the caller's node, the other */
+  /* nodes that have pool threads follow in ascending order           */
+  int node;
+
 #ifdef CONSISTENT_FPCSR
   unsigned int sse_mode, x87_mode;
 #endif
@@ -131,11 +157,14 @@ extern int blas_server_avail;
 
 static __inline int num_cpu_avail(int level) {
 
+  blas_context_t *ctx = blas_get_context();
+  int nthreads;
+
 #ifdef USE_OPENMP
 	int openmp_nthreads=0;
 #endif
 
-  if (blas_cpu_number == 1
+  if ((blas_cpu_number == 1 && ctx == NULL)
 
 #ifdef USE_OPENMP
       || omp_in_parallel()
@@ -149,8 +178,27 @@ static __inline int num_cpu_avail(int level) {
   }
 #endif
 
-  return blas_cpu_number;
+  if (ctx == NULL) return blas_cpu_number;
+
+  nthreads = ctx -> nthreads;
 
+#ifdef USE_OPENMP
+  if (nthreads > blas_cpu_number) nthreads = blas_cpu_number;
+#else
+  if (nthreads > blas_num_threads) nthreads = blas_num_threads;
+
+  /* The caller plus the pool threads the context may use */
+  if (ctx -> ncpus > 0) {
+    int i, avail = 1;
+    for (i = 0; i < ctx -> ncpus; i++)
+      if (ctx -> cpu[i] < blas_num_threads - 1) avail ++;
+    if (nthreads > avail) nthreads = avail;
+  }
+#endif
+
+  if (nthreads < 1) nthreads = 1;
+
+  return nthreads;
 }
 
 static __inline void blas_queue_init(blas_queue_t *queue){
@@ -166,6 +214,25 @@ int exec_blas(BLASLONG, blas_queue_t *);
 int exec_blas_async(BLASLONG, blas_queue_t *);
 int exec_blas_async_wait(BLASLONG, blas_queue_t *);
 
+#ifdef USE_WORK_STEALING
+/* Tiles per thread the level 3 drivers hand to the stealing scheduler */
+#define BLAS_STEAL_TILES	4
+#define MAX_BLAS_TILES		(MAX_CPU_NUMBER * BLAS_STEAL_TILES)
+
+int exec_blas_steal(BLASLONG, blas_queue_t *, BLASLONG);
+int openblas_work_stealing(void);
+#endif
+
+int openblas_numa_level3(void);
+
+/* Thread count for a call of `work` multiply-adds plus `pack` in the */
+/* same unit, `threshold` being where a second thread starts to pay */
+int blas_model_threads(const char *, double, double, double, int);
+
+/* Multiply-adds one packed element is worth: the kernel register */
+/* block is roughly what a core retires while packing one element */
+#define BLAS_PACK_COST	((double)GEMM_UNROLL_M * (double)GEMM_UNROLL_N / 4.0)
+
 #else
 int exec_blas_async(BLASLONG num_cpu, blas_param_t *param, pthread_t *);
 int exec_blas_async_wait(BLASLONG num_cpu, pthread_t *blas_threads);
@@ -179,7 +246,40 @@ int blas_level1_thread(int mode, BLASLONG m, BLASLONG n, BLASLONG k, void *alpha
 		       void *b, BLASLONG ldb,
 		       void *c, BLASLONG ldc, int (*function)(), int threads);
 
-int gemm_thread_m (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(), void *, void *, BLASLONG);
+/* Partial result of one chunk of a threaded level 1 reduction */
+typedef struct {
+  double   value[2];	/* sum (real, imaginary), extremum or norm */
+  BLASLONG index;	/* 1-based position of the extremum, 0 if none */
+} blas_reduce_t;
+
+#define BLAS_REDUCE_SUM		0
+#define BLAS_REDUCE_MAX		1
+#define BLAS_REDUCE_MIN		2
+#define BLAS_REDUCE_NRM2	3
+
+/* Reproducible mode : chunks of at least this many elements, at most */
+/* this many chunks, whatever the thread count                        */
+#define BLAS_REDUCE_REPRO_CHUNK		4096
+#define BLAS_REDUCE_REPRO_CHUNKS	64
+
+/* function(n, x, incx, y, incy, blas_reduce_t *) reduces one chunk */
+int blas_level1_reduce(int mode, int op, BLASLONG n,
+		       void *x, BLASLONG incx, void *y, BLASLONG incy,
+		       int (*function)(), blas_reduce_t *result, int threads);
+
+/* Elements at which a second thread starts to pay off for the level 1 */
+/* reductions (the threshold argument of blas_model_threads): twice a  */
+/* ~3us dispatch over the per-element time of the Haswell kernels      */
+#define DOT_REDUCE_THRESHOLD	32768.0
+#define ASUM_REDUCE_THRESHOLD	32768.0
+#define NRM2_REDUCE_THRESHOLD	16384.0
+#define IAMAX_REDUCE_THRESHOLD	8192.0
+
+/* Elements of A at which a second thread starts to pay off for the */
+/* out-of-place ?omatcopy copies and transposes                      */
+#define MATCOPY_THREAD_THRESHOLD	65536.0
+
+int gemm_thread_m(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(), void *, void *, BLASLONG);
 
 int gemm_thread_n (int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(), void *, void *, BLASLONG);
 
@@ -187,6 +287,27 @@ int gemm_thread_mn(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*functio
 
 int gemm_thread_variable(int mode, blas_arg_t *, BLASLONG *, BLASLONG *, int (*function)(), void *, void *, BLASLONG, BLASLONG);
 
+int gemm_batch_thread(int mode, blas_arg_t *, int (**routines)(), BLASLONG, void *, void *, BLASLONG);
+
+/* Task DAG scheduler for the tiled LAPACK drivers.  A task gets the */
+/* context given at creation, its three indices and the buffers of   */
+/* the thread running it.                                            */
+typedef struct blas_dag blas_dag_t;
+typedef int (*blas_task_t)(void *, BLASLONG, BLASLONG, BLASLONG, void *, void *);
+
+/* Order and threads from which the tiled drivers are used by default */
+#define BLAS_DAG_THRESHOLD	2048
+#define BLAS_DAG_MIN_THREADS	4
+#define BLAS_DAG_MAX_TILES	64
+
+blas_dag_t *blas_dag_create(void *ctx, BLASLONG ntiles);
+int  blas_dag_insert(blas_dag_t *, blas_task_t, BLASLONG i, BLASLONG j, BLASLONG k,
+		     BLASLONG priority, const BLASLONG *in, BLASLONG nin, const BLASLONG *inout, BLASLONG ninout);
+int  blas_dag_execute(blas_dag_t *, int mode, BLASLONG nthreads, void *sa, void *sb);
+void blas_dag_destroy(blas_dag_t *);
+BLASLONG blas_dag_blocking(BLASLONG n, BLASLONG nb, BLASLONG unroll, int dims, BLASLONG nthreads);
+int  blas_dag_use(BLASLONG n, BLASLONG nthreads);
+
 int trsm_thread(int mode, BLASLONG m, BLASLONG n,
 		double alpha_r, double alpha_i,
 		void *a, BLASLONG lda,
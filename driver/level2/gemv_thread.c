@@ -84,6 +84,9 @@
 #undef UNSAFE
 #endif
 
+/* Range boundary of the reproducible mode, a multiple of any unroll */
+#define GEMV_REPRO_ALIGN 64
+
 #if !defined(TRANSA) && !defined(UNSAFE)
 #define Y_DUMMY_NUM 1024
 #if defined(USE_OPENMP)
@@ -219,6 +222,10 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
 
     width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
     if (width < 4) width = 4;
+    /* kernels treat the rows (columns) past their unroll differently : */
+    /* only the last range may end off a fixed boundary                  */
+    if (openblas_reproducible())
+      width = (width + GEMV_REPRO_ALIGN - 1) & ~(GEMV_REPRO_ALIGN - 1);
     if (i < width) width = i;
 
     range[num_cpu + 1] = range[num_cpu] + width;
@@ -243,8 +250,8 @@ int CNAME(BLASLONG m, BLASLONG n, FLOAT *alpha, FLOAT *a, BLASLONG lda, FLOAT *x
 
 #if !defined(TRANSA) && !defined(UNSAFE) 
   //try to split matrix on row direction and x.
-  //Then, reduction.
-  if (num_cpu < nthreads) {
+  //Then, reduction. The partial sums depend on the thread count.
+  if ((num_cpu < nthreads) && !openblas_reproducible()) {
 
     //too small to split or bigger than the y_dummy buffer.
     double MN = (double) m * (double) n;
@@ -0,0 +1,211 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* C := alpha * op(A) * op(B) + beta * C when N (or M) is at most    */
+/* GEMM_SKINNY_N. The skinny kernels stream the wide operand once     */
+/* instead of packing it; only a block of the narrow operand is       */
+/* packed, scaled by alpha. A narrow M is handled as                  */
+/* C' = op(B)' * op(A)', C' being C read across its rows. Threads     */
+/* split the long side of C, like the gemv_n driver.                  */
+
+/* Range boundary of the reproducible mode, as for gemv */
+#define SKINNY_REPRO_ALIGN	64
+
+/* Elements of the packed block of B : the depth grows as N shrinks, */
+/* giving the kernels longer runs down each column of A              */
+#define SKINNY_B_SIZE	8192
+
+typedef struct {
+  FLOAT *a, *b, *c;
+  BLASLONG n, k, lda;
+  BLASLONG incb, ldb;		/* op(B)(l, j) is b[l * incb + j * ldb] */
+  BLASLONG incc, ldc;		/* C(i, j) is c[i * incc + j * ldc] */
+  FLOAT alpha, beta;
+  int transa;
+} skinny_t;
+
+static int skinny_kernel(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			 FLOAT *sa, FLOAT *sb, BLASLONG pos){
+
+  skinny_t *p = (skinny_t *)args -> d;
+  BLASLONG m_from, m_to, ls, min_l, depth, l, j;
+  FLOAT *b;
+
+  m_from = 0;
+  m_to   = args -> m;
+
+  if (range_m) {
+    m_from = *(range_m + 0);
+    m_to   = *(range_m + 1);
+  }
+
+  if (m_from >= m_to) return 0;
+
+  depth = SKINNY_B_SIZE / p -> n;
+  if (depth < GEMM_Q) depth = GEMM_Q;
+  if (openblas_reproducible()) depth = GEMM_REPRO_Q;
+
+  for (ls = 0; ls < p -> k; ls += min_l) {
+
+    min_l = p -> k - ls;
+    if (min_l > depth) min_l = depth;
+
+    b = p -> b + ls * p -> incb;
+
+    if (!p -> transa) {
+      for (l = 0; l < min_l; l++)
+	for (j = 0; j < p -> n; j++)
+	  sb[l * p -> n + j] = p -> alpha * b[l * p -> incb + j * p -> ldb];
+
+      GEMM_SKINNY_KERNEL_N(m_to - m_from, p -> n, min_l,
+			   p -> a + m_from + ls * p -> lda, p -> lda, sb,
+			   (ls == 0) ? p -> beta : ONE,
+			   p -> c + m_from * p -> incc, p -> incc, p -> ldc);
+    } else {
+      for (j = 0; j < p -> n; j++)
+	for (l = 0; l < min_l; l++)
+	  sb[l + j * min_l] = p -> alpha * b[l * p -> incb + j * p -> ldb];
+
+      GEMM_SKINNY_KERNEL_T(m_to - m_from, p -> n, min_l,
+			   p -> a + ls + m_from * p -> lda, p -> lda, sb,
+			   (ls == 0) ? p -> beta : ONE,
+			   p -> c + m_from * p -> incc, p -> incc, p -> ldc);
+    }
+  }
+
+  return 0;
+}
+
+/* trans is (transb << 1) | transa, as in interface/gemm.c */
+int CNAME(blas_arg_t *args, int trans, FLOAT *sb){
+
+  skinny_t p;
+  blas_arg_t newarg;
+
+#ifdef SMP
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG width, i, num_cpu, nthreads;
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  p.k     = args -> k;
+  p.alpha = *(FLOAT *)args -> alpha;
+  p.beta  = *(FLOAT *)args -> beta;
+
+  if (args -> n <= GEMM_SKINNY_N) {
+    /* C = op(A) * op(B) */
+    newarg.m = args -> m;
+    p.n      = args -> n;
+    p.a      = (FLOAT *)args -> a;
+    p.lda    = args -> lda;
+    p.transa = trans & 1;
+    p.b      = (FLOAT *)args -> b;
+    p.incb   = (trans & 2) ? args -> ldb : 1;
+    p.ldb    = (trans & 2) ? 1 : args -> ldb;
+    p.c      = (FLOAT *)args -> c;
+    p.incc   = 1;
+    p.ldc    = args -> ldc;
+  } else {
+    /* C' = op(B)' * op(A)' */
+    newarg.m = args -> n;
+    p.n      = args -> m;
+    p.a      = (FLOAT *)args -> b;
+    p.lda    = args -> ldb;
+    p.transa = !(trans & 2);
+    p.b      = (FLOAT *)args -> a;
+    p.incb   = (trans & 1) ? 1 : args -> lda;
+    p.ldb    = (trans & 1) ? args -> lda : 1;
+    p.c      = (FLOAT *)args -> c;
+    p.incc   = args -> ldc;
+    p.ldc    = 1;
+  }
+
+  /* common only exists in SMP builds */
+  newarg.d = (void *)&p;
+
+#ifdef SMP
+  nthreads = args -> nthreads;
+
+  if (nthreads > 1) {
+
+    num_cpu  = 0;
+    range[0] = 0;
+    i        = newarg.m;
+
+    while (i > 0){
+
+      width  = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+      /* whole cache lines of C and A per thread */
+      width  = (width + 15) & ~15;
+      /* kernels treat the rows past their unroll differently : */
+      /* only the last range may end off a fixed boundary        */
+      if (openblas_reproducible())
+	width = (width + SKINNY_REPRO_ALIGN - 1) & ~(SKINNY_REPRO_ALIGN - 1);
+      if (i < width) width = i;
+
+      range[num_cpu + 1] = range[num_cpu] + width;
+
+      queue[num_cpu].mode    = mode;
+      queue[num_cpu].routine = skinny_kernel;
+      queue[num_cpu].args    = &newarg;
+      queue[num_cpu].range_m = &range[num_cpu];
+      queue[num_cpu].range_n = NULL;
+      queue[num_cpu].sa      = NULL;
+      queue[num_cpu].sb      = NULL;
+      queue[num_cpu].next    = &queue[num_cpu + 1];
+
+      num_cpu ++;
+      i -= width;
+    }
+
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+
+    return 0;
+  }
+#endif
+
+  skinny_kernel(&newarg, NULL, NULL, NULL, sb, 0);
+
+  return 0;
+}
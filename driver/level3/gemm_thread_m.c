@@ -42,8 +42,17 @@
 
 int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (*function)(), void *sa, void *sb, BLASLONG nthreads) {
 
+#ifdef USE_WORK_STEALING
+  blas_queue_t queue[MAX_BLAS_TILES];
+  BLASLONG range[MAX_BLAS_TILES + 1];
+  BLASLONG nthreads_exec = nthreads;
+
+  /* hand out smaller partitions and let idle threads steal them */
+  if ((nthreads > 1) && openblas_work_stealing()) nthreads *= BLAS_STEAL_TILES;
+#else
   blas_queue_t queue[MAX_CPU_NUMBER];
   BLASLONG range[MAX_CPU_NUMBER + 1];
+#endif
 
   BLASLONG width, i, num_cpu;
 
@@ -83,6 +92,11 @@ int CNAME(int mode, blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n, int (
 
     queue[num_cpu - 1].next = NULL;
 
+#ifdef USE_WORK_STEALING
+    if (nthreads > nthreads_exec)
+      exec_blas_steal(num_cpu, queue, nthreads_exec);
+    else
+#endif
     exec_blas(num_cpu, queue);
   }
 
@@ -59,6 +59,107 @@
 #endif
 #endif
 
+/* Unless there is no update at all, beta is not applied to C in a
+   separate pass: each C tile is scaled on the first K panel just before
+   the kernel adds to it, so it is still in cache for the update.  Wide
+   kernel calls are cut into BETA_TILE_N column chunks for this, and the
+   epilogue of the ?gemm_ex drivers is applied the same way on the last
+   K panel, right after the kernel has finished the chunk. */
+#if !defined(XDOUBLE) || !defined(QUAD_PRECISION)
+#define GEMM_BETA_TILES
+#endif
+
+#ifndef BETA_TILE_N
+#define BETA_TILE_N	(GEMM_UNROLL_N * 4)
+#endif
+
+#ifdef GEMM_EPILOGUE
+#include <math.h>
+
+/* C := act(row_scale[i] * col_scale[j] * C + row_bias[i] + col_bias[j]) */
+/* on a tile of C that holds the finished product                       */
+static void epilogue_tile(blas_arg_t *args, BLASLONG m_from, BLASLONG m_to, BLASLONG n_from, BLASLONG n_to){
+
+  gemm_epilogue_t *ep = (gemm_epilogue_t *)args -> d;
+  FLOAT *row_bias  = (FLOAT *)ep -> row_bias;
+  FLOAT *col_bias  = (FLOAT *)ep -> col_bias;
+  FLOAT *row_scale = (FLOAT *)ep -> row_scale;
+  FLOAT *col_scale = (FLOAT *)ep -> col_scale;
+  FLOAT *c, scale, bias, x;
+  BLASLONG i, j;
+
+  for (j = n_from; j < n_to; j++) {
+    c = (FLOAT *)args -> c + j * args -> ldc;
+
+    scale = col_scale ? col_scale[j] : ONE;
+    bias  = col_bias  ? col_bias[j]  : ZERO;
+
+    if (row_scale) {
+      for (i = m_from; i < m_to; i++) c[i] *= row_scale[i] * scale;
+    } else if (scale != ONE) {
+      for (i = m_from; i < m_to; i++) c[i] *= scale;
+    }
+
+    if (row_bias) {
+      for (i = m_from; i < m_to; i++) c[i] += row_bias[i] + bias;
+    } else if (bias != ZERO) {
+      for (i = m_from; i < m_to; i++) c[i] += bias;
+    }
+
+    switch (ep -> activation) {
+    case GEMM_EPILOGUE_RELU :
+      for (i = m_from; i < m_to; i++) c[i] = (c[i] > ZERO) ? c[i] : ZERO;
+      break;
+    case GEMM_EPILOGUE_GELU :
+      for (i = m_from; i < m_to; i++) {
+	x = c[i];
+#ifdef DOUBLE
+	c[i] = 0.5 * x * (1.0 + erf(x * 0.70710678118654752440));
+#else
+	c[i] = 0.5f * x * (1.0f + erff(x * 0.70710678f));
+#endif
+      }
+      break;
+    }
+  }
+}
+
+#define EPILOGUE_OPERATION(M_FROM, M_TO, N_FROM, N_TO) \
+	epilogue_tile(args, M_FROM, M_TO, N_FROM, N_TO)
+#else
+#define EPILOGUE_OPERATION(M_FROM, M_TO, N_FROM, N_TO) {}
+#endif
+
+#ifndef KERNEL_TILE_OPERATION
+#define KERNEL_TILE_OPERATION(M, N, K, ALPHA, SA, SB, C, LDC, X, Y, BETA, LAST) { \
+	BLASLONG jj_, min_jj_; \
+	for (jj_ = 0; jj_ < (N); jj_ += min_jj_) { \
+	  min_jj_ = (N) - jj_; \
+	  if (min_jj_ > BETA_TILE_N) min_jj_ = BETA_TILE_N; \
+	  if (BETA) BETA_OPERATION(X, ((X) + (M)), ((Y) + jj_), ((Y) + jj_ + min_jj_), BETA, C, LDC); \
+	  KERNEL_OPERATION(M, min_jj_, K, ALPHA, SA, (SB) + (K) * jj_ * COMPSIZE, C, LDC, X, (Y) + jj_); \
+	  if (LAST) EPILOGUE_OPERATION(X, ((X) + (M)), ((Y) + jj_), ((Y) + jj_ + min_jj_)); \
+	} \
+}
+#endif
+
+/* Pre-packed operands (see interface/gemm_pack.c) are stored as a series
+   of GEMM_Q deep K blocks, each holding the whole M (or N) extent in the
+   layout the copy routines produce; LDA/LDB hold the padded extent. */
+#ifdef PACKED_A
+#ifndef ICOPY_OPERATION
+#define ICOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER) \
+	BUFFER = (FLOAT *)(A) + ((X) * (LDA) + (Y) * (M)) * COMPSIZE;
+#endif
+#endif
+
+#ifdef PACKED_B
+#undef FUSED_GEMM
+#ifndef OCOPY_OPERATION
+#define OCOPY_OPERATION(M, N, A, LDA, X, Y, BUFFER)
+#endif
+#endif
+
 #ifndef ICOPY_OPERATION
 #if defined(NN) || defined(NT) || defined(NC) || defined(NR) || \
     defined(RN) || defined(RT) || defined(RC) || defined(RR)
@@ -182,11 +283,16 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   BLASLONG jjs, min_jj;
 #endif
 
-  BLASLONG l1stride, gemm_p, l2size;
+  BLASLONG l1stride;
+#if !defined(PACKED_A) && !defined(PACKED_B)
+  BLASLONG gemm_p, l2size;
+#endif
 
 #if defined(XDOUBLE) && defined(QUAD_PRECISION)
   xidouble xalpha;
 #endif
+  FLOAT *beta_tile = NULL, *beta_l;
+  int last_l = 0;
 
 #ifdef TIMING
   unsigned long long rpcc_counter;
@@ -244,10 +350,32 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	  qtox(&xbeta, beta);
 #endif
-	  BETA_OPERATION(m_from, m_to, n_from, n_to, beta, c, ldc);
+	  beta_tile = beta;
 	}
   }
 
+  /* Without an update to fold it into, scale C right away */
+  if (beta_tile) {
+#ifdef GEMM_BETA_TILES
+    if ((k == 0) || (alpha == NULL) || ((alpha[0] == ZERO)
+#ifdef COMPLEX
+	&& (alpha[1] == ZERO)
+#endif
+	))
+#endif
+    {
+      BETA_OPERATION(m_from, m_to, n_from, n_to, beta, c, ldc);
+      beta_tile = NULL;
+    }
+  }
+
+#ifdef GEMM_EPILOGUE
+  if ((k == 0) || (alpha == NULL) || (alpha[0] == ZERO)) {
+    EPILOGUE_OPERATION(m_from, m_to, n_from, n_to);
+    return 0;
+  }
+#endif
+
   if ((k == 0) || (alpha == NULL)) return 0;
 
 #if !defined(XDOUBLE) || !defined(QUAD_PRECISION)
@@ -268,7 +396,9 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   qtox(&xalpha, alpha);
 #endif
 
+#if !defined(PACKED_A) && !defined(PACKED_B)
   l2size = GEMM_P * GEMM_Q;
+#endif
 
 #if 0
   fprintf(stderr, "GEMM(Single): M_from : %ld  M_to : %ld  N_from : %ld  N_to : %ld  k : %ld\n", m_from, m_to, n_from, n_to, k);
@@ -284,15 +414,22 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   kernelcost = 0;
 #endif
 
-  for(js = n_from; js < n_to; js += GEMM_R){
+  for(js = n_from; js < n_to; js += min_j){
     min_j = n_to - js;
+#ifndef PACKED_B
     if (min_j > GEMM_R) min_j = GEMM_R;
+#endif
 
     for(ls = 0; ls < k; ls += min_l){
 
       min_l = k - ls;
 
-      if (min_l >= GEMM_Q * 2) {
+#if defined(PACKED_A) || defined(PACKED_B)
+      if (min_l > GEMM_Q) min_l = GEMM_Q;
+#else
+      if (openblas_reproducible()) {
+	if (min_l > GEMM_REPRO_Q) min_l = GEMM_REPRO_Q;
+      } else if (min_l >= GEMM_Q * 2) {
 	// gemm_p = GEMM_P;
 	min_l  = GEMM_Q;
       } else {
@@ -302,6 +439,13 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	gemm_p = ((l2size / min_l + GEMM_UNROLL_M - 1)/GEMM_UNROLL_M) * GEMM_UNROLL_M;
 	while (gemm_p * min_l > l2size) gemm_p -= GEMM_UNROLL_M;
       }
+#endif
+
+      /* beta goes with the first K panel, the epilogue with the last */
+      beta_l = (ls == 0) ? beta_tile : (FLOAT *)NULL;
+#ifdef GEMM_EPILOGUE
+      last_l = (ls + min_l >= k);
+#endif
 
       /* First, we have to move data A to L2 cache */
       min_i = m_to - m_from;
@@ -317,6 +461,11 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	}
       }
 
+#ifdef PACKED_B
+      l1stride = 1;
+      sb = (XFLOAT *)b + (ls * ldb + js * min_l) * COMPSIZE;
+#endif
+
       START_RPCC();
 
       ICOPY_OPERATION(min_l, min_i, a, lda, ls, m_from, sa);
@@ -325,9 +474,14 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 #if defined(FUSED_GEMM) && !defined(TIMING)
 
+      if (beta_l)
+	BETA_OPERATION(m_from, m_from + min_i, js, js + min_j, beta_l, c, ldc);
+
       FUSED_KERNEL_OPERATION(min_i, min_j, min_l, alpha,
 			     sa, sb, b, ldb, c, ldc, m_from, js, ls);
 
+      if (last_l) EPILOGUE_OPERATION(m_from, m_from + min_i, js, js + min_j);
+
 
 #else
       for(jjs = js; jjs < js + min_j; jjs += min_jj){
@@ -350,6 +504,9 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
 	START_RPCC();
 
+	if (beta_l)
+	  BETA_OPERATION(m_from, m_from + min_i, jjs, jjs + min_jj, beta_l, c, ldc);
+
 #if !defined(XDOUBLE)  || !defined(QUAD_PRECISION)
 	KERNEL_OPERATION(min_i, min_jj, min_l, alpha,
 			 sa, sb + min_l * (jjs - js)  * COMPSIZE * l1stride, c, ldc, m_from, jjs);
@@ -358,6 +515,8 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 			 sa, sb + min_l * (jjs - js)  * COMPSIZE * l1stride, c, ldc, m_from, jjs);
 #endif
 
+	if (last_l) EPILOGUE_OPERATION(m_from, m_from + min_i, jjs, jjs + min_jj);
+
 	STOP_RPCC(kernelcost);
       }
 #endif
@@ -381,7 +540,10 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 	START_RPCC();
 
 #if !defined(XDOUBLE)  || !defined(QUAD_PRECISION)
-	KERNEL_OPERATION(min_i, min_j, min_l, alpha, sa, sb, c, ldc, is, js);
+	if (beta_l || last_l)
+	  KERNEL_TILE_OPERATION(min_i, min_j, min_l, alpha, sa, sb, c, ldc, is, js, beta_l, last_l)
+	else
+	  KERNEL_OPERATION(min_i, min_j, min_l, alpha, sa, sb, c, ldc, is, js);
 #else
 	KERNEL_OPERATION(min_i, min_j, min_l, (void *)&xalpha, sa, sb, c, ldc, is, js);
 #endif
@@ -48,6 +48,26 @@
 #define SWITCH_RATIO 2
 #endif
 
+/* A tuning profile may override SWITCH_RATIO per precision */
+#ifndef XDOUBLE
+#ifndef COMPLEX
+#ifdef DOUBLE
+#define SWITCH_PRECISION 1
+#else
+#define SWITCH_PRECISION 0
+#endif
+#else
+#ifdef DOUBLE
+#define SWITCH_PRECISION 3
+#else
+#define SWITCH_PRECISION 2
+#endif
+#endif
+#define GEMM_SWITCH_RATIO (blas_switch_ratio[SWITCH_PRECISION] > 0 ? blas_switch_ratio[SWITCH_PRECISION] : SWITCH_RATIO)
+#else
+#define GEMM_SWITCH_RATIO SWITCH_RATIO
+#endif
+
 #ifndef GEMM_PREFERED_SIZE
 #define GEMM_PREFERED_SIZE 1
 #endif
@@ -59,6 +79,8 @@
 #endif
 
 #ifndef GEMM_LOCAL
+/* Plain GEMM only : the K-split offsets assume general A and B */
+#define GEMM_K_SPLIT
 #if   defined(NN)
 #define GEMM_LOCAL    GEMM_NN
 #elif defined(NT)
@@ -94,6 +116,20 @@
 #endif
 #endif
 
+#if defined(NN) || defined(NT) || defined(NC) || defined(NR) || \
+  defined(RN) || defined(RT) || defined(RC) || defined(RR)
+#define A_OFFSET(M, K, LDA)	((M) + (K) * (LDA))
+#else
+#define A_OFFSET(M, K, LDA)	((K) + (M) * (LDA))
+#endif
+
+#if defined(NN) || defined(TN) || defined(CN) || defined(RN) || \
+  defined(NR) || defined(TR) || defined(CR) || defined(RR)
+#define B_OFFSET(K, N, LDB)	((K) + (N) * (LDB))
+#else
+#define B_OFFSET(K, N, LDB)	((N) + (K) * (LDB))
+#endif
+
 typedef struct {
   volatile
    BLASLONG working[MAX_CPU_NUMBER][CACHE_LINE_SIZE * DIVIDE_RATE];
@@ -114,6 +150,12 @@ typedef struct {
 #endif
 #endif
 
+/* Columns of C scaled by beta just ahead of a wide kernel call on the
+   first K panel (see inner_thread) */
+#ifndef BETA_TILE_N
+#define BETA_TILE_N (GEMM_UNROLL_N * 4)
+#endif
+
 #ifndef ICOPY_OPERATION
 #if defined(NN) || defined(NT) || defined(NC) || defined(NR) || \
   defined(RN) || defined(RT) || defined(RC) || defined(RR)
@@ -183,6 +225,17 @@ typedef struct {
 #endif
 #endif
 
+#ifndef KERNEL_BETA_OPERATION
+#define KERNEL_BETA_OPERATION(M, N, K, ALPHA, SA, SB, C, LDC, X, Y, BETA) { \
+    BLASLONG jj_, min_jj_;                                              \
+    for (jj_ = 0; jj_ < (N); jj_ += min_jj_) {                          \
+      min_jj_ = MIN((N) - jj_, BETA_TILE_N);                            \
+      BETA_OPERATION(X, ((X) + (M)), ((Y) + jj_), ((Y) + jj_ + min_jj_), BETA, C, LDC); \
+      KERNEL_OPERATION(M, min_jj_, K, ALPHA, SA, (SB) + (K) * jj_ * COMPSIZE, C, LDC, X, (Y) + jj_); \
+    }                                                                   \
+  }
+#endif
+
 #ifndef A
 #define A	args -> a
 #endif
@@ -226,7 +279,7 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
   BLASLONG k, lda, ldb, ldc;
   BLASLONG m_from, m_to, n_from, n_to;
 
-  FLOAT *alpha, *beta;
+  FLOAT *alpha, *beta, *beta_tile = NULL;
   FLOAT *a, *b, *c;
   job_t *job = (job_t *)args -> common;
 
@@ -288,14 +341,24 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
     n_to   = range_n[mypos + 1];
   }
 
-  /* Multiply C by beta if needed */
+  /* Multiply C by beta if needed. When there is an update to follow,
+   * each tile of C is scaled on the first K panel right before the
+   * kernel first touches it instead of in a separate pass over C. */
   if (beta) {
 #ifndef COMPLEX
     if (beta[0] != ONE)
 #else
     if ((beta[0] != ONE) || (beta[1] != ZERO))
 #endif
-      BETA_OPERATION(m_from, m_to, range_n[mypos_n * nthreads_m], range_n[(mypos_n + 1) * nthreads_m], beta, c, ldc);
+      beta_tile = beta;
+  }
+  if (beta_tile && ((k == 0) || (alpha == NULL) || ((alpha[0] == ZERO)
+#ifdef COMPLEX
+                                                     && (alpha[1] == ZERO)
+#endif
+                                                     ))) {
+    BETA_OPERATION(m_from, m_to, range_n[mypos_n * nthreads_m], range_n[(mypos_n + 1) * nthreads_m], beta, c, ldc);
+    beta_tile = NULL;
   }
 
   /* Return early if no more computation is needed */
@@ -318,7 +381,9 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
     /* Determine step size in k */
     min_l = k - ls;
-    if (min_l >= GEMM_Q * 2) {
+    if (openblas_reproducible()) {
+      if (min_l > GEMM_REPRO_Q) min_l = GEMM_REPRO_Q;
+    } else if (min_l >= GEMM_Q * 2) {
       min_l  = GEMM_Q;
     } else {
       if (min_l > GEMM_Q) min_l = (min_l + 1) / 2;
@@ -357,6 +422,8 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 #if defined(FUSED_GEMM) && !defined(TIMING)
 
       /* Fused operation to copy region of B into workspace and apply kernel */
+      if (beta_tile && (ls == 0))
+        BETA_OPERATION(m_from, m_from + min_i, js, MIN(n_to, js + div_n), beta_tile, c, ldc);
       FUSED_KERNEL_OPERATION(min_i, MIN(n_to, js + div_n) - js, min_l, alpha,
 			     sa, buffer[bufferside], b, ldb, c, ldc, m_from, js, ls);
 
@@ -379,6 +446,8 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
         /* Apply kernel with local region of A and part of local region of B */
 	START_RPCC();
+	if (beta_tile && (ls == 0))
+	  BETA_OPERATION(m_from, m_from + min_i, jjs, jjs + min_jj, beta_tile, c, ldc);
 	KERNEL_OPERATION(min_i, min_jj, min_l, alpha,
 			 sa, buffer[bufferside] + min_l * (jjs - js) * COMPSIZE * l1stride,
 			 c, ldc, m_from, jjs);
@@ -418,9 +487,14 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
           /* Apply kernel with local region of A and part of other region of B */
 	  START_RPCC();
-	  KERNEL_OPERATION(min_i, MIN(range_n[current + 1]  - js,  div_n), min_l, alpha,
-			   sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
-			   c, ldc, m_from, js);
+	  if (beta_tile && (ls == 0))
+	    KERNEL_BETA_OPERATION(min_i, MIN(range_n[current + 1]  - js,  div_n), min_l, alpha,
+				  sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+				  c, ldc, m_from, js, beta_tile)
+	  else
+	    KERNEL_OPERATION(min_i, MIN(range_n[current + 1]  - js,  div_n), min_l, alpha,
+			     sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+			     c, ldc, m_from, js);
           STOP_RPCC(kernel);
 
 #ifdef TIMING
@@ -462,9 +536,14 @@ static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
 
           /* Apply kernel with local region of A and part of region of B */
 	  START_RPCC();
-	  KERNEL_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), min_l, alpha,
-			   sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
-			   c, ldc, is, js);
+	  if (beta_tile && (ls == 0))
+	    KERNEL_BETA_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), min_l, alpha,
+				  sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+				  c, ldc, is, js, beta_tile)
+	  else
+	    KERNEL_OPERATION(min_i, MIN(range_n[current + 1] - js, div_n), min_l, alpha,
+			     sa, (FLOAT *)job[current].working[mypos][CACHE_LINE_SIZE * bufferside],
+			     c, ldc, is, js);
           STOP_RPCC(kernel);
           
 #ifdef TIMING
@@ -526,7 +605,7 @@ static int round_up(int remainder, int width, int multiple)
 
 static int gemm_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG
 		       *range_n, FLOAT *sa, FLOAT *sb,
-                       BLASLONG nthreads_m, BLASLONG nthreads_n) {
+                       BLASLONG nthreads_m, BLASLONG nthreads_n, int node_local) {
 
 #ifndef USE_OPENMP
 #ifndef OS_WINDOWS
@@ -557,6 +636,13 @@ InitializeCriticalSection((PCRITICAL_SECTION)&level3_lock);
   BLASLONG width, i, j, k, js;
   BLASLONG m, n, n_from, n_to;
   int mode;
+#if !defined(USE_OPENMP) && !defined(OS_WINDOWS)
+  /* A context holding its pool threads alone (openblas_context_set_cpus */
+  /* on a set no one else holds, or openblas_queue_create) cannot collide */
+  /* with other such calls, so it skips the global lock                  */
+  blas_context_t *ctx = blas_get_context();
+  int serialize = (ctx == NULL) || !(ctx -> reserved);
+#endif
 
   /* Get execution mode */
 #ifndef COMPLEX
@@ -579,7 +665,7 @@ InitializeCriticalSection((PCRITICAL_SECTION)&level3_lock);
 
 #ifndef USE_OPENMP
 #ifndef OS_WINDOWS
-pthread_mutex_lock(&level3_lock);
+if (serialize) pthread_mutex_lock(&level3_lock);
 #else
 EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
 #endif
@@ -656,6 +742,11 @@ EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
     queue[i].sa      = NULL;
     queue[i].sb      = NULL;
     queue[i].next    = &queue[i + 1];
+    if (node_local) {
+      /* Threads sharing B panels (same mypos_n) go to the same node */
+      queue[i].mode |= BLAS_NODE_HINT;
+      queue[i].node  = i / nthreads_m;
+    }
   }
   queue[0].sa = sa;
   queue[0].sb = sb;
@@ -678,8 +769,8 @@ EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
     num_parts  = 0;
     while (n > 0){
       width = blas_quickdivide(n + nthreads - num_parts - 1, nthreads - num_parts);
-      if (width < SWITCH_RATIO) {
-        width = SWITCH_RATIO;
+      if (width < GEMM_SWITCH_RATIO) {
+        width = GEMM_SWITCH_RATIO;
       }
       width = round_up(n, width, GEMM_PREFERED_SIZE);
 
@@ -712,7 +803,7 @@ EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
 
 #ifndef USE_OPENMP
 #ifndef OS_WINDOWS
-  pthread_mutex_unlock(&level3_lock);
+  if (serialize) pthread_mutex_unlock(&level3_lock);
 #else
   LeaveCriticalSection((PCRITICAL_SECTION)&level3_lock);
 #endif
@@ -721,11 +812,257 @@ EnterCriticalSection((PCRITICAL_SECTION)&level3_lock);
   return 0;
 }
 
+#ifdef USE_WORK_STEALING
+/* Work-stealing variant : the product is cut into tiles_m x tiles_n  */
+/* independent tiles, each computed by the serial driver, which idle */
+/* threads steal from busy ones instead of waiting on them.  Every   */
+/* tile packs its own B, so this only pays off when the threads run  */
+/* at uneven speeds; it is used only when switched on at runtime.    */
+static int gemm_steal_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			     FLOAT *sa, FLOAT *sb, BLASLONG tiles_m, BLASLONG tiles_n){
+
+  blas_queue_t queue[MAX_BLAS_TILES];
+  BLASLONG range_M[MAX_BLAS_TILES + 1];
+  BLASLONG range_N[MAX_BLAS_TILES + 1];
+  BLASLONG parts_m, parts_n, width, m, n, i, j, k;
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  if (!range_m) {
+    range_M[0] = 0;
+    m          = args -> m;
+  } else {
+    range_M[0] = range_m[0];
+    m          = range_m[1] - range_m[0];
+  }
+
+  if (!range_n) {
+    range_N[0] = 0;
+    n          = args -> n;
+  } else {
+    range_N[0] = range_n[0];
+    n          = range_n[1] - range_n[0];
+  }
+
+  /* Tile boundaries stay on unroll multiples of the kernel */
+  parts_m = 0;
+  while (m > 0){
+    width = blas_quickdivide(m + tiles_m - parts_m - 1, tiles_m - parts_m);
+    width = round_up(m, width, GEMM_UNROLL_M);
+    if (width > m) width = m;
+    m -= width;
+    range_M[parts_m + 1] = range_M[parts_m] + width;
+    parts_m ++;
+  }
+
+  parts_n = 0;
+  while (n > 0){
+    width = blas_quickdivide(n + tiles_n - parts_n - 1, tiles_n - parts_n);
+    width = round_up(n, width, GEMM_UNROLL_N);
+    if (width > n) width = n;
+    n -= width;
+    range_N[parts_n + 1] = range_N[parts_n] + width;
+    parts_n ++;
+  }
+
+  k = 0;
+  for (j = 0; j < parts_n; j++) {
+    for (i = 0; i < parts_m; i++) {
+      queue[k].mode    = mode;
+      queue[k].routine = GEMM_LOCAL;
+      queue[k].args    = args;
+      queue[k].range_m = &range_M[i];
+      queue[k].range_n = &range_N[j];
+      queue[k].sa      = NULL;
+      queue[k].sb      = NULL;
+      queue[k].next    = &queue[k + 1];
+      k ++;
+    }
+  }
+
+  if (k) {
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[k - 1].next = NULL;
+
+    exec_blas_steal(k, queue, args -> nthreads);
+  }
+
+  return 0;
+}
+#endif
+
+#ifdef GEMM_K_SPLIT
+/* K-split variant for a small C and a long K : thread i computes the */
+/* product over its own slice of K, thread 0 straight into C with the */
+/* caller's beta and the others into private m x n buffers, which are */
+/* then added to C by all threads, each owning a range of columns.    */
+
+static int ksplit_reduce(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			 FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  FLOAT *buffer = (FLOAT *)args -> a;
+  FLOAT *c      = (FLOAT *)args -> c;
+  BLASLONG m = args -> m, ldc = args -> ldc, size = args -> lda;
+  BLASLONG i, j;
+
+  for (j = range_n[0]; j < range_n[1]; j++) {
+    for (i = 0; i < args -> k; i++) {
+      AXPYU_K(m, 0, 0, ONE,
+#ifdef COMPLEX
+	      ZERO,
+#endif
+	      buffer + (i * size + j * m) * COMPSIZE, 1, c + j * ldc * COMPSIZE, 1, NULL, 0);
+    }
+  }
+
+  return 0;
+}
+
+static int gemm_ksplit_driver(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			      FLOAT *sa, FLOAT *sb, BLASLONG nthreads){
+
+  static FLOAT zero[2] = {ZERO, ZERO};
+
+  blas_arg_t *newarg, reduce;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range_N[MAX_CPU_NUMBER + 1];
+  BLASLONG m_from, n_from, m, n, k, k_from, width, i;
+  FLOAT *buffer;
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  m_from = 0;
+  m      = args -> m;
+  if (range_m) {
+    m_from = range_m[0];
+    m      = range_m[1] - range_m[0];
+  }
+
+  n_from = 0;
+  n      = args -> n;
+  if (range_n) {
+    n_from = range_n[0];
+    n      = range_n[1] - range_n[0];
+  }
+
+  newarg = (blas_arg_t *)malloc(nthreads * sizeof(blas_arg_t)
+				+ (nthreads - 1) * m * n * COMPSIZE * sizeof(FLOAT));
+  if (newarg == NULL) return -1;
+  buffer = (FLOAT *)(newarg + nthreads);
+
+  /* Partial products over even slices of K */
+  k_from = 0;
+  k      = args -> k;
+  for (i = 0; i < nthreads; i++) {
+    width = blas_quickdivide(k + nthreads - i - 1, nthreads - i);
+
+    newarg[i]       = *args;
+    newarg[i].m     = m;
+    newarg[i].n     = n;
+    newarg[i].k     = width;
+    newarg[i].a     = (FLOAT *)args -> a + A_OFFSET(m_from, k_from, args -> lda) * COMPSIZE;
+    newarg[i].b     = (FLOAT *)args -> b + B_OFFSET(k_from, n_from, args -> ldb) * COMPSIZE;
+    newarg[i].nthreads = 1;
+
+    if (i == 0) {
+      newarg[i].c   = (FLOAT *)args -> c + (m_from + n_from * args -> ldc) * COMPSIZE;
+    } else {
+      newarg[i].c   = buffer + (i - 1) * m * n * COMPSIZE;
+      newarg[i].ldc = m;
+      newarg[i].beta = zero;
+    }
+
+    queue[i].mode    = mode;
+    queue[i].routine = GEMM_LOCAL;
+    queue[i].args    = &newarg[i];
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+
+    k_from += width;
+    k      -= width;
+  }
+
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  /* Reduction of the partial products, by ranges of columns */
+  reduce.a   = buffer;
+  reduce.c   = newarg[0].c;
+  reduce.m   = m;
+  reduce.k   = nthreads - 1;
+  reduce.lda = m * n;
+  reduce.ldc = args -> ldc;
+
+  range_N[0] = 0;
+  for (i = 0; i < nthreads; i++) {
+    width = blas_quickdivide(n - range_N[i] + nthreads - i - 1, nthreads - i);
+    range_N[i + 1] = range_N[i] + width;
+
+    queue[i].routine = ksplit_reduce;
+    queue[i].args    = &reduce;
+    queue[i].range_n = &range_N[i];
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+  }
+
+  exec_blas(nthreads, queue);
+
+  free(newarg);
+
+  return 0;
+}
+#endif
+
 int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
 
   BLASLONG m = args -> m;
   BLASLONG n = args -> n;
   BLASLONG nthreads_m, nthreads_n;
+  BLASLONG switch_ratio = GEMM_SWITCH_RATIO;
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(USE_OPENMP)
+  BLASLONG nodes;
+#endif
 
   /* Get dimensions from index ranges if available */
   if (range_m) {
@@ -736,31 +1073,75 @@ int CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLO
   }
 
   /* Partitions in m should have at least SWITCH_RATIO rows */
-  if (m < 2 * SWITCH_RATIO) {
+  if (m < 2 * switch_ratio) {
     nthreads_m = 1;
   } else {
     nthreads_m = args -> nthreads;
-    while (m < nthreads_m * SWITCH_RATIO) {
+    while (m < nthreads_m * switch_ratio) {
       nthreads_m = nthreads_m / 2;
     }
   }
 
   /* Partitions in n should have at most SWITCH_RATIO * nthreads_m columns */
-  if (n < SWITCH_RATIO * nthreads_m) {
+  if (n < switch_ratio * nthreads_m) {
     nthreads_n = 1;
   } else {
-    nthreads_n = (n + SWITCH_RATIO * nthreads_m - 1) / (SWITCH_RATIO * nthreads_m);
+    nthreads_n = (n + switch_ratio * nthreads_m - 1) / (switch_ratio * nthreads_m);
     if (nthreads_m * nthreads_n > args -> nthreads) {
       nthreads_n = blas_quickdivide(args -> nthreads, nthreads_m);
     }
   }
 
+#ifdef GEMM_K_SPLIT
+  /* An m x n split that leaves threads idle while K is long : slice */
+  /* K instead, each slice at least GEMM_Q deep and K well above m, n */
+  if ((nthreads_m * nthreads_n < args -> nthreads) && (args -> k >= 8 * MAX(m, n)) &&
+      !openblas_reproducible()) {
+    BLASLONG nthreads_k = MIN(args -> nthreads, args -> k / GEMM_Q);
+
+    if ((nthreads_k > nthreads_m * nthreads_n) &&
+	!gemm_ksplit_driver(args, range_m, range_n, sa, sb, nthreads_k)) return 0;
+  }
+#endif
+
+#if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(USE_OPENMP)
+  /* Node-local layout : one group of threads per node, so packed B  */
+  /* panels are only shared inside a node and every node owns its own */
+  /* column slab of C, which its threads scale (first touch) and update */
+  /* A setting above 1 asks for that many groups whatever the topology */
+  if (openblas_numa_level3() && (args -> nthreads > 1)) {
+    nodes = (openblas_numa_level3() > 1) ? openblas_numa_level3() : get_num_nodes();
+    if ((nodes > 1) && (args -> nthreads >= nodes) && (n >= nodes * switch_ratio)) {
+      nthreads_n = nodes;
+      nthreads_m = args -> nthreads / nodes;
+      while ((nthreads_m > 1) && (m < nthreads_m * switch_ratio)) nthreads_m /= 2;
+
+      args -> nthreads = nthreads_m * nthreads_n;
+      gemm_driver(args, range_m, range_n, sa, sb, nthreads_m, nthreads_n, 1);
+      return 0;
+    }
+  }
+#endif
+
+#ifdef USE_WORK_STEALING
+  if ((nthreads_m * nthreads_n > 1) && openblas_work_stealing()) {
+    /* refine the longer dimension into stealable tiles */
+    args -> nthreads = nthreads_m * nthreads_n;
+    if (n >= m) {
+      gemm_steal_driver(args, range_m, range_n, sa, sb, nthreads_m, nthreads_n * BLAS_STEAL_TILES);
+    } else {
+      gemm_steal_driver(args, range_m, range_n, sa, sb, nthreads_m * BLAS_STEAL_TILES, nthreads_n);
+    }
+    return 0;
+  }
+#endif
+
   /* Execute serial or parallel computation */
   if (nthreads_m * nthreads_n <= 1) {
     GEMM_LOCAL(args, range_m, range_n, sa, sb, 0);
   } else {
     args -> nthreads = nthreads_m * nthreads_n;
-    gemm_driver(args, range_m, range_n, sa, sb, nthreads_m, nthreads_n);
+    gemm_driver(args, range_m, range_n, sa, sb, nthreads_m, nthreads_n, 0);
   }
 
   return 0;
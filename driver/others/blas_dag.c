@@ -0,0 +1,377 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdlib.h>
+#include "common.h"
+
+/* Task DAG over tiles.  The caller inserts the tasks of an algorithm */
+/* in a valid sequential order, naming the tiles each one reads and   */
+/* writes; every task then depends on the last writer of what it     */
+/* touches, and a writer also on the readers since that write.  The   */
+/* pool threads take ready tasks from one priority queue, so a panel  */
+/* runs as soon as its inputs are done instead of at a fork-join      */
+/* step, and the updates fill the idle threads around it.             */
+
+typedef struct {
+  blas_task_t routine;
+  BLASLONG i, j, k;
+  BLASLONG priority;
+  BLASLONG deps;			/* unfinished predecessors */
+  BLASLONG succ;			/* first successor link, -1 */
+} task_t;
+
+typedef struct {
+  BLASLONG task, next;
+} link_t;
+
+typedef struct {
+  BLASLONG writer;			/* last task writing the tile, -1 */
+  BLASLONG readers;			/* readers since, as links, -1 */
+} tile_t;
+
+struct blas_dag {
+  void *ctx;
+
+  task_t *task;
+  BLASLONG ntasks, maxtasks;
+
+  link_t *link;
+  BLASLONG nlinks, maxlinks;
+
+  tile_t *tile;
+  BLASLONG ntiles;
+
+  /* execution : a binary heap of ready tasks under one lock */
+  BLASLONG *ready;
+  volatile BLASLONG nready;
+  volatile BLASLONG done;
+  volatile BLASULONG lock;
+};
+
+blas_dag_t *blas_dag_create(void *ctx, BLASLONG ntiles){
+
+  blas_dag_t *dag;
+  BLASLONG i;
+
+  dag = (blas_dag_t *)calloc(1, sizeof(blas_dag_t));
+  if (dag == NULL) return NULL;
+
+  dag -> ctx    = ctx;
+  dag -> ntiles = ntiles;
+  dag -> tile   = (tile_t *)malloc(MAX(ntiles, 1) * sizeof(tile_t));
+
+  if (dag -> tile == NULL) {
+    free(dag);
+    return NULL;
+  }
+
+  for (i = 0; i < ntiles; i++) {
+    dag -> tile[i].writer  = -1;
+    dag -> tile[i].readers = -1;
+  }
+
+  return dag;
+}
+
+void blas_dag_destroy(blas_dag_t *dag){
+
+  if (dag == NULL) return;
+
+  free(dag -> ready);
+  free(dag -> link);
+  free(dag -> task);
+  free(dag -> tile);
+  free(dag);
+}
+
+static BLASLONG new_link(blas_dag_t *dag, BLASLONG task, BLASLONG next){
+
+  link_t *link;
+
+  if (dag -> nlinks == dag -> maxlinks) {
+    link = (link_t *)realloc(dag -> link, (dag -> maxlinks * 2 + 1024) * sizeof(link_t));
+    if (link == NULL) return -1;
+    dag -> link      = link;
+    dag -> maxlinks  = dag -> maxlinks * 2 + 1024;
+  }
+
+  dag -> link[dag -> nlinks].task = task;
+  dag -> link[dag -> nlinks].next = next;
+
+  return dag -> nlinks ++;
+}
+
+/* from runs before to; the edges of one new task are added together, */
+/* so a duplicate is always at the head of the successor list         */
+static int add_edge(blas_dag_t *dag, BLASLONG from, BLASLONG to){
+
+  task_t *task = &dag -> task[from];
+  BLASLONG l;
+
+  if ((from < 0) || (from == to)) return 0;
+  if ((task -> succ >= 0) && (dag -> link[task -> succ].task == to)) return 0;
+
+  l = new_link(dag, to, task -> succ);
+  if (l < 0) return -1;
+
+  /* the link array may have moved, the task array has not */
+  task -> succ = l;
+  dag -> task[to].deps ++;
+
+  return 0;
+}
+
+/* in are the tiles the task only reads, inout those it writes.  A     */
+/* nonzero return means memory ran out and the DAG must be discarded. */
+int blas_dag_insert(blas_dag_t *dag, blas_task_t routine, BLASLONG i, BLASLONG j, BLASLONG k,
+		    BLASLONG priority, const BLASLONG *in, BLASLONG nin, const BLASLONG *inout, BLASLONG ninout){
+
+  task_t *task;
+  tile_t *tile;
+  BLASLONG t, n, l;
+
+  if (dag -> ntasks == dag -> maxtasks) {
+    task = (task_t *)realloc(dag -> task, (dag -> maxtasks * 2 + 256) * sizeof(task_t));
+    if (task == NULL) return -1;
+    dag -> task     = task;
+    dag -> maxtasks = dag -> maxtasks * 2 + 256;
+  }
+
+  t    = dag -> ntasks;
+  task = &dag -> task[t];
+
+  task -> routine  = routine;
+  task -> i        = i;
+  task -> j        = j;
+  task -> k        = k;
+  task -> priority = priority;
+  task -> deps     = 0;
+  task -> succ     = -1;
+
+  dag -> ntasks ++;
+
+  for (n = 0; n < nin; n++) {
+    tile = &dag -> tile[in[n]];
+
+    if (add_edge(dag, tile -> writer, t)) return -1;
+
+    l = new_link(dag, t, tile -> readers);
+    if (l < 0) return -1;
+    tile -> readers = l;
+  }
+
+  for (n = 0; n < ninout; n++) {
+    tile = &dag -> tile[inout[n]];
+
+    if (add_edge(dag, tile -> writer, t)) return -1;
+
+    for (l = tile -> readers; l >= 0; l = dag -> link[l].next)
+      if (add_edge(dag, dag -> link[l].task, t)) return -1;
+
+    tile -> writer  = t;
+    tile -> readers = -1;
+  }
+
+  return 0;
+}
+
+/* Higher priority first, then insertion order */
+static __inline int before(blas_dag_t *dag, BLASLONG a, BLASLONG b){
+
+  if (dag -> task[a].priority != dag -> task[b].priority)
+    return dag -> task[a].priority > dag -> task[b].priority;
+
+  return a < b;
+}
+
+static void push_ready(blas_dag_t *dag, BLASLONG t){
+
+  BLASLONG *heap = dag -> ready;
+  BLASLONG pos, parent;
+
+  pos = dag -> nready ++;
+
+  while (pos > 0) {
+    parent = (pos - 1) / 2;
+    if (!before(dag, t, heap[parent])) break;
+    heap[pos] = heap[parent];
+    pos = parent;
+  }
+
+  heap[pos] = t;
+}
+
+static BLASLONG pop_ready(blas_dag_t *dag){
+
+  BLASLONG *heap = dag -> ready;
+  BLASLONG top, last, n, pos, child;
+
+  top  = heap[0];
+  n    = -- dag -> nready;
+  last = heap[n];
+  pos  = 0;
+
+  while ((child = 2 * pos + 1) < n) {
+    if ((child + 1 < n) && before(dag, heap[child + 1], heap[child])) child ++;
+    if (!before(dag, heap[child], last)) break;
+    heap[pos] = heap[child];
+    pos = child;
+  }
+
+  heap[pos] = last;
+
+  return top;
+}
+
+static int dag_worker(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+		      void *sa, void *sb, BLASLONG myid){
+
+  blas_dag_t *dag = (blas_dag_t *)args;
+  task_t *task;
+  BLASLONG t, l, s;
+
+  while (1) {
+
+    while ((dag -> nready == 0) && (dag -> done < dag -> ntasks)) {
+      YIELDING;
+    }
+
+    blas_lock(&dag -> lock);
+
+    if (dag -> done == dag -> ntasks) {
+      blas_unlock(&dag -> lock);
+      break;
+    }
+
+    if (dag -> nready == 0) {
+      blas_unlock(&dag -> lock);
+      continue;
+    }
+
+    t = pop_ready(dag);
+    blas_unlock(&dag -> lock);
+
+    task = &dag -> task[t];
+    (task -> routine)(dag -> ctx, task -> i, task -> j, task -> k, sa, sb);
+
+    blas_lock(&dag -> lock);
+    for (l = task -> succ; l >= 0; l = dag -> link[l].next) {
+      s = dag -> link[l].task;
+      if (-- dag -> task[s].deps == 0) push_ready(dag, s);
+    }
+    dag -> done ++;
+    blas_unlock(&dag -> lock);
+  }
+
+  return 0;
+}
+
+/* Runs the tasks on nthreads threads, the caller being one of them  */
+/* with its buffers sa and sb.  mode gives the precision for the     */
+/* buffers of the pool threads.                                      */
+int blas_dag_execute(blas_dag_t *dag, int mode, BLASLONG nthreads, void *sa, void *sb){
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG t, i;
+
+  if (dag -> ntasks == 0) return 0;
+
+  dag -> ready = (BLASLONG *)malloc(dag -> ntasks * sizeof(BLASLONG));
+  if (dag -> ready == NULL) return -1;
+
+  dag -> nready = 0;
+  dag -> done   = 0;
+  dag -> lock   = 0;
+
+  for (t = 0; t < dag -> ntasks; t++)
+    if (dag -> task[t].deps == 0) push_ready(dag, t);
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+  if (nthreads > dag -> ntasks)  nthreads = dag -> ntasks;
+
+  for (i = 0; i < nthreads; i++) {
+    queue[i].mode    = mode;
+    queue[i].routine = (void *)dag_worker;
+    queue[i].args    = (blas_arg_t *)dag;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].sa      = NULL;
+    queue[i].sb      = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  return 0;
+}
+
+/* Tile order for an n x n problem : start from nb, halve it while    */
+/* there are fewer than four tiles per thread (tiles^dims of them for */
+/* a dims-dimensional tiling), keep it a multiple of unroll, and cap  */
+/* the tiles per dimension at BLAS_DAG_MAX_TILES.                     */
+BLASLONG blas_dag_blocking(BLASLONG n, BLASLONG nb, BLASLONG unroll, int dims, BLASLONG nthreads){
+
+  BLASLONG nt, tiles;
+  int d;
+
+  if (unroll < 1) unroll = 1;
+
+  while (nb / 2 >= 4 * unroll) {
+    nt = (n + nb - 1) / nb;
+    for (tiles = 1, d = 0; d < dims; d++) tiles *= nt;
+    if (tiles >= 4 * nthreads) break;
+    nb /= 2;
+  }
+
+  nb = MAX(nb, (n + BLAS_DAG_MAX_TILES - 1) / BLAS_DAG_MAX_TILES);
+  nb = ((nb + unroll - 1) / unroll) * unroll;
+
+  return nb;
+}
+
+/* Whether an order n factorization on nthreads threads takes the */
+/* tiled path, per openblas_set_tiled_lapack                       */
+int blas_dag_use(BLASLONG n, BLASLONG nthreads){
+
+  switch (openblas_tiled_lapack()) {
+  case 0 :
+    return 0;
+  case 2 :
+    return nthreads > 1;
+  default :
+    return (nthreads >= BLAS_DAG_MIN_THREADS) && (n >= BLAS_DAG_THRESHOLD);
+  }
+}
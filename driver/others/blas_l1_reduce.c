@@ -0,0 +1,194 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <math.h>
+#include "common.h"
+
+/* Threaded level 1 reductions.  The vector is split into chunks, the */
+/* caller's chunk routine runs the kernel on each and stores a partial */
+/* result, and the partials are combined here in chunk order, so the  */
+/* result does not depend on scheduling.  Normally there is one chunk */
+/* per thread; in reproducible mode the chunks depend on n only and   */
+/* the threads take contiguous runs of them.                          */
+
+extern blas_context_t *openblas_set_context(blas_context_t *);
+
+/* Kernels that split large vectors themselves must not do so again */
+/* inside a chunk: each chunk runs under a one-thread context        */
+static blas_context_t serial_context = {1, 0};
+
+#define MAX_CHUNKS	MAX(MAX_CPU_NUMBER, BLAS_REDUCE_REPRO_CHUNKS)
+
+/* First element of chunk i of n elements split into nchunks */
+static __inline BLASLONG chunk_start(BLASLONG n, BLASLONG nchunks, BLASLONG i){
+  return (n / nchunks) * i + MIN(i, n % nchunks);
+}
+
+static int reduce_chunk(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			void *sa, void *sb, BLASLONG pos){
+
+  int (*function)(BLASLONG, void *, BLASLONG, void *, BLASLONG, blas_reduce_t *) = args -> common;
+  blas_reduce_t *partial = (blas_reduce_t *)args -> c;
+  blas_context_t *prev;
+  BLASLONG i, from, to;
+  char *x, *y;
+
+  prev = openblas_set_context(&serial_context);
+
+  /* chunks m .. n - 1 of the k elements split into ldc chunks */
+  for (i = args -> m; i < args -> n; i++) {
+    from = chunk_start(args -> k, args -> ldc, i);
+    to   = chunk_start(args -> k, args -> ldc, i + 1);
+
+    x = (char *)args -> a + from * args -> lda * args -> ldd;
+    y = (args -> b == NULL) ? NULL : (char *)args -> b + from * args -> ldb * args -> ldd;
+
+    function(to - from, x, args -> lda, y, args -> ldb, &partial[i]);
+  }
+
+  openblas_set_context(prev);
+
+  return 0;
+}
+
+int blas_level1_reduce(int mode, int op, BLASLONG n,
+		       void *x, BLASLONG incx, void *y, BLASLONG incy,
+		       int (*function)(), blas_reduce_t *result, int nthreads){
+
+  blas_queue_t  queue  [MAX_CPU_NUMBER];
+  blas_arg_t    args   [MAX_CPU_NUMBER];
+  blas_reduce_t partial[MAX_CHUNKS];
+
+  BLASLONG i, nchunks, size;
+  int num_cpu, best;
+  double scale, ssq, v;
+
+  result -> value[0] = 0.;
+  result -> value[1] = 0.;
+  result -> index    = 0;
+
+  if (n <= 0) return 0;
+
+  size = (BLASLONG)1 << ((mode & BLAS_PREC) + ((mode & BLAS_COMPLEX) != 0) + 2);
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+  if (nthreads < 1) nthreads = 1;
+
+  if (openblas_reproducible()) {
+    nchunks = (n + BLAS_REDUCE_REPRO_CHUNK - 1) / BLAS_REDUCE_REPRO_CHUNK;
+    if (nchunks > BLAS_REDUCE_REPRO_CHUNKS) nchunks = BLAS_REDUCE_REPRO_CHUNKS;
+  } else {
+    nchunks = nthreads;
+  }
+  if (nchunks > n) nchunks = n;
+  if (nthreads > nchunks) nthreads = nchunks;
+
+  for (i = 0; i < nchunks; i++) {
+    partial[i].value[0] = 0.;
+    partial[i].value[1] = 0.;
+    partial[i].index    = 0;
+  }
+
+  for (num_cpu = 0; num_cpu < nthreads; num_cpu++) {
+
+    args[num_cpu].m      = chunk_start(nchunks, nthreads, num_cpu);
+    args[num_cpu].n      = chunk_start(nchunks, nthreads, num_cpu + 1);
+    args[num_cpu].k      = n;
+    args[num_cpu].a      = x;
+    args[num_cpu].lda    = incx;
+    args[num_cpu].b      = y;
+    args[num_cpu].ldb    = incy;
+    args[num_cpu].c      = (void *)partial;
+    args[num_cpu].ldc    = nchunks;
+    args[num_cpu].ldd    = size;
+    args[num_cpu].common = (void *)function;
+
+    blas_queue_init(&queue[num_cpu]);
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = reduce_chunk;
+    queue[num_cpu].args    = &args[num_cpu];
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+  }
+
+  queue[num_cpu - 1].next = NULL;
+
+  exec_blas(num_cpu, queue);
+
+  switch (op) {
+
+  case BLAS_REDUCE_SUM :
+    for (i = 0; i < nchunks; i++) {
+      result -> value[0] += partial[i].value[0];
+      result -> value[1] += partial[i].value[1];
+    }
+    break;
+
+  case BLAS_REDUCE_MAX :
+  case BLAS_REDUCE_MIN :
+    /* the earliest chunk wins a tie, as a serial scan would */
+    best = -1;
+    for (i = 0; i < nchunks; i++) {
+      if (partial[i].index == 0) continue;
+      if ((best < 0) ||
+	  ((op == BLAS_REDUCE_MAX) && (partial[i].value[0] > partial[best].value[0])) ||
+	  ((op == BLAS_REDUCE_MIN) && (partial[i].value[0] < partial[best].value[0])))
+	best = i;
+    }
+    if (best >= 0) {
+      result -> value[0] = partial[best].value[0];
+      result -> index    = chunk_start(n, nchunks, best) + partial[best].index;
+    }
+    break;
+
+  case BLAS_REDUCE_NRM2 :
+    /* partial norms are scaled by the largest before squaring */
+    scale = 0.;
+    for (i = 0; i < nchunks; i++)
+      if (!(partial[i].value[0] <= scale)) scale = partial[i].value[0];
+
+    if (scale == 0. || isinf(scale) || isnan(scale)) {
+      result -> value[0] = scale;
+      break;
+    }
+
+    ssq = 0.;
+    for (i = 0; i < nchunks; i++) {
+      v = partial[i].value[0] / scale;
+      ssq += v * v;
+    }
+    result -> value[0] = scale * sqrt(ssq);
+    break;
+  }
+
+  return 0;
+}
@@ -75,6 +75,17 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <signal.h>
 #include <sys/resource.h>
 #include <sys/time.h>
+#include <time.h>
+#endif
+
+#if defined(USE_FUTEX) && !defined(OS_LINUX)
+#undef USE_FUTEX
+#endif
+
+#ifdef USE_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 #endif
 
 #ifndef likely
@@ -138,6 +149,16 @@ typedef struct {
   pthread_mutex_t	 lock;
   pthread_cond_t	 wakeup;
 
+#ifdef USE_FUTEX
+  /* Futex word : 0 = running, 1 = parked, 2 = woken up */
+  volatile int		 parked;
+#endif
+
+  /* Wake-up latency bookkeeping (nanoseconds) */
+  volatile unsigned long long wake_stamp;
+  unsigned long long	 wake_total;
+  unsigned long long	 wake_count;
+
 } thread_status_t;
 
 static thread_status_t thread_status[MAX_CPU_NUMBER] __attribute__((aligned(ATTRIBUTE_SIZE)));
@@ -148,6 +169,90 @@ static thread_status_t thread_status[MAX_CPU_NUMBER] __attribute__((aligned(ATTR
 
 static unsigned int thread_timeout = (1U << (THREAD_TIMEOUT));
 
+/* Bumped by openblas_park_threads() to ask idle workers to sleep now */
+static volatile int park_generation = 0;
+
+static unsigned long long wake_clock(void){
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+static void wake_account(BLASLONG cpu){
+  unsigned long long stamp = thread_status[cpu].wake_stamp;
+
+  if (stamp) {
+    thread_status[cpu].wake_total += wake_clock() - stamp;
+    thread_status[cpu].wake_count ++;
+    thread_status[cpu].wake_stamp = 0;
+  }
+}
+
+#ifdef USE_FUTEX
+
+/* Parking with futexes.  An idle worker spins for an adaptive number */
+/* of ticks and then sleeps in the kernel on its own futex word; the  */
+/* producer only enters the kernel if the worker is actually parked.  */
+
+#ifndef THREAD_SPIN_MIN
+#define THREAD_SPIN_MIN	10
+#endif
+
+#ifndef THREAD_SPIN_START
+#define THREAD_SPIN_START	16
+#endif
+
+static void futex_wait(volatile int *addr, int val){
+  syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+static void futex_wake(volatile int *addr){
+  syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static void thread_park(BLASLONG cpu, unsigned int *spin_limit){
+
+  unsigned int start = (unsigned int)rpcc();
+  int slept = 0;
+
+  thread_status[cpu].parked = 1;
+  __sync_synchronize();
+
+  while (!thread_status[cpu].queue && (thread_status[cpu].parked == 1)) {
+    futex_wait(&thread_status[cpu].parked, 1);
+    slept = 1;
+  }
+
+  if (slept && (thread_status[cpu].parked == 2)) {
+    wake_account(cpu);
+
+    /* Work that shows up shortly after parking means we gave up too early */
+    if ((unsigned int)rpcc() - start <= *spin_limit) {
+      if (*spin_limit < thread_timeout / 2) *spin_limit *= 2;
+      else *spin_limit = thread_timeout;
+    } else {
+      if (*spin_limit > (2U << THREAD_SPIN_MIN)) *spin_limit /= 2;
+      else *spin_limit = (1U << THREAD_SPIN_MIN);
+    }
+  }
+
+  thread_status[cpu].parked = 0;
+}
+
+static void thread_unpark(BLASLONG cpu){
+
+  __sync_synchronize();
+
+  if (thread_status[cpu].parked == 1) {
+    thread_status[cpu].wake_stamp = wake_clock();
+    if (__sync_bool_compare_and_swap(&thread_status[cpu].parked, 1, 2))
+      futex_wake(&thread_status[cpu].parked);
+  }
+}
+
+#endif
+
 #ifdef MONITOR
 
 /* Monitor is a function to see thread's status for every seconds. */
@@ -265,6 +370,25 @@ static void legacy_exec(void *func, int mode, blas_arg_t *args, void *sb){
 int gotoblas_set_affinity(int);
 int gotoblas_set_affinity2(int);
 int get_node(void);
+
+/* Nodes that have pool threads, the caller's node first */
+static int worker_nodes(int first, int *nodes){
+
+  int i, j, k, num = 1;
+
+  nodes[0] = first;
+
+  for (i = 0; i < blas_num_threads - 1; i++) {
+    for (j = 0; j < num; j++) if (nodes[j] == thread_status[i].node) break;
+    if (j < num) continue;
+
+    for (k = num; (k > 1) && (nodes[k - 1] > thread_status[i].node); k--) nodes[k] = nodes[k - 1];
+    nodes[k] = thread_status[i].node;
+    num ++;
+  }
+
+  return num;
+}
 #endif
 
 static int increased_threads = 0;
@@ -274,6 +398,10 @@ static void* blas_thread_server(void *arg){
   /* Thread identifier */
   BLASLONG  cpu = (BLASLONG)arg;
   unsigned int last_tick;
+  int park_seen;
+#ifdef USE_FUTEX
+  unsigned int spin_limit = (1U << THREAD_SPIN_START);
+#endif
   void *buffer, *sa, *sb;
   blas_queue_t	*queue;
 
@@ -311,6 +439,7 @@ blas_queue_t *tscq;
 #endif
 
       last_tick = (unsigned int)rpcc();
+      park_seen = park_generation;
 
 	pthread_mutex_lock  (&thread_status[cpu].lock);
         tscq=thread_status[cpu].queue;
@@ -319,7 +448,20 @@ blas_queue_t *tscq;
 	while(!tscq) {
 	YIELDING;
 
-	if ((unsigned int)rpcc() - last_tick > thread_timeout) {
+#ifdef USE_FUTEX
+	if (((unsigned int)rpcc() - last_tick > spin_limit) || (park_seen != park_generation)) {
+
+#ifdef MONITOR
+	  main_status[cpu] = MAIN_SLEEPING;
+#endif
+
+	  thread_park(cpu, &spin_limit);
+
+	  last_tick = (unsigned int)rpcc();
+	  park_seen = park_generation;
+	}
+#else
+	if (((unsigned int)rpcc() - last_tick > thread_timeout) || (park_seen != park_generation)) {
 
 	  pthread_mutex_lock  (&thread_status[cpu].lock);
 
@@ -333,12 +475,15 @@ blas_queue_t *tscq;
 
 	      pthread_cond_wait(&thread_status[cpu].wakeup, &thread_status[cpu].lock);
 	    }
+	    wake_account(cpu);
 	  }
 
 	  pthread_mutex_unlock(&thread_status[cpu].lock);
 
 	  last_tick = (unsigned int)rpcc();
+	  park_seen = park_generation;
 	}
+#endif
 	pthread_mutex_lock  (&thread_status[cpu].lock);
         tscq=thread_status[cpu].queue;
 	pthread_mutex_unlock  (&thread_status[cpu].lock);
@@ -568,6 +713,9 @@ int blas_thread_init(void){
 
       thread_status[i].queue  = (blas_queue_t *)NULL;
       thread_status[i].status = THREAD_STATUS_WAKEUP;
+#ifdef USE_FUTEX
+      thread_status[i].parked = 0;
+#endif
 
       pthread_mutex_init(&thread_status[i].lock, NULL);
       pthread_cond_init (&thread_status[i].wakeup, NULL);
@@ -628,9 +776,14 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
   BLASLONG i = 0;
   blas_queue_t *current = queue;
   blas_queue_t *tsiq,*tspq;
+  blas_context_t *ctx = blas_get_context();
+  int k = 0;
 #if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
   int node  = get_node();
   int nodes = get_num_nodes();
+  int node_list[MAX_CPU_NUMBER + 1];
+  int num_node_list = 0;
+  int target;
 #endif
 
 #ifdef SMP_DEBUG
@@ -648,11 +801,48 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
       __asm__ __volatile__ ("stmxcsr %0" : "=m" (queue -> sse_mode));
 #endif
 
+      if (ctx && (ctx -> ncpus > 0)) {
+
+	/* Only hand work to the pool threads owned by the context */
+	do {
+	  i = ctx -> cpu[k];
+	  k ++;
+	  if (k >= ctx -> ncpus) k = 0;
+
+	  tsiq = (blas_queue_t *)1;
+	  if (i < blas_num_threads - 1) {
+	    pthread_mutex_lock (&thread_status[i].lock);
+	    tsiq = thread_status[i].queue;
+	    pthread_mutex_unlock (&thread_status[i].lock);
+	  }
+	} while (tsiq);
+
+      } else {
+
 #if defined(OS_LINUX) && !defined(NO_AFFINITY) && !defined(PARAMTEST)
 
       /* Node Mapping Mode */
 
-      if (queue -> mode & BLAS_NODE) {
+      if ((queue -> mode & BLAS_NODE) && (queue -> mode & BLAS_NODE_HINT)) {
+
+	if (num_node_list == 0) num_node_list = worker_nodes(node, node_list);
+	target = node_list[queue -> node % num_node_list];
+
+	/* Prefer a free thread on the requested node, but never wait */
+	/* for one while another node has an idle thread              */
+	do {
+	  for (i = 0; i < blas_num_threads - 1; i++)
+	    if ((thread_status[i].node == target) && !thread_status[i].queue) break;
+	  if (i < blas_num_threads - 1) break;
+
+	  for (i = 0; i < blas_num_threads - 1; i++)
+	    if (!thread_status[i].queue) break;
+	  if (i < blas_num_threads - 1) break;
+
+	  YIELDING;
+	} while (1);
+
+      } else if (queue -> mode & BLAS_NODE) {
 
 	do {
 	  while((thread_status[i].node != node || thread_status[i].queue) && (i < blas_num_threads - 1)) i ++;
@@ -692,6 +882,7 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
         pthread_mutex_unlock  (&thread_status[i].lock);
       }
 #endif
+      }
 
       queue -> assigned = i;
       WMB;
@@ -723,6 +914,9 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
       pthread_mutex_unlock  (&thread_status[pos].lock);
 
       if ((BLASULONG)tspq > 1) {
+#ifdef USE_FUTEX
+	thread_unpark(pos);
+#else
 	pthread_mutex_lock  (&thread_status[pos].lock);
 
 	if (thread_status[pos].status == THREAD_STATUS_SLEEP) {
@@ -733,12 +927,14 @@ int exec_blas_async(BLASLONG pos, blas_queue_t *queue){
 #endif
 
 	  if (thread_status[pos].status == THREAD_STATUS_SLEEP) {
+	    thread_status[pos].wake_stamp = wake_clock();
 	    thread_status[pos].status = THREAD_STATUS_WAKEUP;
 	    pthread_cond_signal(&thread_status[pos].wakeup);
 	  }
 
 	}
 	  pthread_mutex_unlock(&thread_status[pos].lock);
+#endif
       }
 
       current = current -> next;
@@ -846,6 +1042,168 @@ int exec_blas(BLASLONG num, blas_queue_t *queue){
   return 0;
 }
 
+#ifdef USE_WORK_STEALING
+
+/* Work-stealing execution.  The tiles are dealt out in contiguous   */
+/* runs to one deque per participating thread.  Every thread drains  */
+/* its own deque from the bottom and, once it is empty, steals from  */
+/* the top of the others, so a slow thread no longer holds the whole */
+/* call back.  Both ends live in one word updated by compare and     */
+/* swap, which keeps the deques lock-free.                           */
+
+typedef struct {
+  volatile unsigned long long span __attribute__((aligned(ATTRIBUTE_SIZE)));  /* bottom << 32 | top */
+} steal_deque_t;
+
+typedef struct {
+  blas_queue_t *tasks[MAX_BLAS_TILES];
+  steal_deque_t deque[MAX_CPU_NUMBER];
+  BLASLONG      num_deques;
+} steal_context_t;
+
+#define DEQUE_TOP(s)	((BLASLONG)((s) & 0xffffffffULL))
+#define DEQUE_BOTTOM(s)	((BLASLONG)((s) >> 32))
+#define DEQUE_SPAN(t, b)	(((unsigned long long)(b) << 32) | (unsigned long long)(t))
+
+static BLASLONG steal_pop(steal_deque_t *deque){
+
+  unsigned long long span;
+  BLASLONG top, bottom;
+
+  do {
+    span   = deque -> span;
+    top    = DEQUE_TOP(span);
+    bottom = DEQUE_BOTTOM(span);
+    if (top >= bottom) return -1;
+  } while (!__sync_bool_compare_and_swap(&deque -> span, span, DEQUE_SPAN(top, bottom - 1)));
+
+  return bottom - 1;
+}
+
+static BLASLONG steal_take(steal_deque_t *deque){
+
+  unsigned long long span;
+  BLASLONG top, bottom;
+
+  do {
+    span   = deque -> span;
+    top    = DEQUE_TOP(span);
+    bottom = DEQUE_BOTTOM(span);
+    if (top >= bottom) return -1;
+  } while (!__sync_bool_compare_and_swap(&deque -> span, span, DEQUE_SPAN(top + 1, bottom)));
+
+  return top;
+}
+
+static void steal_run(blas_queue_t *task, void *sa, void *sb, BLASLONG mypos){
+
+  int (*routine)(blas_arg_t *, void *, void *, void *, void *, BLASLONG) = task -> routine;
+
+  (routine)(task -> args, task -> range_m, task -> range_n, sa, sb, mypos);
+}
+
+static int steal_worker(blas_arg_t *arg, void *range_m, void *range_n, void *sa, void *sb, BLASLONG mypos){
+
+  steal_context_t *context = (steal_context_t *)arg;
+  BLASLONG num = context -> num_deques;
+  BLASLONG self, victim, i, task, found;
+
+  self = *(BLASLONG *)range_m;
+
+  while ((task = steal_pop(&context -> deque[self])) >= 0)
+    steal_run(context -> tasks[task], sa, sb, mypos);
+
+  do {
+    found = 0;
+    for (i = 1; i < num; i++) {
+      victim = self + i;
+      if (victim >= num) victim -= num;
+      while ((task = steal_take(&context -> deque[victim])) >= 0) {
+	steal_run(context -> tasks[task], sa, sb, mypos);
+	found = 1;
+      }
+    }
+  } while (found);
+
+  return 0;
+}
+
+/* Runs the num independent entries of queue on up to nthreads threads. */
+/* Entries must be regular (non legacy, non pthread) level 3 routines;   */
+/* the first one carries the caller's buffers.  More entries than a     */
+/* context holds are run in several rounds.                             */
+int exec_blas_steal(BLASLONG num, blas_queue_t *queue, BLASLONG nthreads){
+
+  steal_context_t context;
+  blas_queue_t workers[MAX_CPU_NUMBER];
+  BLASLONG index[MAX_CPU_NUMBER];
+  blas_queue_t *current;
+  void *sa, *sb;
+  BLASLONG i, from, to, count, nworkers;
+
+  if ((num <= 0) || (queue == NULL)) return 0;
+
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  sa = queue -> sa;
+  sb = queue -> sb;
+
+  if ((nthreads <= 1) || (num <= 1)) {
+    for (current = queue, i = 0; current && (i < num); current = current -> next, i++)
+      steal_run(current, sa, sb, 0);
+    return 0;
+  }
+
+  current = queue;
+
+  while ((num > 0) && current) {
+
+    count = num;
+    if (count > MAX_BLAS_TILES) count = MAX_BLAS_TILES;
+
+    for (i = 0; (i < count) && current; i++, current = current -> next)
+      context.tasks[i] = current;
+
+    count = i;
+    num  -= count;
+
+    nworkers = nthreads;
+    if (nworkers > count) nworkers = count;
+
+    context.num_deques = nworkers;
+
+    for (i = 0; i < nworkers; i++) {
+      from = blas_quickdivide(count * i,       nworkers);
+      to   = blas_quickdivide(count * (i + 1), nworkers);
+      context.deque[i].span = DEQUE_SPAN(from, to);
+
+      index[i] = i;
+
+      workers[i].mode    = queue -> mode;
+      workers[i].routine = steal_worker;
+      workers[i].args    = (blas_arg_t *)&context;
+      workers[i].range_m = &index[i];
+      workers[i].range_n = NULL;
+      workers[i].sa      = NULL;
+      workers[i].sb      = NULL;
+      workers[i].next    = &workers[i + 1];
+    }
+
+    /* the calling thread works with its own buffer */
+    workers[0].sa = sa;
+    workers[0].sb = sb;
+    workers[nworkers - 1].next = NULL;
+
+    WMB;
+
+    exec_blas(nworkers, workers);
+  }
+
+  return 0;
+}
+
+#endif
+
 void goto_set_num_threads(int num_threads) {
 
   long i;
@@ -882,6 +1240,9 @@ void goto_set_num_threads(int num_threads) {
 
       thread_status[i].queue  = (blas_queue_t *)NULL;
       thread_status[i].status = THREAD_STATUS_WAKEUP;
+#ifdef USE_FUTEX
+      thread_status[i].parked = 0;
+#endif
 
       pthread_mutex_init(&thread_status[i].lock, NULL);
       pthread_cond_init (&thread_status[i].wakeup, NULL);
@@ -981,6 +1342,10 @@ int BLASFUNC(blas_thread_shutdown)(void){
 
     pthread_mutex_unlock(&thread_status[i].lock);
 
+#ifdef USE_FUTEX
+    thread_unpark(i);
+#endif
+
   }
 
   for(i = 0; i < blas_num_threads - 1; i++){
@@ -1003,5 +1368,28 @@ int BLASFUNC(blas_thread_shutdown)(void){
   return 0;
 }
 
+/* Ask idle workers to stop spinning and go to sleep immediately,   */
+/* e.g. when the application is about to leave a BLAS-heavy phase.  */
+void openblas_park_threads(void){
+  __sync_fetch_and_add(&park_generation, 1);
+}
+
+/* Average time between waking a sleeping worker and the worker     */
+/* running again, in nanoseconds (0 if no worker was ever woken).   */
+double openblas_get_wakeup_latency(void){
+
+  int i;
+  unsigned long long total = 0, count = 0;
+
+  for (i = 0; i < MAX_CPU_NUMBER; i++) {
+    total += thread_status[i].wake_total;
+    count += thread_status[i].wake_count;
+  }
+
+  if (count == 0) return 0.;
+
+  return (double)total / (double)count;
+}
+
 #endif
 
@@ -102,6 +102,14 @@ void openblas_set_num_threads(int num_threads) {
 	goto_set_num_threads(num_threads);
 }
 
+/* Idle threads belong to the OpenMP runtime (see OMP_WAIT_POLICY). */
+void openblas_park_threads(void) {
+}
+
+double openblas_get_wakeup_latency(void) {
+	return 0.;
+}
+
 int blas_thread_init(void){
 
   int i=0, j=0;
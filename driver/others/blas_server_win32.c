@@ -524,3 +524,13 @@ void openblas_set_num_threads(int num)
 {
 	goto_set_num_threads(num);
 }
+
+/* Workers block on events already; nothing to park eagerly. */
+void openblas_park_threads(void)
+{
+}
+
+double openblas_get_wakeup_latency(void)
+{
+	return 0.;
+}
@@ -0,0 +1,130 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Cross-batch scheduler for the batched GEMM interfaces.            */
+/* Every worker runs whole batch entries with the single-threaded    */
+/* level 3 driver and keeps the sa/sb packing buffers it received    */
+/* from the thread server for the lifetime of the batch.  Entries    */
+/* are handed out in small chunks from a shared counter so that      */
+/* uneven problem sizes balance themselves.                          */
+
+typedef int (*batch_routine_t)(blas_arg_t *, BLASLONG *, BLASLONG *, void *, void *, BLASLONG);
+
+typedef struct {
+  volatile BLASULONG lock;
+  volatile BLASLONG  next;
+  BLASLONG  count;
+  BLASLONG  chunk;
+  blas_arg_t *args;
+  batch_routine_t *routines;
+} batch_job_t;
+
+static int batch_inner(blas_arg_t *arg, BLASLONG *range_m, BLASLONG *range_n,
+		       void *sa, void *sb, BLASLONG mypos){
+
+  batch_job_t *job = (batch_job_t *)arg -> common;
+  BLASLONG i, from, to;
+
+  while (1) {
+
+    blas_lock(&job -> lock);
+    from = job -> next;
+    job -> next = from + job -> chunk;
+    blas_unlock(&job -> lock);
+
+    if (from >= job -> count) break;
+
+    to = MIN(from + job -> chunk, job -> count);
+
+    for (i = from; i < to; i++)
+      (job -> routines[i])(&job -> args[i], NULL, NULL, sa, sb, 0);
+  }
+
+  return 0;
+}
+
+int gemm_batch_thread(int mode, blas_arg_t *args, int (**routines)(), BLASLONG count,
+		      void *sa, void *sb, BLASLONG nthreads){
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  blas_arg_t   newarg;
+  batch_job_t  job;
+  BLASLONG i;
+
+  if (count <= 0) return 0;
+
+  if (nthreads > count) nthreads = count;
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  job.lock     = 0;
+  job.next     = 0;
+  job.count    = count;
+  job.args     = args;
+  job.routines = (batch_routine_t *)routines;
+
+  /* Small chunks keep the tail balanced, at least one entry per grab */
+  job.chunk    = count / (nthreads * 8);
+  if (job.chunk < 1) job.chunk = 1;
+
+  if (nthreads <= 1) {
+    newarg.common = (void *)&job;
+    batch_inner(&newarg, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  newarg.common   = (void *)&job;
+  newarg.nthreads = nthreads;
+
+  for (i = 0; i < nthreads; i++) {
+    blas_queue_init(&queue[i]);
+    queue[i].mode    = mode;
+    queue[i].routine = batch_inner;
+    queue[i].args    = &newarg;
+    queue[i].range_m = NULL;
+    queue[i].range_n = NULL;
+    queue[i].next    = &queue[i + 1];
+  }
+
+  /* The caller works on its own buffer, the workers use theirs */
+  queue[0].sa = sa;
+  queue[0].sb = sb;
+  queue[nthreads - 1].next = NULL;
+
+  exec_blas(nthreads, queue);
+
+  return 0;
+}
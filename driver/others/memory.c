@@ -521,6 +521,12 @@ static pthread_spinlock_t key_lock = 0;
 static BLASULONG  key_lock = 0UL;
 #endif
 
+/* Buffers mapped over all threads, the most ever mapped at once, and */
+/* the buffers handed out over all threads                            */
+static int memory_mapped = 0;
+static int memory_mapped_peak = 0;
+static int memory_in_use = 0;
+
 /* Returns a pointer to the start of the per-thread memory allocation data */
 static __inline struct alloc_t ** get_memory_table() {
 #if defined(SMP)
@@ -1069,6 +1075,9 @@ static volatile int memory_initialized = 0;
       if (alloc_info) {
         alloc_info->release_func(alloc_info);
         table[pos] = (void *)0;
+        LOCK_COMMAND(&alloc_lock);
+        memory_mapped --;
+        UNLOCK_COMMAND(&alloc_lock);
       }
     }
     free(table);
@@ -1155,6 +1164,8 @@ UNLOCK_COMMAND(&alloc_lock);
 #endif
 #endif
 
+      blas_load_profile();
+
       memory_initialized = 1;
 
 #if defined(SMP) && !defined(USE_OPENMP)
@@ -1230,6 +1241,11 @@ UNLOCK_COMMAND(&alloc_lock);
 
     alloc_table[position] = alloc_info = map_address;
 
+    LOCK_COMMAND(&alloc_lock);
+    memory_mapped ++;
+    if (memory_mapped > memory_mapped_peak) memory_mapped_peak = memory_mapped;
+    UNLOCK_COMMAND(&alloc_lock);
+
 #ifdef DEBUG
     printf("  Mapping Succeeded. %p(%d)\n", (void *)alloc_info, position);
 #endif
@@ -1241,6 +1257,10 @@ UNLOCK_COMMAND(&alloc_lock);
 
   alloc_info->used = 1;
 
+  LOCK_COMMAND(&alloc_lock);
+  memory_in_use ++;
+  UNLOCK_COMMAND(&alloc_lock);
+
   return (void *)(((char *)alloc_info) + sizeof(struct alloc_t));
 
  error:
@@ -1263,6 +1283,10 @@ void blas_memory_free(void *buffer){
 
   alloc_info->used = 0;
 
+  LOCK_COMMAND(&alloc_lock);
+  memory_in_use --;
+  UNLOCK_COMMAND(&alloc_lock);
+
 #ifdef DEBUG
   printf("Unmap Succeeded.\n\n");
 #endif
@@ -1290,6 +1314,16 @@ void blas_memory_free_nolock(void * map_address) {
   free(map_address);
 }
 
+/* Buffer memory handed out, and the most ever mapped at once, both */
+/* over all threads although the tables are per thread here.        */
+size_t openblas_get_memory_in_use(void){
+  return (size_t)memory_in_use * BUFFER_SIZE;
+}
+
+size_t openblas_get_memory_high_water(void){
+  return (size_t)memory_mapped_peak * BUFFER_SIZE;
+}
+
 void blas_shutdown(void){
 #ifdef SMP
   BLASFUNC(blas_thread_shutdown)();
@@ -1958,8 +1992,29 @@ struct release_t {
 
 int hugetlb_allocated = 0;
 
-static struct release_t release_info[NUM_BUFFERS];
+static struct release_t release_table[NUM_BUFFERS];
+static struct release_t *release_info = release_table;
 static int release_pos = 0;
+static int release_max = NUM_BUFFERS;
+
+/* Make room for one more release record; called with alloc_lock held */
+static int release_reserve(void){
+
+  struct release_t *table;
+
+  if (release_pos < release_max) return 1;
+
+  table = (struct release_t *)malloc(sizeof(struct release_t) * release_max * 2);
+  if (table == NULL) return 0;
+
+  memcpy(table, release_info, sizeof(struct release_t) * release_pos);
+  if (release_info != release_table) free(release_info);
+
+  release_info = table;
+  release_max *= 2;
+
+  return 1;
+}
 
 #if defined(OS_LINUX) && !defined(NO_WARMUP)
 static int hot_alloc = 0;
@@ -2003,9 +2058,11 @@ static void *alloc_mmap(void *address){
 
   if (map_address != (void *)-1) {
     LOCK_COMMAND(&alloc_lock);
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_mmap_free;
-    release_pos ++;
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_mmap_free;
+      release_pos ++;
+    }
     UNLOCK_COMMAND(&alloc_lock);
   }
 
@@ -2151,9 +2208,11 @@ static void *alloc_mmap(void *address){
   LOCK_COMMAND(&alloc_lock);
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_mmap_free;
-    release_pos ++;
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_mmap_free;
+      release_pos ++;
+    }
   }
   UNLOCK_COMMAND(&alloc_lock);
 
@@ -2182,9 +2241,13 @@ static void *alloc_malloc(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_malloc_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_malloc_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2216,9 +2279,13 @@ static void *alloc_qalloc(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_qalloc_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_qalloc_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return (void *)(((BLASULONG)map_address + FIXED_PAGESIZE - 1) & ~(FIXED_PAGESIZE - 1));
@@ -2245,9 +2312,13 @@ static void *alloc_windows(void *address){
   if (map_address == (void *)NULL) map_address = (void *)-1;
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_windows_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_windows_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2289,10 +2360,14 @@ static void *alloc_devicedirver(void *address){
 		     fd, 0);
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = fd;
-    release_info[release_pos].func    = alloc_devicedirver_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].attr    = fd;
+      release_info[release_pos].func    = alloc_devicedirver_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2325,10 +2400,14 @@ static void *alloc_shm(void *address){
 
     shmctl(shmid, IPC_RMID, 0);
 
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = shmid;
-    release_info[release_pos].func    = alloc_shm_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].attr    = shmid;
+      release_info[release_pos].func    = alloc_shm_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2431,9 +2510,13 @@ static void *alloc_hugetlb(void *address){
 #endif
 
   if (map_address != (void *)-1){
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].func    = alloc_hugetlb_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].func    = alloc_hugetlb_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2479,10 +2562,14 @@ static void *alloc_hugetlbfile(void *address){
 		     fd, 0);
 
   if (map_address != (void *)-1) {
-    release_info[release_pos].address = map_address;
-    release_info[release_pos].attr    = fd;
-    release_info[release_pos].func    = alloc_hugetlbfile_free;
-    release_pos ++;
+    LOCK_COMMAND(&alloc_lock);
+    if (release_reserve()) {
+      release_info[release_pos].address = map_address;
+      release_info[release_pos].attr    = fd;
+      release_info[release_pos].func    = alloc_hugetlbfile_free;
+      release_pos ++;
+    }
+    UNLOCK_COMMAND(&alloc_lock);
   }
 
   return map_address;
@@ -2496,7 +2583,13 @@ static BLASULONG base_address      = 0UL;
 static BLASULONG base_address      = BASE_ADDRESS;
 #endif
 
-static volatile struct {
+/* Buffer table.  The first NUM_BUFFERS slots are static; when all of */
+/* them are busy another block of NUM_BUFFERS slots is chained on, so */
+/* the number of concurrent callers is no longer capped.  Each slot   */
+/* has its own lock and every thread remembers the slot it used last, */
+/* so the common case neither scans the table nor takes alloc_lock.   */
+
+typedef volatile struct {
   BLASULONG lock;
   void *addr;
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
@@ -2509,10 +2602,48 @@ static volatile struct {
   char dummy[40];
 #endif
 
-} memory[NUM_BUFFERS];
+} memory_slot_t;
+
+struct memory_block {
+  memory_slot_t slot[NUM_BUFFERS];
+  struct memory_block * volatile next;
+};
+
+static struct memory_block memory;
+
+static BLAS_THREAD_LOCAL int memory_hint = -1;
 
 static int memory_initialized = 0;
 
+static memory_slot_t *memory_slot(int position){
+
+  struct memory_block *block = &memory;
+
+  while (position >= NUM_BUFFERS) {
+    block = block -> next;
+    if (block == NULL) return NULL;
+    position -= NUM_BUFFERS;
+  }
+
+  return &block -> slot[position];
+}
+
+static int memory_claim(memory_slot_t *slot){
+
+  int claimed = 0;
+
+  if (!slot -> used) {
+    blas_lock(&slot -> lock);
+    if (!slot -> used) {
+      slot -> used = 1;
+      claimed = 1;
+    }
+    blas_unlock(&slot -> lock);
+  }
+
+  return claimed;
+}
+
 /*       Memory allocation routine           */
 /* procpos ... indicates where it comes from */
 /*                0 : Level 3 functions      */
@@ -2521,12 +2652,14 @@ static int memory_initialized = 0;
 
 void *blas_memory_alloc(int procpos){
 
-  int position;
+  int position, i;
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
   int mypos;
 #endif
 
   void *map_address;
+  memory_slot_t *slot;
+  struct memory_block *block, *new_block;
 
   void *(*memoryalloc[])(void *address) = {
 #ifdef ALLOC_DEVICEDRIVER
@@ -2560,10 +2693,10 @@ void *blas_memory_alloc(int procpos){
 
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
     for (position = 0; position < NUM_BUFFERS; position ++){
-      memory[position].addr   = (void *)0;
-      memory[position].pos    = -1;
-      memory[position].used   = 0;
-      memory[position].lock   = 0;
+      memory.slot[position].addr   = (void *)0;
+      memory.slot[position].pos    = -1;
+      memory.slot[position].used   = 0;
+      memory.slot[position].lock   = 0;
     }
 #endif
 
@@ -2585,6 +2718,8 @@ void *blas_memory_alloc(int procpos){
 #endif
 #endif
 
+    blas_load_profile();
+
     memory_initialized = 1;
 
   }
@@ -2594,47 +2729,45 @@ void *blas_memory_alloc(int procpos){
   printf("Alloc Start ...\n");
 #endif
 
-/* #if defined(WHEREAMI) && !defined(USE_OPENMP)
-
-  mypos = WhereAmI();
+  /* The slot this thread released last is usually still free */
+  position = memory_hint;
 
-  position = mypos;
-  while (position >= NUM_BUFFERS) position >>= 1;
+  if (position >= 0) {
+    slot = memory_slot(position);
+    if (slot && memory_claim(slot)) goto allocation;
+  }
 
-  do {
-    if (!memory[position].used && (memory[position].pos == mypos)) {
-      LOCK_COMMAND(&alloc_lock);
-//      blas_lock(&memory[position].lock);
+  /* Otherwise take the first free slot, growing the table if needed */
+  position = 0;
+  block    = &memory;
 
-      if (!memory[position].used) goto allocation;
+  while (block) {
 
-      UNLOCK_COMMAND(&alloc_lock);
-//      blas_unlock(&memory[position].lock);
+    for (i = 0; i < NUM_BUFFERS; i ++, position ++) {
+      slot = &block -> slot[i];
+      if (memory_claim(slot)) goto allocation;
     }
 
-    position ++;
-
-  } while (position < NUM_BUFFERS);
-
-
-#endif */
+    if (!block -> next) {
+      LOCK_COMMAND(&alloc_lock);
 
-  position = 0;
+      if (!block -> next) {
+	new_block = (struct memory_block *)calloc(1, sizeof(struct memory_block));
 
-  LOCK_COMMAND(&alloc_lock);
-  do {
-/*    if (!memory[position].used) { */
-/*      blas_lock(&memory[position].lock);*/
+#if defined(WHEREAMI) && !defined(USE_OPENMP)
+	if (new_block)
+	  for (i = 0; i < NUM_BUFFERS; i ++) new_block -> slot[i].pos = -1;
+#endif
 
-      if (!memory[position].used) goto allocation;
-      
-/*      blas_unlock(&memory[position].lock);*/
-/*    } */
+	WMB;
+	block -> next = new_block;
+      }
 
-    position ++;
+      UNLOCK_COMMAND(&alloc_lock);
+    }
 
-  } while (position < NUM_BUFFERS);
-  UNLOCK_COMMAND(&alloc_lock);
+    block = block -> next;
+  }
 
   goto error;
 
@@ -2644,12 +2777,9 @@ void *blas_memory_alloc(int procpos){
   printf("  Position -> %d\n", position);
 #endif
 
-  memory[position].used = 1;
-
-  UNLOCK_COMMAND(&alloc_lock);
-/*  blas_unlock(&memory[position].lock);*/
+  memory_hint = position;
 
-  if (!memory[position].addr) {
+  if (!slot -> addr) {
     do {
 #ifdef DEBUG
       printf("Allocation Start : %lx\n", base_address);
@@ -2694,17 +2824,17 @@ void *blas_memory_alloc(int procpos){
     } while ((BLASLONG)map_address == -1);
 
     LOCK_COMMAND(&alloc_lock);
-    memory[position].addr = map_address;
+    slot -> addr = map_address;
     UNLOCK_COMMAND(&alloc_lock);
 
 #ifdef DEBUG
-    printf("  Mapping Succeeded. %p(%d)\n", (void *)memory[position].addr, position);
+    printf("  Mapping Succeeded. %p(%d)\n", (void *)slot -> addr, position);
 #endif
   }
 
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
 
-  if (memory[position].pos == -1) memory[position].pos = mypos;
+  if (slot -> pos == -1) slot -> pos = mypos;
 
 #endif
 
@@ -2729,10 +2859,10 @@ void *blas_memory_alloc(int procpos){
 
 #ifdef DEBUG
   printf("Mapped   : %p  %3d\n\n",
-	  (void *)memory[position].addr, position);
+	  (void *)slot -> addr, position);
 #endif
 
-  return (void *)memory[position].addr;
+  return (void *)slot -> addr;
 
  error:
   printf("BLAS : Program is Terminated. Because you tried to allocate too many memory regions.\n");
@@ -2742,19 +2872,36 @@ void *blas_memory_alloc(int procpos){
 
 void blas_memory_free(void *free_area){
 
-  int position;
+  int position, i;
+  memory_slot_t *slot;
+  struct memory_block *block;
 
 #ifdef DEBUG
   printf("Unmapped Start : %p ...\n", free_area);
 #endif
 
-  position = 0;
-  LOCK_COMMAND(&alloc_lock);
+  /* Buffers are mostly returned by the thread that got them */
+  position = memory_hint;
+  slot = (position >= 0) ? memory_slot(position) : NULL;
 
-  while ((position < NUM_BUFFERS) && (memory[position].addr != free_area))
-    position++;
+  if (!slot || (slot -> addr != free_area)) {
 
-  if (memory[position].addr != free_area) goto error;
+    slot     = NULL;
+    position = 0;
+    block    = &memory;
+
+    while (block && !slot) {
+      for (i = 0; i < NUM_BUFFERS; i ++, position ++) {
+	if (block -> slot[i].addr == free_area) {
+	  slot = &block -> slot[i];
+	  break;
+	}
+      }
+      block = block -> next;
+    }
+
+    if (!slot) goto error;
+  }
 
 #ifdef DEBUG
   printf("  Position : %d\n", position);
@@ -2763,8 +2910,9 @@ void blas_memory_free(void *free_area){
   // arm: ensure all writes are finished before other thread takes this memory
   WMB;
 
-  memory[position].used = 0;
-  UNLOCK_COMMAND(&alloc_lock);
+  slot -> used = 0;
+
+  memory_hint = position;
 
 #ifdef DEBUG
   printf("Unmap Succeeded.\n\n");
@@ -2773,13 +2921,12 @@ void blas_memory_free(void *free_area){
   return;
 
  error:
-  printf("BLAS : Bad memory unallocation! : %4d  %p\n", position,  free_area);
+  printf("BLAS : Bad memory unallocation! : %p\n", free_area);
 
 #ifdef DEBUG
-  for (position = 0; position < NUM_BUFFERS; position++)
-    printf("%4ld  %p : %d\n", position, memory[position].addr, memory[position].used);
+  for (position = 0; (slot = memory_slot(position)) != NULL; position++)
+    printf("%4d  %p : %d\n", position, slot -> addr, slot -> used);
 #endif
-  UNLOCK_COMMAND(&alloc_lock);
 
   return;
 }
@@ -2794,9 +2941,38 @@ void blas_memory_free_nolock(void * map_address) {
   free(map_address);
 }
 
+/* Buffer memory currently handed out, and the memory mapped so far;  */
+/* as free slots are always reused first, the latter is the high-water */
+/* mark of concurrent use.                                             */
+size_t openblas_get_memory_in_use(void){
+
+  int position;
+  size_t count = 0;
+  memory_slot_t *slot;
+
+  for (position = 0; (slot = memory_slot(position)) != NULL; position ++)
+    if (slot -> used) count ++;
+
+  return count * BUFFER_SIZE;
+}
+
+size_t openblas_get_memory_high_water(void){
+
+  int position;
+  size_t count = 0;
+  memory_slot_t *slot;
+
+  for (position = 0; (slot = memory_slot(position)) != NULL; position ++)
+    if (slot -> addr) count ++;
+
+  return count * BUFFER_SIZE;
+}
+
 void blas_shutdown(void){
 
   int pos;
+  memory_slot_t *slot;
+  struct memory_block *block, *next;
 
 #ifdef SMP
   BLASFUNC(blas_thread_shutdown)();
@@ -2807,6 +2983,7 @@ void blas_shutdown(void){
   for (pos = 0; pos < release_pos; pos ++) {
     release_info[pos].func(&release_info[pos]);
   }
+  release_pos = 0;
 
 #ifdef SEEK_ADDRESS
   base_address      = 0UL;
@@ -2815,12 +2992,22 @@ void blas_shutdown(void){
 #endif
 
   for (pos = 0; pos < NUM_BUFFERS; pos ++){
-    memory[pos].addr   = (void *)0;
-    memory[pos].used   = 0;
+    slot = &memory.slot[pos];
+    slot -> addr   = (void *)0;
+    slot -> used   = 0;
 #if defined(WHEREAMI) && !defined(USE_OPENMP)
-    memory[pos].pos    = -1;
+    slot -> pos    = -1;
 #endif
-    memory[pos].lock   = 0;
+    slot -> lock   = 0;
+  }
+
+  block = memory.next;
+  memory.next = NULL;
+
+  while (block) {
+    next = block -> next;
+    free(block);
+    block = next;
   }
 
   UNLOCK_COMMAND(&alloc_lock);
@@ -75,3 +75,11 @@ void blas_memory_free(void *free_area){
   return;
 }
 
+size_t openblas_get_memory_in_use(void){
+  return 0;
+}
+
+size_t openblas_get_memory_high_water(void){
+  return (sa == NULL) ? 0 : BUFFER_SIZE;
+}
+
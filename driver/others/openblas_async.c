@@ -0,0 +1,409 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+
+/* Asynchronous requests.  A queue owns one dispatcher thread that   */
+/* runs its requests one after the other, in submission order, as    */
+/* ordinary blocking calls.  The dispatcher works under a context    */
+/* holding pool threads that no other queue has reserved, so requests */
+/* on different queues run concurrently on disjoint sets of workers. */
+/* Without the pthreads server requests run at submission.           */
+
+#if defined(SMP) && !defined(OS_WINDOWS)
+#define ASYNC_THREADS
+#endif
+
+#define REQUEST_QUEUED		0
+#define REQUEST_FINISHING	1	/* callback running */
+#define REQUEST_DONE		2
+
+struct openblas_request {
+  struct openblas_request *next;
+  void (*routine)(void *);
+  void (*callback)(struct openblas_request *, void *);
+  void *data;
+  volatile int status;
+#ifdef ASYNC_THREADS
+  pthread_mutex_t lock;
+  pthread_cond_t  finished;
+#endif
+};
+
+struct openblas_queue {
+#ifdef ASYNC_THREADS
+  pthread_t       thread;
+  pthread_mutex_t lock;
+  pthread_cond_t  wakeup;
+  pthread_cond_t  idle;
+  blas_request_t *head, *tail;
+  int             busy, shutdown;
+  blas_context_t  ctx;
+#endif
+  int             reserved;
+};
+
+/* The arguments are copied right behind the request */
+#define REQUEST_HEAD	((sizeof(blas_request_t) + 15) & ~(size_t)15)
+#define REQUEST_ARGS(r)	((void *)((char *)(r) + REQUEST_HEAD))
+
+static void request_finish(blas_request_t *req){
+
+  void (*callback)(blas_request_t *, void *);
+
+#ifdef ASYNC_THREADS
+  pthread_mutex_lock(&req -> lock);
+  callback = req -> callback;
+  req -> status = REQUEST_FINISHING;
+  pthread_mutex_unlock(&req -> lock);
+
+  if (callback) (callback)(req, req -> data);
+
+  /* The owner may free the request once the lock is released */
+  pthread_mutex_lock(&req -> lock);
+  req -> status = REQUEST_DONE;
+  pthread_cond_broadcast(&req -> finished);
+  pthread_mutex_unlock(&req -> lock);
+#else
+  callback = req -> callback;
+  req -> status = REQUEST_DONE;
+  if (callback) (callback)(req, req -> data);
+#endif
+}
+
+#ifdef ASYNC_THREADS
+
+static pthread_mutex_t queue_lock = PTHREAD_MUTEX_INITIALIZER;
+static blas_async_queue_t *default_queue = NULL;
+static pthread_once_t queue_once = PTHREAD_ONCE_INIT;
+
+extern void openblas_warning(int verbose, const char * msg);
+
+/* Only the forking thread lives on in the child, so no dispatcher   */
+/* does : the child drops the queues (leaking them, as their locks   */
+/* may be held) and builds a new default queue on the next request   */
+static void queue_atfork_child(void){
+
+  pthread_mutex_init(&queue_lock, NULL);
+  default_queue = NULL;
+  blas_cpu_release_queues();
+}
+
+static void queue_init(void){
+
+  if (pthread_atfork(NULL, NULL, queue_atfork_child) != 0)
+    openblas_warning(0, "OpenBLAS Warning ... cannot install fork handler for the async queues.\n");
+}
+
+static void *queue_dispatcher(void *arg){
+
+  blas_async_queue_t *queue = (blas_async_queue_t *)arg;
+  blas_request_t *req;
+
+  /* The default queue keeps the library-wide thread settings */
+  if (queue -> reserved) openblas_set_context(&queue -> ctx);
+
+  while (1) {
+
+    pthread_mutex_lock(&queue -> lock);
+    while (!queue -> head && !queue -> shutdown)
+      pthread_cond_wait(&queue -> wakeup, &queue -> lock);
+
+    req = queue -> head;
+    if (req == NULL) {
+      pthread_mutex_unlock(&queue -> lock);
+      break;
+    }
+
+    queue -> head = req -> next;
+    if (queue -> head == NULL) queue -> tail = NULL;
+    queue -> busy = 1;
+    pthread_mutex_unlock(&queue -> lock);
+
+    (req -> routine)(REQUEST_ARGS(req));
+
+    request_finish(req);
+
+    pthread_mutex_lock(&queue -> lock);
+    queue -> busy = 0;
+    if (queue -> head == NULL) pthread_cond_broadcast(&queue -> idle);
+    pthread_mutex_unlock(&queue -> lock);
+  }
+
+  openblas_set_context(NULL);
+
+  return NULL;
+}
+
+static void queue_release(blas_async_queue_t *queue){
+
+  if (queue -> ctx.reserved) blas_cpu_release(queue -> ctx.cpu, queue -> ctx.ncpus);
+
+  pthread_cond_destroy(&queue -> idle);
+  pthread_cond_destroy(&queue -> wakeup);
+  pthread_mutex_destroy(&queue -> lock);
+}
+
+static blas_async_queue_t *queue_create(int num_threads, int reserve){
+
+  blas_async_queue_t *queue;
+#ifndef USE_OPENMP
+  int want, pool;
+#endif
+
+  pthread_once(&queue_once, queue_init);
+
+  queue = (blas_async_queue_t *)calloc(1, sizeof(blas_async_queue_t));
+  if (queue == NULL) return NULL;
+
+  queue -> reserved = reserve;
+
+  if (reserve) {
+#ifdef USE_OPENMP
+    /* The OpenMP runtime owns the workers, only the count applies */
+    queue -> ctx.nthreads = (num_threads > 0) ? num_threads : blas_cpu_number;
+#else
+    pool = blas_num_threads - 1;
+    want = (num_threads > 0) ? num_threads - 1 : pool;
+
+    queue -> ctx.ncpus = blas_cpu_claim_free(queue -> ctx.cpu, want, pool);
+
+    /* An empty set would mean any pool thread, so run serially then */
+    queue -> ctx.nthreads = queue -> ctx.ncpus + 1;
+    queue -> ctx.reserved = (queue -> ctx.ncpus > 0);
+#endif
+  }
+
+  pthread_mutex_init(&queue -> lock, NULL);
+  pthread_cond_init(&queue -> wakeup, NULL);
+  pthread_cond_init(&queue -> idle, NULL);
+
+  if (pthread_create(&queue -> thread, NULL, queue_dispatcher, queue) != 0) {
+    queue_release(queue);
+    free(queue);
+    return NULL;
+  }
+
+  return queue;
+}
+
+#endif
+
+/* num_threads counts the dispatcher, which takes the caller's part  */
+/* in each request; 0 reserves every pool thread still free.  The    */
+/* queue gets fewer threads than asked for once the pool runs out.   */
+blas_async_queue_t *openblas_queue_create(int num_threads){
+
+#ifdef ASYNC_THREADS
+  if (num_threads < 0) num_threads = 1;
+  if (num_threads > MAX_CPU_NUMBER) num_threads = MAX_CPU_NUMBER;
+
+  return queue_create(num_threads, 1);
+#else
+  (void)num_threads;
+
+  return (blas_async_queue_t *)calloc(1, sizeof(blas_async_queue_t));
+#endif
+}
+
+/* Waits for all requests submitted to the queue so far */
+int openblas_queue_synchronize(blas_async_queue_t *queue){
+
+#ifdef ASYNC_THREADS
+  if (queue == NULL) queue = default_queue;
+  if (queue == NULL) return 0;
+
+  pthread_mutex_lock(&queue -> lock);
+  while (queue -> head || queue -> busy)
+    pthread_cond_wait(&queue -> idle, &queue -> lock);
+  pthread_mutex_unlock(&queue -> lock);
+#else
+  (void)queue;
+#endif
+
+  return 0;
+}
+
+/* Finishes the pending requests, then stops the dispatcher and      */
+/* hands the pool threads back.  Requests stay valid until freed.    */
+void openblas_queue_destroy(blas_async_queue_t *queue){
+
+  if (queue == NULL) return;
+
+#ifdef ASYNC_THREADS
+  pthread_mutex_lock(&queue -> lock);
+  queue -> shutdown = 1;
+  pthread_cond_signal(&queue -> wakeup);
+  pthread_mutex_unlock(&queue -> lock);
+
+  pthread_join(queue -> thread, NULL);
+
+  queue_release(queue);
+#endif
+
+  free(queue);
+}
+
+/* Queues routine(args) on queue (NULL for the default queue, which  */
+/* runs with the library-wide thread settings).  size bytes of args  */
+/* are copied, so the caller's copy may go out of scope.             */
+blas_request_t *blas_async_submit(blas_async_queue_t *queue, void (*routine)(void *),
+				  const void *args, size_t size){
+
+  blas_request_t *req;
+
+  req = (blas_request_t *)malloc(REQUEST_HEAD + size);
+  if (req == NULL) return NULL;
+
+  req -> next     = NULL;
+  req -> routine  = routine;
+  req -> callback = NULL;
+  req -> data     = NULL;
+  req -> status   = REQUEST_QUEUED;
+
+  memcpy(REQUEST_ARGS(req), args, size);
+
+#ifdef ASYNC_THREADS
+  if (queue == NULL) {
+    pthread_mutex_lock(&queue_lock);
+    if (default_queue == NULL) {
+      pthread_mutex_unlock(&queue_lock);
+      queue = queue_create(0, 0);
+      pthread_mutex_lock(&queue_lock);
+      if (default_queue == NULL) {
+	default_queue = queue;
+	queue = NULL;
+      }
+    }
+    pthread_mutex_unlock(&queue_lock);
+    /* lost the race to another submitter */
+    if (queue) openblas_queue_destroy(queue);
+    queue = default_queue;
+  }
+
+  if (queue == NULL) {
+    free(req);
+    return NULL;
+  }
+
+  pthread_mutex_init(&req -> lock, NULL);
+  pthread_cond_init(&req -> finished, NULL);
+
+  pthread_mutex_lock(&queue -> lock);
+  if (queue -> tail) queue -> tail -> next = req;
+  else               queue -> head = req;
+  queue -> tail = req;
+  pthread_cond_signal(&queue -> wakeup);
+  pthread_mutex_unlock(&queue -> lock);
+#else
+  (void)queue;
+
+  (routine)(REQUEST_ARGS(req));
+  request_finish(req);
+#endif
+
+  return req;
+}
+
+int openblas_request_wait(blas_request_t *req){
+
+  if (req == NULL) return -1;
+
+#ifdef ASYNC_THREADS
+  pthread_mutex_lock(&req -> lock);
+  while (req -> status != REQUEST_DONE)
+    pthread_cond_wait(&req -> finished, &req -> lock);
+  pthread_mutex_unlock(&req -> lock);
+#endif
+
+  return 0;
+}
+
+/* 1 once the request and its callback have finished, 0 before */
+int openblas_request_test(blas_request_t *req){
+
+  int status;
+
+  if (req == NULL) return -1;
+
+#ifdef ASYNC_THREADS
+  pthread_mutex_lock(&req -> lock);
+  status = req -> status;
+  pthread_mutex_unlock(&req -> lock);
+#else
+  status = req -> status;
+#endif
+
+  return status == REQUEST_DONE;
+}
+
+/* The callback runs on the dispatcher when the request completes,  */
+/* or right away in the caller if it already has.  It must not wait */
+/* for its own request.                                             */
+int openblas_request_set_callback(blas_request_t *req,
+				  void (*callback)(blas_request_t *, void *), void *data){
+
+  if (req == NULL) return -1;
+
+#ifdef ASYNC_THREADS
+  pthread_mutex_lock(&req -> lock);
+  if (req -> status == REQUEST_QUEUED) {
+    req -> callback = callback;
+    req -> data     = data;
+    pthread_mutex_unlock(&req -> lock);
+    return 0;
+  }
+  pthread_mutex_unlock(&req -> lock);
+#endif
+
+  if (callback) (callback)(req, data);
+
+  return 0;
+}
+
+/* Waits for the request if it is still pending */
+void openblas_request_free(blas_request_t *req){
+
+  if (req == NULL) return;
+
+  openblas_request_wait(req);
+
+#ifdef ASYNC_THREADS
+  pthread_cond_destroy(&req -> finished);
+  pthread_mutex_destroy(&req -> lock);
+#endif
+
+  free(req);
+}
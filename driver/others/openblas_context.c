@@ -0,0 +1,216 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdlib.h>
+#include "common.h"
+
+/* Execution contexts.  A context carries its own thread count and, */
+/* for the pthreads server, the set of pool threads it may use.     */
+/* It is attached to the calling thread only, so concurrent callers */
+/* can run with different parallelism without touching the global   */
+/* blas_cpu_number.                                                 */
+
+#ifndef SMP
+typedef struct openblas_context {
+  int nthreads;
+} blas_context_t;
+#endif
+
+static BLAS_THREAD_LOCAL blas_context_t *current_context = NULL;
+
+blas_context_t *blas_get_context(void) { return current_context;}
+
+#ifdef SMP
+/* Pool threads held by a single context or queue.  Calls from such */
+/* a holder cannot collide with each other, so they run level 3     */
+/* without the global lock (see reserved in common_thread.h).       */
+#define CLAIM_CONTEXT	1
+#define CLAIM_QUEUE	2
+
+static volatile BLASULONG claim_lock = 0;
+static char cpu_claimed[MAX_CPU_NUMBER];
+
+/* Claims all of cpus[], or none if one of them is already held */
+int blas_cpu_claim(const int *cpus, int ncpus){
+
+  int i;
+
+  blas_lock(&claim_lock);
+
+  for (i = 0; i < ncpus; i++)
+    if (cpu_claimed[cpus[i]]) break;
+
+  if (i == ncpus)
+    for (i = 0; i < ncpus; i++) cpu_claimed[cpus[i]] = CLAIM_CONTEXT;
+
+  blas_unlock(&claim_lock);
+
+  return (i == ncpus) ? 0 : -1;
+}
+
+/* Claims up to want of the free threads below pool into cpus[] */
+/* for a queue, returns how many it got                          */
+int blas_cpu_claim_free(int *cpus, int want, int pool){
+
+  int i, k = 0;
+
+  if (pool > MAX_CPU_NUMBER) pool = MAX_CPU_NUMBER;
+
+  blas_lock(&claim_lock);
+
+  for (i = 0; (i < pool) && (k < want); i++) {
+    if (!cpu_claimed[i]) {
+      cpu_claimed[i] = CLAIM_QUEUE;
+      cpus[k ++] = i;
+    }
+  }
+
+  blas_unlock(&claim_lock);
+
+  return k;
+}
+
+void blas_cpu_release(const int *cpus, int ncpus){
+
+  int i;
+
+  blas_lock(&claim_lock);
+  for (i = 0; i < ncpus; i++) cpu_claimed[cpus[i]] = 0;
+  blas_unlock(&claim_lock);
+}
+
+/* For the child of a fork, where no dispatcher survives : frees the */
+/* threads held by queues, and the lock a parent thread may have held */
+void blas_cpu_release_queues(void){
+
+  int i;
+
+  claim_lock = 0;
+  for (i = 0; i < MAX_CPU_NUMBER; i++)
+    if (cpu_claimed[i] == CLAIM_QUEUE) cpu_claimed[i] = 0;
+}
+#endif
+
+blas_context_t *openblas_context_create(int num_threads){
+
+  blas_context_t *ctx = (blas_context_t *)malloc(sizeof(blas_context_t));
+
+  if (ctx == NULL) return NULL;
+
+  if (num_threads < 1) num_threads = 1;
+  if (num_threads > MAX_CPU_NUMBER) num_threads = MAX_CPU_NUMBER;
+
+  ctx -> nthreads = num_threads;
+#ifdef SMP
+  ctx -> ncpus    = 0;
+  ctx -> reserved = 0;
+#endif
+
+  return ctx;
+}
+
+void openblas_context_destroy(blas_context_t *ctx){
+
+  if (ctx == NULL) return;
+
+  if (current_context == ctx) current_context = NULL;
+
+#ifdef SMP
+  if (ctx -> reserved) blas_cpu_release(ctx -> cpu, ctx -> ncpus);
+#endif
+
+  free(ctx);
+}
+
+void openblas_context_set_num_threads(blas_context_t *ctx, int num_threads){
+
+  if (ctx == NULL) return;
+
+  if (num_threads < 1) num_threads = 1;
+  if (num_threads > MAX_CPU_NUMBER) num_threads = MAX_CPU_NUMBER;
+
+  ctx -> nthreads = num_threads;
+}
+
+int openblas_context_get_num_threads(blas_context_t *ctx){
+
+  if (ctx == NULL) return 0;
+
+  return ctx -> nthreads;
+}
+
+/* Restrict the context to the given pool threads (0 .. n - 2 for a */
+/* pool of n threads; the caller always takes part itself).  Passing */
+/* ncpus = 0 lets the context use any pool thread again.  Threads    */
+/* no other context or queue holds are claimed for this context, so */
+/* contexts on disjoint sets run level 3 side by side; a set that    */
+/* overlaps another one is shared and takes the global lock.        */
+int openblas_context_set_cpus(blas_context_t *ctx, const int *cpus, int ncpus){
+
+  int i;
+#ifdef SMP
+  int j, k = 0;
+#endif
+
+  if (ctx == NULL || ncpus < 0 || (ncpus > 0 && cpus == NULL)) return -1;
+
+  for (i = 0; i < ncpus; i++)
+    if (cpus[i] < 0 || cpus[i] >= MAX_CPU_NUMBER) return -1;
+
+#ifdef SMP
+  if (ctx -> reserved) blas_cpu_release(ctx -> cpu, ctx -> ncpus);
+
+  for (i = 0; i < ncpus; i++) {
+    for (j = 0; j < k; j++) if (ctx -> cpu[j] == cpus[i]) break;
+    if (j == k) ctx -> cpu[k ++] = cpus[i];
+  }
+
+  ctx -> ncpus    = k;
+  ctx -> reserved = (k > 0) && (blas_cpu_claim(ctx -> cpu, k) == 0);
+#endif
+
+  return 0;
+}
+
+/* Attach ctx to the calling thread (NULL detaches); returns the    */
+/* previous context so that callers can nest.                       */
+blas_context_t *openblas_set_context(blas_context_t *ctx){
+
+  blas_context_t *prev = current_context;
+
+  current_context = ctx;
+
+  return prev;
+}
+
+blas_context_t *openblas_get_context(void) { return current_context;}
@@ -39,6 +39,11 @@ static int openblas_env_block_factor=0;
 static int openblas_env_openblas_num_threads=0;
 static int openblas_env_goto_num_threads=0;
 static int openblas_env_omp_num_threads=0;
+static int openblas_env_work_stealing=0;
+static int openblas_env_numa_level3=0;
+static int openblas_env_reproducible=0;
+static long openblas_env_stream_threshold=0;
+static int openblas_env_tiled_lapack=0;
 
 int openblas_verbose() { return openblas_env_verbose;}
 unsigned int openblas_thread_timeout() { return openblas_env_thread_timeout;}
@@ -46,6 +51,36 @@ int openblas_block_factor() { return openblas_env_block_factor;}
 int openblas_num_threads_env() { return openblas_env_openblas_num_threads;}
 int openblas_goto_num_threads_env() { return openblas_env_goto_num_threads;}
 int openblas_omp_num_threads_env() { return openblas_env_omp_num_threads;}
+int openblas_work_stealing() { return openblas_env_work_stealing;}
+int openblas_numa_level3() { return openblas_env_numa_level3;}
+int openblas_reproducible() { return openblas_env_reproducible;}
+long openblas_stream_threshold_env() { return openblas_env_stream_threshold;}
+int openblas_tiled_lapack() { return openblas_env_tiled_lapack;}
+
+/* Runtime switch between the work-stealing and the static scheduler */
+void openblas_set_work_stealing(int enable) {
+#ifdef USE_WORK_STEALING
+  openblas_env_work_stealing = (enable != 0);
+#endif
+}
+
+int openblas_get_work_stealing(void) { return openblas_env_work_stealing;}
+
+/* Runtime switch for the node-local layout of the threaded level 3 drivers; */
+/* above 1, the number of thread groups to use instead of the node count     */
+void openblas_set_numa_level3(int enable) { openblas_env_numa_level3 = (enable > 0) ? enable : 0;}
+
+int openblas_get_numa_level3(void) { return openblas_env_numa_level3;}
+
+/* Runtime switch for results that do not depend on the thread count */
+void openblas_set_reproducible(int enable) { openblas_env_reproducible = (enable != 0);}
+
+int openblas_get_reproducible(void) { return openblas_env_reproducible;}
+
+/* Runtime choice of the task-DAG drivers for getrf, potrf and geqrf */
+void openblas_set_tiled_lapack(int mode) { if ((mode >= 0) && (mode <= 2)) openblas_env_tiled_lapack = mode;}
+
+int openblas_get_tiled_lapack(void) { return openblas_env_tiled_lapack;}
 
 void openblas_read_env() {
   int ret=0;
@@ -79,6 +114,33 @@ void openblas_read_env() {
   if(ret<0) ret=0;
   openblas_env_omp_num_threads=ret;
 
+#ifdef USE_WORK_STEALING
+  ret=0;
+  if (readenv(p,"OPENBLAS_WORK_STEALING")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_work_stealing=(ret != 0);
+#endif
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_NUMA_LEVEL3")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_numa_level3=ret;
+
+  ret=0;
+  if (readenv(p,"OPENBLAS_REPRODUCIBLE")) ret = atoi(p);
+  if(ret<0) ret=0;
+  openblas_env_reproducible=(ret != 0);
+
+  /* 0 fork-join drivers, 1 tiled for large orders, 2 tiled always */
+  ret=0;
+  if (readenv(p,"OPENBLAS_TILED_LAPACK")) ret = atoi(p);
+  if((ret<0) || (ret>2)) ret=0;
+  openblas_env_tiled_lapack=ret;
+
+  /* bytes, 0 for the LLC size, negative for no non-temporal stores */
+  openblas_env_stream_threshold=0;
+  if (readenv(p,"OPENBLAS_STREAM_THRESHOLD")) openblas_env_stream_threshold = atol(p);
+
 }
 
 
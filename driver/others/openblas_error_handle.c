@@ -33,8 +33,6 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "common.h"
 
-extern int openblas_verbose();
-
 void openblas_warning(int verbose, const char * msg) {
   int current_verbose;
   current_verbose=openblas_verbose();
@@ -0,0 +1,434 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef OS_WINDOWS
+#include <time.h>
+#endif
+#include "common.h"
+
+/* Blocking profiles.  openblas_autotune() sweeps GEMM_P, GEMM_Q and  */
+/* SWITCH_RATIO for s, d, c and z on the running CPU and writes the   */
+/* winners to a text file under a key made of the core name and the  */
+/* CPUID signature; blas_load_profile() applies the section matching  */
+/* this CPU from $OPENBLAS_PROFILE when the memory system initialises. */
+/*                                                                    */
+/*   [HASWELL GenuineIntel 000306f2]                                  */
+/*   dgemm  P  Q  R  SWITCH_RATIO                                     */
+/*                                                                    */
+/* A zero field keeps the built-in value.  GEMM_R is not swept; it is */
+/* recomputed from P and Q the way parameter.c sizes it.  Blocking is */
+/* only changed where the drivers read it at run time, which          */
+/* common_param.h flags with GEMM_BLOCKING_RUNTIME (DYNAMIC_ARCH).   */
+
+#define NUM_PREC	4
+#define MAX_KEY		128
+#define MAX_LINE	256
+
+#ifdef GEMM_BLOCKING_RUNTIME
+#define SET_BLOCKING(x, P, Q, R) { gotoblas -> x##gemm_p = (P); gotoblas -> x##gemm_q = (Q); gotoblas -> x##gemm_r = (R); }
+#endif
+
+typedef struct {
+  BLASLONG p, q, r;
+  int ratio;
+} profile_t;
+
+static const char *prec_name[NUM_PREC] = {"sgemm", "dgemm", "cgemm", "zgemm"};
+static const int   prec_size[NUM_PREC] = {4, 8, 8, 16};
+
+/* Read by the threaded level 3 driver; zero keeps SWITCH_RATIO */
+int blas_switch_ratio[NUM_PREC] = {0, 0, 0, 0};
+
+extern char *openblas_get_corename(void);
+#ifdef SMP
+extern blas_context_t *openblas_set_context(blas_context_t *);
+#endif
+
+static void get_blocking(int prec, BLASLONG *p, BLASLONG *q, BLASLONG *unroll){
+
+  switch (prec) {
+  case 0 : *p = SGEMM_P; *q = SGEMM_Q; *unroll = SGEMM_UNROLL_M; break;
+  case 1 : *p = DGEMM_P; *q = DGEMM_Q; *unroll = DGEMM_UNROLL_M; break;
+  case 2 : *p = CGEMM_P; *q = CGEMM_Q; *unroll = CGEMM_UNROLL_M; break;
+  default: *p = ZGEMM_P; *q = ZGEMM_Q; *unroll = ZGEMM_UNROLL_M; break;
+  }
+}
+
+static int blocking_runtime(int prec){
+
+#ifdef GEMM_BLOCKING_RUNTIME
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+/* Largest GEMM_R whose B panel still fits the buffer next to A */
+static BLASLONG max_r(int prec, BLASLONG p, BLASLONG q){
+
+  BLASLONG size = prec_size[prec];
+  BLASLONG a = (p * q * size + GEMM_OFFSET_A + GEMM_ALIGN) & ~GEMM_ALIGN;
+
+  if (a + GEMM_OFFSET_B >= BUFFER_SIZE) return 0;
+
+  return (((BUFFER_SIZE - a - GEMM_OFFSET_B) / (q * size)) - 15) & ~15;
+}
+
+static int set_blocking(int prec, BLASLONG p, BLASLONG q, BLASLONG r){
+
+  BLASLONG p0, q0, unroll;
+
+  get_blocking(prec, &p0, &q0, &unroll);
+
+  if ((p <= 0) || (q <= 0) || (p % unroll)) return -1;
+  if (r <= 0) r = max_r(prec, p, q);
+  if ((r < 16) || (r > max_r(prec, p, q))) return -1;
+
+#ifdef GEMM_BLOCKING_RUNTIME
+  switch (prec) {
+  case 0 : SET_BLOCKING(s, p, q, r); return 0;
+  case 1 : SET_BLOCKING(d, p, q, r); return 0;
+  case 2 : SET_BLOCKING(c, p, q, r); return 0;
+  case 3 : SET_BLOCKING(z, p, q, r); return 0;
+  }
+#endif
+  return -1;
+}
+
+static BLASLONG get_r(int prec){
+
+  switch (prec) {
+  case 0 : return SGEMM_R;
+  case 1 : return DGEMM_R;
+  case 2 : return CGEMM_R;
+  default: return ZGEMM_R;
+  }
+}
+
+static void profile_key(char *key, int len){
+
+#if defined(ARCH_X86) || defined(ARCH_X86_64)
+  int eax, ebx, ecx, edx;
+  char vendor[13];
+
+  cpuid(0, &eax, &ebx, &ecx, &edx);
+  memcpy(vendor + 0, &ebx, 4);
+  memcpy(vendor + 4, &edx, 4);
+  memcpy(vendor + 8, &ecx, 4);
+  vendor[12] = 0;
+
+  cpuid(1, &eax, &ebx, &ecx, &edx);
+
+  snprintf(key, len, "[%s %s %08x]", openblas_get_corename(), vendor, eax);
+#else
+  snprintf(key, len, "[%s]", openblas_get_corename());
+#endif
+}
+
+static char *profile_path(const char *path){
+
+  static env_var_t p;
+
+  if (path != NULL) return (char *)path;
+  if (readenv(p, "OPENBLAS_PROFILE")) return p;
+  return NULL;
+}
+
+static void apply_profile(profile_t *prof){
+
+  int prec;
+
+  for (prec = 0; prec < NUM_PREC; prec ++) {
+    if ((prof[prec].p > 0) || (prof[prec].q > 0)) {
+      BLASLONG p, q, unroll;
+
+      get_blocking(prec, &p, &q, &unroll);
+      if (prof[prec].p > 0) p = prof[prec].p;
+      if (prof[prec].q > 0) q = prof[prec].q;
+
+      if (set_blocking(prec, p, q, prof[prec].r) && (openblas_verbose() >= 2))
+	fprintf(stderr, "OpenBLAS : profile entry for %s ignored\n", prec_name[prec]);
+    }
+    if (prof[prec].ratio >= 0) blas_switch_ratio[prec] = prof[prec].ratio;
+  }
+}
+
+void blas_load_profile(void){
+
+  char key[MAX_KEY], line[MAX_LINE], name[16];
+  char *path = profile_path(NULL);
+  profile_t prof[NUM_PREC];
+  int prec, found = 0;
+  long p, q, r;
+  int ratio;
+  FILE *fp;
+
+  if (path == NULL) return;
+  if ((fp = fopen(path, "r")) == NULL) return;
+
+  profile_key(key, sizeof(key));
+
+  for (prec = 0; prec < NUM_PREC; prec ++) {
+    prof[prec].p = prof[prec].q = prof[prec].r = 0;
+    prof[prec].ratio = -1;
+  }
+
+  while (fgets(line, sizeof(line), fp)) {
+    if (line[0] == '[') {
+      if (found) break;
+      found = !strncmp(line, key, strlen(key));
+      continue;
+    }
+    if (!found) continue;
+    if (sscanf(line, "%15s %ld %ld %ld %d", name, &p, &q, &r, &ratio) != 5) continue;
+
+    for (prec = 0; prec < NUM_PREC; prec ++) {
+      if (!strcmp(name, prec_name[prec])) {
+	prof[prec].p = p;
+	prof[prec].q = q;
+	prof[prec].r = r;
+	prof[prec].ratio = ratio;
+      }
+    }
+  }
+
+  fclose(fp);
+
+  if (found) apply_profile(prof);
+}
+
+/* Copies every section but ours, then appends ours */
+static int write_profile(const char *path, profile_t *prof){
+
+  char key[MAX_KEY], line[MAX_LINE], *tmp;
+  FILE *in, *out;
+  int prec, skip = 0;
+
+  profile_key(key, sizeof(key));
+
+  tmp = (char *)malloc(strlen(path) + 5);
+  if (tmp == NULL) return -1;
+  sprintf(tmp, "%s.tmp", path);
+
+  if ((out = fopen(tmp, "w")) == NULL) {
+    free(tmp);
+    return -1;
+  }
+
+  if ((in = fopen(path, "r")) != NULL) {
+    while (fgets(line, sizeof(line), in)) {
+      if (line[0] == '[') skip = !strncmp(line, key, strlen(key));
+      if (!skip) fputs(line, out);
+    }
+    fclose(in);
+  } else {
+    fprintf(out, "# OpenBLAS blocking profile: name P Q R SWITCH_RATIO, 0 keeps the default\n");
+  }
+
+  fprintf(out, "%s\n", key);
+  for (prec = 0; prec < NUM_PREC; prec ++)
+    fprintf(out, "%s %ld %ld %ld %d\n", prec_name[prec],
+	    (long)prof[prec].p, (long)prof[prec].q, (long)prof[prec].r, prof[prec].ratio);
+
+  if (fclose(out) || rename(tmp, path)) {
+    remove(tmp);
+    free(tmp);
+    return -1;
+  }
+
+  free(tmp);
+  return 0;
+}
+
+static double profile_clock(void){
+
+#ifdef OS_WINDOWS
+  LARGE_INTEGER count, freq;
+
+  QueryPerformanceCounter(&count);
+  QueryPerformanceFrequency(&freq);
+  return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1.e-9;
+#endif
+}
+
+/* Best of three runs of C = A * B, all column major and packed */
+static double time_gemm(int prec, blasint m, blasint n, blasint k,
+			void *a, void *b, void *c){
+
+  char trans = 'N';
+  float  salpha[2] = {1.f, 0.f}, sbeta[2] = {0.f, 0.f};
+  double dalpha[2] = {1.0, 0.0}, dbeta[2] = {0.0, 0.0};
+  double start, best = 1.e30;
+  int i;
+
+  for (i = 0; i < 3; i ++) {
+    start = profile_clock();
+    switch (prec) {
+    case 0 : BLASFUNC(sgemm)(&trans, &trans, &m, &n, &k, salpha, a, &m, b, &k, sbeta, c, &m); break;
+    case 1 : BLASFUNC(dgemm)(&trans, &trans, &m, &n, &k, dalpha, a, &m, b, &k, dbeta, c, &m); break;
+    case 2 : BLASFUNC(cgemm)(&trans, &trans, &m, &n, &k, salpha, a, &m, b, &k, sbeta, c, &m); break;
+    default: BLASFUNC(zgemm)(&trans, &trans, &m, &n, &k, dalpha, a, &m, b, &k, dbeta, c, &m); break;
+    }
+    start = profile_clock() - start;
+    if (start < best) best = start;
+  }
+
+  return best;
+}
+
+/* Sweeps P and Q around the built-in values on one thread */
+static void tune_blocking(int prec, profile_t *prof, void *a, void *b, void *c,
+			  blasint m, blasint n, blasint k){
+
+  static const int scale[] = {2, 3, 4, 5, 6};
+  BLASLONG p0, q0, unroll, p, q, best_p, best_q;
+  double t, best;
+  int i, j;
+
+  get_blocking(prec, &p0, &q0, &unroll);
+  best_p = p0;
+  best_q = q0;
+  best = time_gemm(prec, m, n, k, a, b, c);
+
+  for (i = 0; i < 5; i ++) {
+    for (j = 0; j < 5; j ++) {
+      p = (p0 * scale[i] / 4 + unroll - 1) / unroll * unroll;
+      q = (q0 * scale[j] / 4 + 7) & ~7;
+      if (set_blocking(prec, p, q, 0)) continue;
+
+      t = time_gemm(prec, m, n, k, a, b, c);
+      if (t < best) {
+	best   = t;
+	best_p = p;
+	best_q = q;
+      }
+    }
+  }
+
+  set_blocking(prec, best_p, best_q, 0);
+
+  prof -> p = best_p;
+  prof -> q = best_q;
+  prof -> r = get_r(prec);
+}
+
+/* Sweeps SWITCH_RATIO on shapes where the m/n split matters */
+static void tune_ratio(int prec, profile_t *prof, void *a, void *b, void *c){
+
+  static const int ratio[] = {2, 4, 8, 16, 32, 64};
+  static const blasint shape[][3] = {{256, 2048, 256}, {2048, 256, 256}, {1024, 1024, 256}};
+  double t, best = 1.e30;
+  int i, j, best_ratio = 0;
+
+  for (i = 0; i < 6; i ++) {
+    blas_switch_ratio[prec] = ratio[i];
+    t = 0.;
+    for (j = 0; j < 3; j ++)
+      t += time_gemm(prec, shape[j][0], shape[j][1], shape[j][2], a, b, c);
+    if (t < best) {
+      best       = t;
+      best_ratio = ratio[i];
+    }
+  }
+
+  blas_switch_ratio[prec] = best_ratio;
+  prof -> ratio = best_ratio;
+}
+
+int openblas_autotune(const char *path){
+
+  profile_t prof[NUM_PREC];
+  BLASLONG p0, q0, unroll, len;
+  blasint m, n, k;
+  void *a, *b, *c;
+  int prec;
+#ifdef SMP
+  blas_context_t single = {0}, *saved;
+#endif
+
+  path = profile_path(path);
+  if (path == NULL) return -1;
+
+  for (prec = 0; prec < NUM_PREC; prec ++) {
+    get_blocking(prec, &p0, &q0, &unroll);
+
+    /* Twice the built-in panels, so every candidate is exercised; */
+    /* the buffers also hold the largest SWITCH_RATIO shape        */
+    m = 2 * p0;
+    k = 2 * q0;
+    n = 512;
+    len = MAX((BLASLONG)m * (k + n), 1L << 20) * prec_size[prec];
+
+    a = calloc(1, len);
+    b = calloc(1, len);
+    c = calloc(1, len);
+    if ((a == NULL) || (b == NULL) || (c == NULL)) {
+      free(a); free(b); free(c);
+      return -1;
+    }
+
+    prof[prec].p = prof[prec].q = prof[prec].r = 0;
+    prof[prec].ratio = 0;
+
+    if (blocking_runtime(prec)) {
+#ifdef SMP
+      single.nthreads = 1;
+      single.ncpus    = 0;
+      saved = openblas_set_context(&single);
+#endif
+      tune_blocking(prec, &prof[prec], a, b, c, m, n, k);
+#ifdef SMP
+      openblas_set_context(saved);
+#endif
+    }
+
+#ifdef SMP
+    if (blas_cpu_number > 1) tune_ratio(prec, &prof[prec], a, b, c);
+#endif
+
+    if (openblas_verbose() >= 2)
+      fprintf(stderr, "OpenBLAS : %s tuned to P %ld Q %ld R %ld ratio %d\n", prec_name[prec],
+	      (long)prof[prec].p, (long)prof[prec].q, (long)prof[prec].r, prof[prec].ratio);
+
+    free(a); free(b); free(c);
+  }
+
+  return write_profile(path, prof);
+}
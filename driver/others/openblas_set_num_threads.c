@@ -50,4 +50,11 @@ void openblas_set_num_threads(int num_threads) {
 void openblas_set_num_threads_(int* num_threads){
 
 }
+
+void openblas_park_threads(void) {
+}
+
+double openblas_get_wakeup_latency(void) {
+	return 0.;
+}
 #endif
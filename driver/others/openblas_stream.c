@@ -0,0 +1,140 @@
+/***************************************************************************
+Copyright (c) 2011-2016,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include "common.h"
+
+/* Output size of one kernel call from which the x86_64 copy, scal    */
+/* and axpby kernels write with non-temporal stores : past            */
+/* the last level cache the data cannot stay cached anyway, and the   */
+/* streaming stores save the read for ownership and do not evict what */
+/* the caller still uses.  OPENBLAS_STREAM_THRESHOLD or               */
+/* openblas_set_stream_threshold() override the detected LLC size.    */
+
+#define STREAM_NEVER	((size_t) -1)
+
+extern long openblas_stream_threshold_env(void);
+
+static size_t stream_threshold = 0;
+
+#if defined(ARCH_X86_64) || defined(ARCH_X86)
+
+static void cpuid_count(int op, int count, int *eax, int *ebx, int *ecx, int *edx){
+
+#ifdef C_MSVC
+  int cpuinfo[4];
+  __cpuidex(cpuinfo, op, count);
+  *eax = cpuinfo[0];
+  *ebx = cpuinfo[1];
+  *ecx = cpuinfo[2];
+  *edx = cpuinfo[3];
+#else
+  __asm__ __volatile__("cpuid"
+		       : "=a" (*eax), "=b" (*ebx), "=c" (*ecx), "=d" (*edx)
+		       : "0" (op), "2" (count));
+#endif
+}
+
+/* Largest data or unified cache in the deterministic cache parameters */
+/* of leaf 4 (Intel) or 0x8000001d (AMD)                               */
+static size_t cache_leaf_size(int leaf){
+
+  int eax, ebx, ecx, edx, i, type;
+  size_t size, best = 0;
+
+  for (i = 0; i < 16; i++) {
+    cpuid_count(leaf, i, &eax, &ebx, &ecx, &edx);
+    type = eax & 0x1f;
+    if (type == 0) break;
+    if (type != 1 && type != 3) continue;
+    size = (size_t)((ebx >> 22) + 1) * (size_t)(((ebx >> 12) & 0x3ff) + 1)
+	 * (size_t)((ebx & 0xfff) + 1) * (size_t)((unsigned int)ecx + 1);
+    if (size > best) best = size;
+  }
+
+  return best;
+}
+
+static size_t llc_size(void){
+
+  int eax, ebx, ecx, edx, max_ext;
+  size_t size = 0;
+
+  cpuid_count(0, 0, &eax, &ebx, &ecx, &edx);
+  if (eax >= 4) size = cache_leaf_size(4);
+  if (size > 0) return size;
+
+  cpuid_count(0x80000000, 0, &eax, &ebx, &ecx, &edx);
+  max_ext = eax;
+  if ((unsigned int)max_ext >= 0x8000001d) size = cache_leaf_size(0x8000001d);
+  if (size > 0) return size;
+
+  if ((unsigned int)max_ext >= 0x80000006) {
+    cpuid_count(0x80000006, 0, &eax, &ebx, &ecx, &edx);
+    size = (size_t)((edx >> 18) & 0x3fff) * 512 * 1024;
+    if (size == 0) size = (size_t)((ecx >> 16) & 0xffff) * 1024;
+  }
+
+  return size;
+}
+
+#else
+
+static size_t llc_size(void){
+  return 0;
+}
+
+#endif
+
+size_t openblas_get_stream_threshold(void){
+
+  size_t threshold = stream_threshold;
+  long env;
+
+  if (threshold == 0) {
+    env = openblas_stream_threshold_env();
+    if (env < 0)
+      threshold = STREAM_NEVER;
+    else if (env > 0)
+      threshold = (size_t)env;
+    else
+      threshold = llc_size();
+    if (threshold == 0) threshold = STREAM_NEVER;
+    stream_threshold = threshold;
+  }
+
+  return threshold;
+}
+
+void openblas_set_stream_threshold(size_t bytes){
+  stream_threshold = bytes;
+}
@@ -0,0 +1,66 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+#include <stdio.h>
+#include "common.h"
+
+/* Thread-count model for the threaded interfaces.  A call of W      */
+/* multiply-adds (packing counted in the same unit) run on p threads */
+/* costs about  a * W / p + o * p,  a being the time per multiply-add */
+/* and o the dispatch and synchronisation cost of one more thread.   */
+/* Adding thread p + 1 pays off while  W / (p * (p + 1)) > o / a.    */
+/* The caller passes the work at which a second thread starts to pay */
+/* off (the old fixed cutoff), which is  2 * o / a.                  */
+
+static BLAS_THREAD_LOCAL int last_threads = 1;
+
+int blas_model_threads(const char *name, double work, double pack,
+		       double threshold, int nmax){
+
+  double total = work + pack;
+  int nthreads = 1;
+
+  while ((nthreads < nmax) && (total > 0.5 * threshold * (double)nthreads * (double)(nthreads + 1)))
+    nthreads ++;
+
+  last_threads = nthreads;
+
+  if (openblas_verbose() >= 2)
+    fprintf(stderr, "OpenBLAS : %s work %.0f pack %.0f : %d of %d threads\n",
+	    name, work, pack, nthreads, nmax);
+
+  return nthreads;
+}
+
+int openblas_get_last_num_threads(void){
+  return last_threads;
+}
@@ -42,6 +42,49 @@
 #include "functable.h"
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int asum_chunk(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *dummy, BLASLONG dummy1,
+		      blas_reduce_t *result){
+
+  result -> value[0] = (double)ASUM_K(n, x, incx);
+
+  return 0;
+}
+#endif
+
+static FLOAT asum_compute(BLASLONG n, FLOAT *x, BLASLONG incx){
+
+#if defined(SMP) && !defined(XDOUBLE)
+  blas_reduce_t result;
+  int mode, nthreads = 1;
+
+  if ((incx > 0) && (n > ASUM_REDUCE_THRESHOLD))
+    nthreads = blas_model_threads("ASUM", (double)n * COMPSIZE, 0., ASUM_REDUCE_THRESHOLD, num_cpu_avail(1));
+
+  /* reproducible mode always goes through the fixed chunking */
+  if ((nthreads > 1) || (openblas_reproducible() && (n > BLAS_REDUCE_REPRO_CHUNK) && (incx > 0))) {
+
+#ifdef DOUBLE
+    mode  =  BLAS_DOUBLE;
+#else
+    mode  =  BLAS_SINGLE;
+#endif
+#ifndef COMPLEX
+    mode |=  BLAS_REAL;
+#else
+    mode |=  BLAS_COMPLEX;
+#endif
+
+    blas_level1_reduce(mode, BLAS_REDUCE_SUM, n, x, incx, NULL, 0,
+		       (void *)asum_chunk, &result, nthreads);
+
+    return (FLOAT)result.value[0];
+  }
+#endif
+
+  return ASUM_K(n, x, incx);
+}
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -58,7 +101,7 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
-  ret = (FLOATRET)ASUM_K(n, x, incx);
+  ret = (FLOATRET)asum_compute(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, n);
 
@@ -85,7 +128,7 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
-  ret = ASUM_K(n, x, incx);
+  ret = asum_compute(n, x, incx);
 
   FUNCTION_PROFILE_END(COMPSIZE, n, n);
 
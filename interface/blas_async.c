@@ -0,0 +1,201 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Asynchronous CBLAS calls : cblas_?gemm_async, cblas_?gemv_async  */
+/* (-DGEMV) and cblas_?trsm_async (-DTRSM).  The arguments are saved */
+/* in a request that runs the blocking call on the queue's           */
+/* dispatcher (see driver/others/openblas_async.c), so argument      */
+/* errors reach xerbla only when the request runs.                   */
+
+#ifdef DOUBLE
+#define CBLAS_GEMM cblas_dgemm
+#define CBLAS_GEMV cblas_dgemv
+#define CBLAS_TRSM cblas_dtrsm
+#else
+#define CBLAS_GEMM cblas_sgemm
+#define CBLAS_GEMV cblas_sgemv
+#define CBLAS_TRSM cblas_strsm
+#endif
+
+#if defined(GEMV)
+
+typedef struct {
+  enum CBLAS_ORDER order;
+  enum CBLAS_TRANSPOSE trans;
+  blasint m, n;
+  FLOAT alpha, *a;
+  blasint lda;
+  FLOAT *x;
+  blasint incx;
+  FLOAT beta, *y;
+  blasint incy;
+} async_args_t;
+
+static void async_routine(void *p){
+
+  async_args_t *args = (async_args_t *)p;
+
+  CBLAS_GEMV(args -> order, args -> trans, args -> m, args -> n,
+	     args -> alpha, args -> a, args -> lda, args -> x, args -> incx,
+	     args -> beta, args -> y, args -> incy);
+}
+
+blas_request_t *CNAME(blas_async_queue_t *queue, enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE trans,
+		      blasint m, blasint n, FLOAT alpha, FLOAT *a, blasint lda,
+		      FLOAT *x, blasint incx, FLOAT beta, FLOAT *y, blasint incy) {
+
+  async_args_t args;
+
+  PRINT_DEBUG_CNAME;
+
+  args.order = order;
+  args.trans = trans;
+  args.m     = m;
+  args.n     = n;
+  args.alpha = alpha;
+  args.a     = a;
+  args.lda   = lda;
+  args.x     = x;
+  args.incx  = incx;
+  args.beta  = beta;
+  args.y     = y;
+  args.incy  = incy;
+
+  return blas_async_submit(queue, async_routine, &args, sizeof(args));
+}
+
+#elif defined(TRSM)
+
+typedef struct {
+  enum CBLAS_ORDER order;
+  enum CBLAS_SIDE side;
+  enum CBLAS_UPLO uplo;
+  enum CBLAS_TRANSPOSE trans;
+  enum CBLAS_DIAG diag;
+  blasint m, n;
+  FLOAT alpha, *a;
+  blasint lda;
+  FLOAT *b;
+  blasint ldb;
+} async_args_t;
+
+static void async_routine(void *p){
+
+  async_args_t *args = (async_args_t *)p;
+
+  CBLAS_TRSM(args -> order, args -> side, args -> uplo, args -> trans, args -> diag,
+	     args -> m, args -> n, args -> alpha, args -> a, args -> lda,
+	     args -> b, args -> ldb);
+}
+
+blas_request_t *CNAME(blas_async_queue_t *queue, enum CBLAS_ORDER order, enum CBLAS_SIDE side,
+		      enum CBLAS_UPLO uplo, enum CBLAS_TRANSPOSE trans, enum CBLAS_DIAG diag,
+		      blasint m, blasint n, FLOAT alpha, FLOAT *a, blasint lda,
+		      FLOAT *b, blasint ldb) {
+
+  async_args_t args;
+
+  PRINT_DEBUG_CNAME;
+
+  args.order = order;
+  args.side  = side;
+  args.uplo  = uplo;
+  args.trans = trans;
+  args.diag  = diag;
+  args.m     = m;
+  args.n     = n;
+  args.alpha = alpha;
+  args.a     = a;
+  args.lda   = lda;
+  args.b     = b;
+  args.ldb   = ldb;
+
+  return blas_async_submit(queue, async_routine, &args, sizeof(args));
+}
+
+#else
+
+typedef struct {
+  enum CBLAS_ORDER order;
+  enum CBLAS_TRANSPOSE transa, transb;
+  blasint m, n, k;
+  FLOAT alpha, *a;
+  blasint lda;
+  FLOAT *b;
+  blasint ldb;
+  FLOAT beta, *c;
+  blasint ldc;
+} async_args_t;
+
+static void async_routine(void *p){
+
+  async_args_t *args = (async_args_t *)p;
+
+  CBLAS_GEMM(args -> order, args -> transa, args -> transb,
+	     args -> m, args -> n, args -> k,
+	     args -> alpha, args -> a, args -> lda, args -> b, args -> ldb,
+	     args -> beta, args -> c, args -> ldc);
+}
+
+blas_request_t *CNAME(blas_async_queue_t *queue, enum CBLAS_ORDER order,
+		      enum CBLAS_TRANSPOSE transa, enum CBLAS_TRANSPOSE transb,
+		      blasint m, blasint n, blasint k,
+		      FLOAT alpha, FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+		      FLOAT beta, FLOAT *c, blasint ldc) {
+
+  async_args_t args;
+
+  PRINT_DEBUG_CNAME;
+
+  args.order  = order;
+  args.transa = transa;
+  args.transb = transb;
+  args.m      = m;
+  args.n      = n;
+  args.k      = k;
+  args.alpha  = alpha;
+  args.a      = a;
+  args.lda    = lda;
+  args.b      = b;
+  args.ldb    = ldb;
+  args.beta   = beta;
+  args.c      = c;
+  args.ldc    = ldc;
+
+  return blas_async_submit(queue, async_routine, &args, sizeof(args));
+}
+
+#endif
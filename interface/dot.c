@@ -42,6 +42,44 @@
 #include "functable.h"
 #endif
 
+#if defined(SMP) && !defined(XDOUBLE)
+static int dot_chunk(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy,
+		     blas_reduce_t *result){
+
+  result -> value[0] = (double)DOTU_K(n, x, incx, y, incy);
+
+  return 0;
+}
+#endif
+
+static FLOAT dot_compute(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy){
+
+#if defined(SMP) && !defined(XDOUBLE)
+  blas_reduce_t result;
+  int mode, nthreads = 1;
+
+  if (n > DOT_REDUCE_THRESHOLD)
+    nthreads = blas_model_threads("DOT", (double)n, 0., DOT_REDUCE_THRESHOLD, num_cpu_avail(1));
+
+  /* reproducible mode always goes through the fixed chunking */
+  if ((nthreads > 1) || (openblas_reproducible() && (n > BLAS_REDUCE_REPRO_CHUNK))) {
+
+#ifdef DOUBLE
+    mode  =  BLAS_DOUBLE | BLAS_REAL;
+#else
+    mode  =  BLAS_SINGLE | BLAS_REAL;
+#endif
+
+    blas_level1_reduce(mode, BLAS_REDUCE_SUM, n, x, incx, y, incy,
+		       (void *)dot_chunk, &result, nthreads);
+
+    return (FLOAT)result.value[0];
+  }
+#endif
+
+  return DOTU_K(n, x, incx, y, incy);
+}
+
 #ifndef CBLAS
 
 FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
@@ -62,7 +100,7 @@ FLOATRET NAME(blasint *N, FLOAT *x, blasint *INCX, FLOAT *y, blasint *INCY){
   if (incx < 0) x -= (n - 1) * incx;
   if (incy < 0) y -= (n - 1) * incy;
 
-  ret = (FLOATRET)DOTU_K(n, x, incx, y, incy);
+  ret = (FLOATRET)dot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(1, 2 * n, 2 * n);
 
@@ -88,7 +126,7 @@ FLOAT CNAME(blasint n, FLOAT *x, blasint incx, FLOAT *y, blasint incy){
   if (incx < 0) x -= (n - 1) * incx;
   if (incy < 0) y -= (n - 1) * incy;
 
-  ret = DOTU_K(n, x, incx, y, incy);
+  ret = dot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(1, 2 * n, 2 * n);
 
@@ -399,6 +399,33 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 
   if ((args.m == 0) || (args.n == 0)) return;
 
+#if !defined(COMPLEX) && !defined(XDOUBLE)
+  /* tiny problems: skip buffer acquisition and packing altogether */
+  /* alpha == 0 must not touch A and B, the level 3 driver only scales C */
+  if ((args.m <= GEMM_SMALL_THRESHOLD) && (args.n <= GEMM_SMALL_THRESHOLD) && (args.k <= GEMM_SMALL_THRESHOLD)
+      && (*(FLOAT *)args.alpha != ZERO)) {
+
+    FLOAT alpha_r = *(FLOAT *)args.alpha;
+    FLOAT beta_r  = *(FLOAT *)args.beta;
+
+    switch ((transb << 1) | transa) {
+    case 0:
+      GEMM_SMALL_KERNEL_NN(args.m, args.n, args.k, alpha_r, (FLOAT *)args.a, args.lda, (FLOAT *)args.b, args.ldb, beta_r, (FLOAT *)args.c, args.ldc);
+      break;
+    case 1:
+      GEMM_SMALL_KERNEL_TN(args.m, args.n, args.k, alpha_r, (FLOAT *)args.a, args.lda, (FLOAT *)args.b, args.ldb, beta_r, (FLOAT *)args.c, args.ldc);
+      break;
+    case 2:
+      GEMM_SMALL_KERNEL_NT(args.m, args.n, args.k, alpha_r, (FLOAT *)args.a, args.lda, (FLOAT *)args.b, args.ldb, beta_r, (FLOAT *)args.c, args.ldc);
+      break;
+    default:
+      GEMM_SMALL_KERNEL_TT(args.m, args.n, args.k, alpha_r, (FLOAT *)args.a, args.lda, (FLOAT *)args.b, args.ldb, beta_r, (FLOAT *)args.c, args.ldc);
+      break;
+    }
+    return;
+  }
+#endif
+
 #if 0
   fprintf(stderr, "m = %4d  n = %d  k = %d  lda = %4d  ldb = %4d  ldc = %4d\n",
 	 args.m, args.n, args.k, args.lda, args.ldb, args.ldc);
@@ -413,15 +440,43 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
   sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
   sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
 
+#if !defined(COMPLEX) && !defined(XDOUBLE)
+  /* a narrow N or M : stream the wide operand once instead of packing it */
+  /* (a K far longer than M and N is left to the threaded K-split)        */
+  if ((MIN(args.m, args.n) <= GEMM_SKINNY_N) && (args.k > 0) && (*(FLOAT *)args.alpha != ZERO)
+#ifdef SMP
+      && ((args.k < 8 * MAX(args.m, args.n)) || (num_cpu_avail(3) == 1) || openblas_reproducible())
+#endif
+      ) {
+
+#ifdef SMP
+    /* Bandwidth bound like gemv : only the narrow operand is packed */
+    args.nthreads = blas_model_threads(ERROR_NAME, (double) MAX(args.m, args.n) * (double) args.k, 0.0,
+				       2304.0 * (double) GEMM_MULTITHREAD_THRESHOLD,
+				       num_cpu_avail(3));
+#endif
+
+    GEMM_SKINNY(&args, (transb << 1) | transa, sb);
+
+    blas_memory_free(buffer);
+
+    FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+    IDEBUG_END;
+
+    return;
+  }
+#endif
+
 #ifdef SMP
   mode |= (transa << BLAS_TRANSA_SHIFT);
   mode |= (transb << BLAS_TRANSB_SHIFT);
 
   MNK = (double) args.m * (double) args.n * (double) args.k;
-  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
-	args.nthreads = 1;
-  else
-	args.nthreads = num_cpu_avail(3);
+  args.nthreads = blas_model_threads(ERROR_NAME, MNK,
+				     BLAS_PACK_COST * ((double) args.m + (double) args.n) * (double) args.k,
+				     SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD,
+				     num_cpu_avail(3));
   args.common = NULL;
 
  if (args.nthreads == 1) {
@@ -438,7 +493,7 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANS
 #ifndef NO_AFFINITY
       nodes = get_num_nodes();
 
-      if ((nodes > 1) && get_node_equal()) {
+      if ((nodes > 1) && get_node_equal() && !openblas_numa_level3()) {
 
 	args.nthreads /= nodes;
 
@@ -0,0 +1,389 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Batched GEMM : cblas_?gemm_batch (grouped) and                   */
+/* cblas_?gemm_batch_strided (compiled with -DSTRIDED).             */
+/* Small entries are spread over the thread pool, one problem per  */
+/* worker; entries big enough to keep every thread busy on their    */
+/* own are run one after another through the threaded driver.       */
+
+#ifndef COMPLEX
+#define SMP_THRESHOLD_MIN 65536.0
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_BATCH "
+#else
+#define ERROR_NAME "SGEMM_BATCH "
+#endif
+#else
+#define SMP_THRESHOLD_MIN 8192.0
+#ifdef DOUBLE
+#define ERROR_NAME "ZGEMM_BATCH "
+#else
+#define ERROR_NAME "CGEMM_BATCH "
+#endif
+#endif
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_NN, GEMM_TN, GEMM_RN, GEMM_CN,
+  GEMM_NT, GEMM_TT, GEMM_RT, GEMM_CT,
+  GEMM_NR, GEMM_TR, GEMM_RR, GEMM_CR,
+  GEMM_NC, GEMM_TC, GEMM_RC, GEMM_CC,
+#if defined(SMP) && !defined(USE_SIMPLE_THREADED_LEVEL3)
+  GEMM_THREAD_NN, GEMM_THREAD_TN, GEMM_THREAD_RN, GEMM_THREAD_CN,
+  GEMM_THREAD_NT, GEMM_THREAD_TT, GEMM_THREAD_RT, GEMM_THREAD_CT,
+  GEMM_THREAD_NR, GEMM_THREAD_TR, GEMM_THREAD_RR, GEMM_THREAD_CR,
+  GEMM_THREAD_NC, GEMM_THREAD_TC, GEMM_THREAD_RC, GEMM_THREAD_CC,
+#endif
+};
+
+static int get_trans(enum CBLAS_TRANSPOSE Trans){
+
+  if (Trans == CblasNoTrans)     return 0;
+  if (Trans == CblasTrans)       return 1;
+#ifndef COMPLEX
+  if (Trans == CblasConjNoTrans) return 0;
+  if (Trans == CblasConjTrans)   return 1;
+#else
+  if (Trans == CblasConjNoTrans) return 2;
+  if (Trans == CblasConjTrans)   return 3;
+#endif
+  return -1;
+}
+
+/* Fills one entry of the batch, returns the xerbla code on error */
+static blasint setup_entry(enum CBLAS_ORDER order,
+			   enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+			   blasint m, blasint n, blasint k,
+			   FLOAT *alpha, FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+			   FLOAT *beta, FLOAT *c, blasint ldc,
+			   blas_arg_t *args, int *trans){
+
+  int transa, transb;
+  blasint nrowa, nrowb, info;
+
+  info = 0;
+
+  if (order == CblasColMajor) {
+    args -> m = m;
+    args -> n = n;
+    args -> a = (void *)a;
+    args -> b = (void *)b;
+    args -> lda = lda;
+    args -> ldb = ldb;
+
+    transa = get_trans(TransA);
+    transb = get_trans(TransB);
+  } else if (order == CblasRowMajor) {
+    args -> m = n;
+    args -> n = m;
+    args -> a = (void *)b;
+    args -> b = (void *)a;
+    args -> lda = ldb;
+    args -> ldb = lda;
+
+    transa = get_trans(TransB);
+    transb = get_trans(TransA);
+  } else {
+    return 1;
+  }
+
+  args -> k = k;
+  args -> c = (void *)c;
+  args -> ldc = ldc;
+  args -> alpha = (void *)alpha;
+  args -> beta  = (void *)beta;
+#ifdef SMP
+  args -> nthreads = 1;
+  args -> common   = NULL;
+#endif
+
+  nrowa = args -> m;
+  if (transa & 1) nrowa = args -> k;
+  nrowb = args -> k;
+  if (transb & 1) nrowb = args -> n;
+
+  if (args -> ldc < args -> m) info = 13;
+  if (args -> ldb < nrowb)     info = 10;
+  if (args -> lda < nrowa)     info =  8;
+  if (args -> k < 0)           info =  5;
+  if (args -> n < 0)           info =  4;
+  if (args -> m < 0)           info =  3;
+  if (transb < 0)              info =  2;
+  if (transa < 0)              info =  1;
+
+  *trans = (transb << 2) | transa;
+
+  return info;
+}
+
+#ifndef STRIDED
+void CNAME(enum CBLAS_ORDER order,
+	   enum CBLAS_TRANSPOSE *TransA_array, enum CBLAS_TRANSPOSE *TransB_array,
+	   blasint *m_array, blasint *n_array, blasint *k_array,
+#ifndef COMPLEX
+	   FLOAT *alpha_array,
+	   FLOAT **a_array, blasint *lda_array,
+	   FLOAT **b_array, blasint *ldb_array,
+	   FLOAT *beta_array,
+	   FLOAT **c_array, blasint *ldc_array,
+#else
+	   void *valpha_array,
+	   void **a_array, blasint *lda_array,
+	   void **b_array, blasint *ldb_array,
+	   void *vbeta_array,
+	   void **c_array, blasint *ldc_array,
+#endif
+	   blasint group_count, blasint *group_size){
+#ifdef COMPLEX
+  FLOAT *alpha_array = (FLOAT *)valpha_array;
+  FLOAT *beta_array  = (FLOAT *)vbeta_array;
+#endif
+  BLASLONG g, j, idx;
+#else
+void CNAME(enum CBLAS_ORDER order,
+	   enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+#ifndef COMPLEX
+	   FLOAT alpha,
+	   FLOAT *a, blasint lda, blasint stridea,
+	   FLOAT *b, blasint ldb, blasint strideb,
+	   FLOAT beta,
+	   FLOAT *c, blasint ldc, blasint stridec,
+#else
+	   void *valpha,
+	   void *va, blasint lda, blasint stridea,
+	   void *vb, blasint ldb, blasint strideb,
+	   void *vbeta,
+	   void *vc, blasint ldc, blasint stridec,
+#endif
+	   blasint batch_size){
+#ifndef COMPLEX
+  FLOAT *palpha = &alpha;
+  FLOAT *pbeta  = &beta;
+#else
+  FLOAT *palpha = (FLOAT *)valpha;
+  FLOAT *pbeta  = (FLOAT *)vbeta;
+  FLOAT *a = (FLOAT *)va;
+  FLOAT *b = (FLOAT *)vb;
+  FLOAT *c = (FLOAT *)vc;
+#endif
+#endif
+
+  blas_arg_t *args;
+  int (**routines)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  int *trans_array;
+  int trans;
+  blasint info;
+  BLASLONG i, count, total;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+#ifdef SMP
+  BLASLONG nthreads, nsmall, nlarge;
+  blas_arg_t swap;
+  int (*swap_routine)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+  double MNK;
+#ifndef COMPLEX
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+#ifndef STRIDED
+  info = 0;
+  if (group_count < 0) info = 15;
+  total = 0;
+  for (g = 0; g < group_count && !info; g++) {
+    if (group_size[g] < 0) info = 16;
+    total += group_size[g];
+  }
+#else
+  /* Entries may share A and B, but C blocks must not overlap as they */
+  /* are written by different workers                                 */
+  info = 0;
+  if (batch_size < 0) info = 18;
+  if ((batch_size > 1) && (m > 0) && (n > 0) &&
+      (stridec < (BLASLONG)ldc * ((order == CblasRowMajor) ? m : n))) info = 17;
+  if (strideb < 0)    info = 13;
+  if (stridea < 0)    info = 10;
+  total = batch_size;
+#endif
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if (total == 0) return;
+
+  args     = (blas_arg_t *)malloc(total * sizeof(blas_arg_t));
+  routines = malloc(total * sizeof(*routines));
+  trans_array = (int *)malloc(total * sizeof(int));
+
+  if ((args == NULL) || (routines == NULL) || (trans_array == NULL)) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    free(args);
+    free(routines);
+    free(trans_array);
+    return;
+  }
+
+  /* Validate every entry before touching any C */
+  count = 0;
+
+#ifndef STRIDED
+  idx = 0;
+  for (g = 0; g < group_count; g++) {
+    for (j = 0; j < group_size[g]; j++, idx++) {
+      info = setup_entry(order, TransA_array[g], TransB_array[g],
+			 m_array[g], n_array[g], k_array[g],
+			 alpha_array + g * COMPSIZE, (FLOAT *)a_array[idx], lda_array[g],
+			 (FLOAT *)b_array[idx], ldb_array[g],
+			 beta_array + g * COMPSIZE, (FLOAT *)c_array[idx], ldc_array[g],
+			 &args[count], &trans);
+#else
+  {
+    for (i = 0; i < total; i++) {
+      info = setup_entry(order, TransA, TransB, m, n, k,
+			 palpha, a + i * stridea * COMPSIZE, lda,
+			 b + i * strideb * COMPSIZE, ldb,
+			 pbeta, c + i * stridec * COMPSIZE, ldc,
+			 &args[count], &trans);
+#endif
+      if (info) {
+	free(args);
+	free(routines);
+	free(trans_array);
+	BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+	return;
+      }
+
+      if ((args[count].m == 0) || (args[count].n == 0)) continue;
+
+      routines[count] = gemm[trans];
+      trans_array[count] = trans;
+      count ++;
+    }
+  }
+
+  if (count == 0) {
+    free(args);
+    free(routines);
+    free(trans_array);
+    return;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  /* One set of packing buffers for every entry run by this thread */
+  buffer = (XFLOAT *)blas_memory_alloc(0);
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  nthreads = num_cpu_avail(3);
+
+  if (nthreads > 1) {
+
+    /* Move entries that can use the whole pool to the end */
+    nsmall = count;
+    for (i = count - 1; i >= 0; i--) {
+      MNK = (double) args[i].m * (double) args[i].n * (double) args[i].k;
+      if (MNK > SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD * (double) nthreads) {
+	nsmall --;
+	swap = args[i]; args[i] = args[nsmall]; args[nsmall] = swap;
+	swap_routine = routines[i]; routines[i] = routines[nsmall]; routines[nsmall] = swap_routine;
+	trans = trans_array[i]; trans_array[i] = trans_array[nsmall]; trans_array[nsmall] = trans;
+      }
+    }
+    nlarge = count - nsmall;
+
+    /* Small problems : one problem per thread */
+    gemm_batch_thread(mode, args, (int (**)())routines, nsmall, sa, sb, nthreads);
+
+    /* Large problems : split each one over the pool */
+    for (i = nsmall; i < nsmall + nlarge; i++) {
+      args[i].nthreads = nthreads;
+#ifndef USE_SIMPLE_THREADED_LEVEL3
+      (gemm[16 | trans_array[i]])(&args[i], NULL, NULL, sa, sb, 0);
+#else
+      GEMM_THREAD(mode | ((trans_array[i] & 3) << BLAS_TRANSA_SHIFT) | ((trans_array[i] >> 2) << BLAS_TRANSB_SHIFT),
+		  &args[i], NULL, NULL, routines[i], sa, sb, nthreads);
+#endif
+    }
+
+  } else {
+#endif
+
+    for (i = 0; i < count; i++)
+      (routines[i])(&args[i], NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, count, 0);
+
+  IDEBUG_END;
+
+  free(args);
+  free(routines);
+  free(trans_array);
+
+  return;
+}
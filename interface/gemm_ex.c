@@ -0,0 +1,221 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <stdio.h>
+#include "common.h"
+
+/* GEMM with a fused epilogue : cblas_sgemm_ex and cblas_dgemm_ex.   */
+/* The ?gemm_ex_?? drivers scale, bias and activate each C tile at    */
+/* the end of the last K panel, while it is still in cache, instead   */
+/* of leaving another full pass over C to the caller.                 */
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGEMM_EX "
+typedef openblas_dgemm_epilogue_t epilogue_t;
+#else
+#define ERROR_NAME "SGEMM_EX "
+typedef openblas_sgemm_epilogue_t epilogue_t;
+#endif
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_EX_NN, GEMM_EX_TN, GEMM_EX_NT, GEMM_EX_TT,
+};
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE TransA, enum CBLAS_TRANSPOSE TransB,
+	   blasint m, blasint n, blasint k,
+	   FLOAT alpha, FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+	   FLOAT beta, FLOAT *c, blasint ldc, epilogue_t *epilogue) {
+
+  blas_arg_t args;
+  gemm_epilogue_t ep;
+  int transa, transb;
+  blasint nrowa, nrowb, info;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+#ifdef SMP
+  double MNK;
+  int mode;
+#ifdef DOUBLE
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+  mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  args.alpha = (void *)&alpha;
+  args.beta  = (void *)&beta;
+
+  transa = -1;
+  transb = -1;
+  info   =  0;
+
+  ep.row_bias   = NULL;
+  ep.col_bias   = NULL;
+  ep.row_scale  = NULL;
+  ep.col_scale  = NULL;
+  ep.activation = GEMM_EPILOGUE_NONE;
+
+  if (epilogue) {
+    if (order == CblasRowMajor) {
+      /* C^T = op(B)^T op(A)^T, so rows and columns trade places */
+      ep.row_bias  = (void *)epilogue -> col_bias;
+      ep.col_bias  = (void *)epilogue -> row_bias;
+      ep.row_scale = (void *)epilogue -> col_scale;
+      ep.col_scale = (void *)epilogue -> row_scale;
+    } else {
+      ep.row_bias  = (void *)epilogue -> row_bias;
+      ep.col_bias  = (void *)epilogue -> col_bias;
+      ep.row_scale = (void *)epilogue -> row_scale;
+      ep.col_scale = (void *)epilogue -> col_scale;
+    }
+    if (epilogue -> activation == CblasNoActivation) ep.activation = GEMM_EPILOGUE_NONE;
+    else if (epilogue -> activation == CblasReLU)    ep.activation = GEMM_EPILOGUE_RELU;
+    else if (epilogue -> activation == CblasGELU)    ep.activation = GEMM_EPILOGUE_GELU;
+    else info = 15;
+  }
+
+  if (order == CblasRowMajor) {
+    enum CBLAS_TRANSPOSE t = TransA; TransA = TransB; TransB = t;
+    args.m = n;
+    args.n = m;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+  } else {
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+  }
+
+  args.k = k;
+  args.c = (void *)c;
+  args.ldc = ldc;
+  args.d = (void *)&ep;
+
+  if ((TransA == CblasNoTrans) || (TransA == CblasConjNoTrans)) transa = 0;
+  if ((TransA == CblasTrans)   || (TransA == CblasConjTrans))   transa = 1;
+
+  if ((TransB == CblasNoTrans) || (TransB == CblasConjNoTrans)) transb = 0;
+  if ((TransB == CblasTrans)   || (TransB == CblasConjTrans))   transb = 1;
+
+  nrowa = args.m;
+  if (transa & 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb & 1) nrowb = args.n;
+
+  if (info == 0) {
+    if (args.ldc < args.m) info = 14;
+    if (args.ldb < nrowb)  info = 11;
+    if (args.lda < nrowa)  info =  9;
+    if (args.k < 0) info = 6;
+    if (args.n < 0) info = 5;
+    if (args.m < 0) info = 4;
+    if (transb < 0) info = 3;
+    if (transa < 0) info = 2;
+
+    if (order == CblasRowMajor) {
+      /* report the argument positions of the caller */
+      if (info == 9) info = 11; else if (info == 11) info = 9;
+      if (info == 2) info = 3; else if (info == 3) info = 2;
+      if (info == 4) info = 5; else if (info == 5) info = 4;
+    } else if (order != CblasColMajor) {
+      info = 1;
+    }
+  }
+
+  if (info != 0) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = (XFLOAT *)blas_memory_alloc(0);
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  args.nthreads = blas_model_threads(ERROR_NAME, MNK,
+				     BLAS_PACK_COST * ((double) args.m + (double) args.n) * (double) args.k,
+				     SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD,
+				     num_cpu_avail(3));
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (gemm[(transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+
+    /* each thread owns a slice of C along its longer side, epilogue included */
+    if (args.m >= args.n)
+      gemm_thread_m(mode, &args, NULL, NULL, (int (*)())gemm[(transb << 1) | transa],
+		    sa, sb, args.nthreads);
+    else
+      gemm_thread_n(mode, &args, NULL, NULL, (int (*)())gemm[(transb << 1) | transa],
+		    sa, sb, args.nthreads);
+
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+
+  return;
+}
@@ -0,0 +1,413 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Pre-packed GEMM : cblas_?gemm_pack_get_size (-DGET_SIZE),        */
+/* cblas_?gemm_pack and cblas_?gemm_compute (-DCOMPUTE).             */
+/* An operand is packed once into the layout the level 3 copy        */
+/* routines of the running core produce; compute then feeds it to    */
+/* the kernels directly, skipping the copy on every later call.      */
+/*                                                                   */
+/* The packed buffer starts with a small header followed by K blocks */
+/* of GEMM_Q (the last one may be shorter), each holding the whole   */
+/* M (or N) extent, padded to a multiple of the unroll factor.       */
+
+#ifdef DOUBLE
+#define ERROR_NAME_PACK    "DGEMM_PACK "
+#define ERROR_NAME_COMPUTE "DGEMM_COMPUTE "
+#define PACK_MAGIC 0x4f42504b44L
+#else
+#define ERROR_NAME_PACK    "SGEMM_PACK "
+#define ERROR_NAME_COMPUTE "SGEMM_COMPUTE "
+#define PACK_MAGIC 0x4f42504b53L
+#endif
+
+#define SMP_THRESHOLD_MIN 65536.0
+
+#ifndef GEMM_MULTITHREAD_THRESHOLD
+#define GEMM_MULTITHREAD_THRESHOLD 4
+#endif
+
+/* header : magic, side, extent, k, ldp, q, unroll_m, unroll_n */
+#define PACK_HEADER_SIZE (8 * sizeof(BLASLONG))
+
+/* side 0 is consumed as the driver's A (inner copy), 1 as its B */
+#define PACK_SIDE_A 0
+#define PACK_SIDE_B 1
+
+#ifdef GET_SIZE
+
+size_t CNAME(enum CBLAS_IDENTIFIER identifier, blasint m, blasint n, blasint k) {
+
+  BLASLONG dim, unroll;
+
+  if (identifier == CblasAMatrix) {
+    dim = m;
+  } else if (identifier == CblasBMatrix) {
+    dim = n;
+  } else {
+    return 0;
+  }
+
+  if ((dim < 0) || (k < 0)) return 0;
+
+  /* row major swaps the roles, so leave room for either padding */
+  unroll = GEMM_UNROLL_M;
+  if (GEMM_UNROLL_N > unroll) unroll = GEMM_UNROLL_N;
+
+  return PACK_HEADER_SIZE + (size_t)(dim + unroll) * (size_t)k * SIZE;
+}
+
+#else
+
+static BLASLONG pack_ldp(BLASLONG side, BLASLONG dim) {
+
+  BLASLONG unroll = (side == PACK_SIDE_A) ? GEMM_UNROLL_M : GEMM_UNROLL_N;
+
+  return ((dim + unroll - 1) / unroll) * unroll;
+}
+
+#ifndef COMPUTE
+
+void CNAME(enum CBLAS_ORDER order, enum CBLAS_IDENTIFIER identifier, enum CBLAS_TRANSPOSE Trans,
+	   blasint m, blasint n, blasint k, FLOAT alpha,
+	   FLOAT *src, blasint ld, FLOAT *dest) {
+
+  BLASLONG *header;
+  FLOAT *buffer;
+  BLASLONG side, dim, ldp, ls, min_l;
+  blasint trans, nrow, info;
+
+  PRINT_DEBUG_CNAME;
+
+  trans = -1;
+  if ((Trans == CblasNoTrans) || (Trans == CblasConjNoTrans)) trans = 0;
+  if ((Trans == CblasTrans)   || (Trans == CblasConjTrans))   trans = 1;
+
+  side = -1;
+  dim  = 0;
+
+  if (identifier == CblasAMatrix) {
+    dim  = m;
+    side = (order == CblasRowMajor) ? PACK_SIDE_B : PACK_SIDE_A;
+  } else if (identifier == CblasBMatrix) {
+    dim  = n;
+    side = (order == CblasRowMajor) ? PACK_SIDE_A : PACK_SIDE_B;
+  }
+
+  /* rows of the source as stored (column major view) */
+  if (side == PACK_SIDE_A) {
+    nrow = trans ? k : dim;
+  } else {
+    nrow = trans ? dim : k;
+  }
+
+  info = 0;
+
+  if (dest == NULL)                 info = 10;
+  if (ld < MAX(1, nrow))            info =  9;
+  if (k < 0)                        info =  6;
+  if (n < 0)                        info =  5;
+  if (m < 0)                        info =  4;
+  if (trans < 0)                    info =  3;
+  if (side  < 0)                    info =  2;
+  if ((order != CblasRowMajor) && (order != CblasColMajor)) info = 1;
+
+  if (info != 0) {
+    BLASFUNC(xerbla)(ERROR_NAME_PACK, &info, sizeof(ERROR_NAME_PACK));
+    return;
+  }
+
+  ldp = pack_ldp(side, dim);
+
+  header = (BLASLONG *)dest;
+  header[0] = PACK_MAGIC;
+  header[1] = side;
+  header[2] = dim;
+  header[3] = k;
+  header[4] = ldp;
+  header[5] = GEMM_Q;
+  header[6] = GEMM_UNROLL_M;
+  header[7] = GEMM_UNROLL_N;
+
+  buffer = (FLOAT *)((char *)dest + PACK_HEADER_SIZE);
+
+  for (ls = 0; ls < k; ls += min_l) {
+    min_l = k - ls;
+    if (min_l > GEMM_Q) min_l = GEMM_Q;
+
+    if (side == PACK_SIDE_A) {
+      if (!trans) {
+	GEMM_ITCOPY(min_l, dim, src + ls * ld, ld, buffer + ls * ldp);
+      } else {
+	GEMM_INCOPY(min_l, dim, src + ls, ld, buffer + ls * ldp);
+      }
+    } else {
+      if (!trans) {
+	GEMM_ONCOPY(min_l, dim, src + ls, ld, buffer + ls * ldp);
+      } else {
+	GEMM_OTCOPY(min_l, dim, src + ls * ld, ld, buffer + ls * ldp);
+      }
+    }
+
+    /* alpha is folded into the packed operand */
+    if (alpha != ONE) SCAL_K(min_l * dim, 0, 0, alpha, buffer + ls * ldp, 1, NULL, 0, NULL, 0);
+  }
+}
+
+#else
+
+static int (*gemm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GEMM_NN, GEMM_TN, GEMM_NT, GEMM_TT,
+  GEMM_PN, GEMM_PN, GEMM_PT, GEMM_PT,
+  GEMM_NP, GEMM_TP, GEMM_NP, GEMM_TP,
+  GEMM_PP, GEMM_PP, GEMM_PP, GEMM_PP,
+};
+
+/* Returns the packed data if the header matches the expected operand */
+static FLOAT *check_packed(FLOAT *packed, BLASLONG side, BLASLONG dim, BLASLONG k) {
+
+  BLASLONG *header = (BLASLONG *)packed;
+
+  if ((header[0] != PACK_MAGIC) || (header[1] != side) ||
+      (header[2] != dim) || (header[3] != k) || (header[4] != pack_ldp(side, dim)) ||
+      (header[5] != GEMM_Q) || (header[6] != GEMM_UNROLL_M) || (header[7] != GEMM_UNROLL_N)) return NULL;
+
+  return (FLOAT *)((char *)packed + PACK_HEADER_SIZE);
+}
+
+#ifdef SMP
+/* Splits the larger of M and N over the threads, keeping the cuts on */
+/* unroll boundaries of a packed operand so its panels stay intact.   */
+static int gemm_packed_thread(int mode, blas_arg_t *arg, int (*function)(),
+			      FLOAT *sa, FLOAT *sb, BLASLONG nthreads, int packed_a, int packed_b) {
+
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+  BLASLONG width, i, num_cpu, align;
+  int split_m;
+
+  split_m = (arg -> m >= arg -> n);
+
+  align = 1;
+  if ( split_m && packed_a) align = GEMM_UNROLL_M;
+  if (!split_m && packed_b) align = GEMM_UNROLL_N;
+
+  i = split_m ? arg -> m : arg -> n;
+
+  num_cpu  = 0;
+  range[0] = 0;
+
+  while (i > 0) {
+
+    width = blas_quickdivide(i + nthreads - num_cpu - 1, nthreads - num_cpu);
+    width = ((width + align - 1) / align) * align;
+    if (width > i) width = i;
+
+    i -= width;
+
+    range[num_cpu + 1] = range[num_cpu] + width;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = function;
+    queue[num_cpu].args    = arg;
+    queue[num_cpu].range_m = split_m ? &range[num_cpu] : NULL;
+    queue[num_cpu].range_n = split_m ? NULL : &range[num_cpu];
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+
+    num_cpu ++;
+  }
+
+  if (num_cpu) {
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+  }
+
+  return 0;
+}
+#endif
+
+void CNAME(enum CBLAS_ORDER order, blasint TransA, blasint TransB,
+	   blasint m, blasint n, blasint k,
+	   FLOAT *a, blasint lda, FLOAT *b, blasint ldb,
+	   FLOAT beta, FLOAT *c, blasint ldc) {
+
+  blas_arg_t args;
+  FLOAT one = ONE;
+  int transa, transb, packed_a, packed_b;
+  blasint nrowa, nrowb, info;
+
+  XFLOAT *buffer;
+  XFLOAT *sa, *sb;
+
+#ifdef SMP
+  double MNK;
+  int mode;
+#ifdef DOUBLE
+  mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+  mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+#endif
+
+  PRINT_DEBUG_CNAME;
+
+  args.alpha = (void *)&one;
+  args.beta  = (void *)&beta;
+
+  transa = -1;
+  transb = -1;
+  info   =  0;
+
+  if (order == CblasRowMajor) {
+    blasint t = TransA; TransA = TransB; TransB = t;
+    args.m = n;
+    args.n = m;
+    args.a = (void *)b;
+    args.b = (void *)a;
+    args.lda = ldb;
+    args.ldb = lda;
+  } else {
+    args.m = m;
+    args.n = n;
+    args.a = (void *)a;
+    args.b = (void *)b;
+    args.lda = lda;
+    args.ldb = ldb;
+  }
+
+  args.k = k;
+  args.c = (void *)c;
+  args.ldc = ldc;
+
+  packed_a = (TransA == CblasPacked);
+  packed_b = (TransB == CblasPacked);
+
+  if ((TransA == CblasNoTrans) || (TransA == CblasConjNoTrans)) transa = 0;
+  if ((TransA == CblasTrans)   || (TransA == CblasConjTrans))   transa = 1;
+  if (packed_a) transa = 0;
+
+  if ((TransB == CblasNoTrans) || (TransB == CblasConjNoTrans)) transb = 0;
+  if ((TransB == CblasTrans)   || (TransB == CblasConjTrans))   transb = 1;
+  if (packed_b) transb = 0;
+
+  nrowa = args.m;
+  if (transa & 1) nrowa = args.k;
+  nrowb = args.k;
+  if (transb & 1) nrowb = args.n;
+
+  if (args.ldc < MAX(1, args.m)) info = 13;
+
+  if ((args.m > 0) && (args.n > 0) && (args.k > 0)) {
+    if (packed_b) {
+      if ((args.b = check_packed((FLOAT *)args.b, PACK_SIDE_B, args.n, args.k)) == NULL) info = 10;
+      args.ldb = pack_ldp(PACK_SIDE_B, args.n);
+    } else if (args.ldb < MAX(1, nrowb)) info = 10;
+
+    if (packed_a) {
+      if ((args.a = check_packed((FLOAT *)args.a, PACK_SIDE_A, args.m, args.k)) == NULL) info = 8;
+      args.lda = pack_ldp(PACK_SIDE_A, args.m);
+    } else if (args.lda < MAX(1, nrowa)) info = 8;
+  }
+
+  if (args.k < 0) info = 6;
+  if (args.n < 0) info = 5;
+  if (args.m < 0) info = 4;
+  if (transb < 0) info = 3;
+  if (transa < 0) info = 2;
+
+  if (order == CblasRowMajor) {
+    /* report the argument positions of the caller */
+    if (info == 8) info = 10; else if (info == 10) info = 8;
+    if (info == 2) info = 3; else if (info == 3) info = 2;
+    if (info == 4) info = 5; else if (info == 5) info = 4;
+  } else if (order != CblasColMajor) {
+    info = 1;
+  }
+
+  if (info != 0) {
+    BLASFUNC(xerbla)(ERROR_NAME_COMPUTE, &info, sizeof(ERROR_NAME_COMPUTE));
+    return;
+  }
+
+  if ((args.m == 0) || (args.n == 0)) return;
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+  buffer = (XFLOAT *)blas_memory_alloc(0);
+
+  sa = (XFLOAT *)((BLASLONG)buffer +GEMM_OFFSET_A);
+  sb = (XFLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+#ifdef SMP
+  MNK = (double) args.m * (double) args.n * (double) args.k;
+  if ( MNK <= (SMP_THRESHOLD_MIN  * (double) GEMM_MULTITHREAD_THRESHOLD)  )
+	args.nthreads = 1;
+  else
+	args.nthreads = num_cpu_avail(3);
+  args.common = NULL;
+
+  if (args.nthreads == 1) {
+#endif
+
+    (gemm[(packed_b << 3) | (packed_a << 2) | (transb << 1) | transa])(&args, NULL, NULL, sa, sb, 0);
+
+#ifdef SMP
+  } else {
+
+    gemm_packed_thread(mode, &args, (int (*)())gemm[(packed_b << 3) | (packed_a << 2) | (transb << 1) | transa],
+		       sa, sb, args.nthreads, packed_a, packed_b);
+
+  }
+#endif
+
+  blas_memory_free(buffer);
+
+  FUNCTION_PROFILE_END(1, args.m * args.k + args.k * args.n + args.m * args.n, 2 * args.m * args.n * args.k);
+
+  IDEBUG_END;
+
+  return;
+}
+
+#endif
+#endif
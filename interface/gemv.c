@@ -220,10 +220,10 @@ void CNAME(enum CBLAS_ORDER order,
 
 #ifdef SMP
 
-  if ( 1L * m * n < 2304L * GEMM_MULTITHREAD_THRESHOLD )
-    nthreads = 1;
-  else
-    nthreads = num_cpu_avail(2);
+  /* Nothing is packed; the kernels stream A once */
+  nthreads = blas_model_threads(ERROR_NAME, (double) m * (double) n, 0.0,
+				2304.0 * (double) GEMM_MULTITHREAD_THRESHOLD,
+				num_cpu_avail(2));
 
   if (nthreads == 1) {
 #endif
@@ -54,6 +54,118 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Enables the New IMATCOPY code with inplace operation if lda == ldb   */
 #define NEW_IMATCOPY
 
+/* Columns moved per block by the column passes of imatcopy_c2r */
+#define IMATCOPY_COLS	16
+
+/* In-place transpose of a contiguous row major m x n matrix into the n x m  */
+/* one, scaled by alpha, after Catanzaro, Keller and Garland (PPoPP 2014) : */
+/* with c = gcd(m, n), b = n / c and a = m / c,                              */
+/*   1. column j is rotated up by j / b (only needed for c > 1),            */
+/*   2. row i is permuted, element j going to ((i + j/b) % m + j*m) % n,     */
+/*   3. column j is gathered, row i taking row (j + i*n - i/a) % m.          */
+/* The row pass needs one row of work and the column passes IMATCOPY_COLS    */
+/* columns at a time, m * IMATCOPY_COLS elements, instead of a copy of A.    */
+static void imatcopy_c2r(BLASLONG m, BLASLONG n, FLOAT alpha, FLOAT *a, FLOAT *work)
+{
+	BLASLONG c, ca, cb, i, j, j0, jj, w, s, t, u, un, v, d, r, ia, mn, nm;
+	BLASLONG off[IMATCOPY_COLS];
+	FLOAT *row;
+
+	if ( alpha == 0.0 )
+	{
+		for ( i = 0; i < m * n; i++ ) a[i] = 0.0;
+		return;
+	}
+
+	c = m;
+	t = n;
+	while ( t > 0 )
+	{
+		s = c % t;
+		c = t;
+		t = s;
+	}
+	ca = m / c;
+	cb = n / c;
+	mn = m % n;
+	nm = n % m;
+
+	if ( c > 1 )
+	{
+		for ( j0 = 0; j0 < n; j0 += IMATCOPY_COLS )
+		{
+			w = MIN(n - j0, IMATCOPY_COLS);
+			for ( jj = 0; jj < w; jj++ ) off[jj] = ((j0 + jj) / cb) % m;
+
+			for ( i = 0; i < m; i++ )
+				for ( jj = 0; jj < w; jj++ )
+				{
+					s = i + off[jj];
+					if ( s >= m ) s -= m;
+					work[i * w + jj] = a[s * n + j0 + jj];
+				}
+
+			for ( i = 0; i < m; i++ )
+				for ( jj = 0; jj < w; jj++ )
+					a[i * n + j0 + jj] = work[i * w + jj];
+		}
+	}
+
+	for ( i = 0; i < m; i++ )
+	{
+		row = a + i * n;
+		u  = i;
+		un = u % n;
+		v  = 0;
+		t  = 0;
+		for ( j = 0; j < n; j++ )
+		{
+			d = un + v;
+			if ( d >= n ) d -= n;
+			work[d] = alpha * row[j];
+			v += mn;
+			if ( v >= n ) v -= n;
+			if ( ++t == cb )
+			{
+				t = 0;
+				if ( ++u == m ) u = 0;
+				un = u % n;
+			}
+		}
+		for ( j = 0; j < n; j++ ) row[j] = work[j];
+	}
+
+	for ( j0 = 0; j0 < n; j0 += IMATCOPY_COLS )
+	{
+		w = MIN(n - j0, IMATCOPY_COLS);
+		for ( jj = 0; jj < w; jj++ ) off[jj] = (j0 + jj) % m;
+
+		r  = 0;
+		ia = 0;
+		for ( i = 0; i < m; i++ )
+		{
+			for ( jj = 0; jj < w; jj++ )
+			{
+				s = r + off[jj];
+				if ( s >= m ) s -= m;
+				work[i * w + jj] = a[s * n + j0 + jj];
+			}
+			r += nm;
+			if ( ++ia == ca )
+			{
+				ia = 0;
+				r--;
+			}
+			if ( r >= m ) r -= m;
+			if ( r < 0 ) r += m;
+		}
+
+		for ( i = 0; i < m; i++ )
+			for ( jj = 0; jj < w; jj++ )
+				a[i * n + j0 + jj] = work[i * w + jj];
+	}
+}
+
 #ifndef CBLAS
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, blasint *ldb)
 {
@@ -149,6 +261,36 @@ void CNAME( enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 
 #endif
 
+	/* A transpose that leaves no gaps between the columns (rows) of A */
+	/* and of B is done in place whatever the shape                     */
+	if ( trans == BlasTrans &&
+	     ((order == BlasColMajor && *lda == *rows && *ldb == *cols) ||
+	      (order == BlasRowMajor && *lda == *cols && *ldb == *rows)) )
+	{
+		BLASLONG m, n;
+
+		if ( order == BlasColMajor )
+		{
+			m = *cols;
+			n = *rows;
+		}
+		else
+		{
+			m = *rows;
+			n = *cols;
+		}
+
+		b = malloc(MAX(n, m * IMATCOPY_COLS) * sizeof(FLOAT));
+		if ( b == NULL )
+		{
+			printf("Memory alloc failed\n");
+			exit(1);
+		}
+		imatcopy_c2r(m, n, *alpha, a, b);
+		free(b);
+		return;
+	}
+
 	if ( *lda >  *ldb )
 		msize = (*lda) * (*ldb)  * sizeof(FLOAT);
 	else
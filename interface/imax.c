@@ -118,6 +118,71 @@
 
 #endif
 
+#ifdef USE_MIN
+#define REDUCE_OP	BLAS_REDUCE_MIN
+#else
+#define REDUCE_OP	BLAS_REDUCE_MAX
+#endif
+
+#if defined(SMP) && !defined(XDOUBLE)
+static int imax_chunk(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *dummy, BLASLONG dummy1,
+		      blas_reduce_t *result){
+
+  BLASLONG idx = MAX_K(n, x, incx);
+  FLOAT *p;
+
+  if (idx > n) idx = n;
+
+  result -> index = idx;
+
+  if (idx > 0) {
+    p = x + (idx - 1) * incx * COMPSIZE;
+#ifndef USE_ABS
+    result -> value[0] = (double)p[0];
+#elif !defined(COMPLEX)
+    result -> value[0] = fabs((double)p[0]);
+#else
+    result -> value[0] = fabs((double)p[0]) + fabs((double)p[1]);
+#endif
+  }
+
+  return 0;
+}
+#endif
+
+static BLASLONG imax_compute(BLASLONG n, FLOAT *x, BLASLONG incx){
+
+#if defined(SMP) && !defined(XDOUBLE)
+  blas_reduce_t result;
+  int mode, nthreads = 1;
+
+  if ((incx > 0) && (n > IAMAX_REDUCE_THRESHOLD))
+    nthreads = blas_model_threads("IAMAX", (double)n * COMPSIZE, 0., IAMAX_REDUCE_THRESHOLD, num_cpu_avail(1));
+
+  /* reproducible mode always goes through the fixed chunking */
+  if ((nthreads > 1) || (openblas_reproducible() && (n > BLAS_REDUCE_REPRO_CHUNK) && (incx > 0))) {
+
+#ifdef DOUBLE
+    mode  =  BLAS_DOUBLE;
+#else
+    mode  =  BLAS_SINGLE;
+#endif
+#ifndef COMPLEX
+    mode |=  BLAS_REAL;
+#else
+    mode |=  BLAS_COMPLEX;
+#endif
+
+    blas_level1_reduce(mode, REDUCE_OP, n, x, incx, NULL, 0,
+		       (void *)imax_chunk, &result, nthreads);
+
+    return result.index;
+  }
+#endif
+
+  return MAX_K(n, x, incx);
+}
+
 #ifndef CBLAS
 
 blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
@@ -134,7 +199,7 @@ blasint NAME(blasint *N, FLOAT *x, blasint *INCX){
 
   FUNCTION_PROFILE_START();
 
-  ret = (blasint)MAX_K(n, x, incx);
+  ret = (blasint)imax_compute(n, x, incx);
 
   if(ret > n) ret=n;
 
@@ -163,7 +228,7 @@ CBLAS_INDEX CNAME(blasint n, FLOAT *x, blasint incx){
 
   FUNCTION_PROFILE_START();
 
-  ret = MAX_K(n, x, incx);
+  ret = imax_compute(n, x, incx);
 
   if (ret > n) ret=n;
 
@@ -0,0 +1,286 @@
+/*********************************************************************/
+/* Copyright 2009, 2010 The University of Texas at Austin.           */
+/* All rights reserved.                                              */
+/*                                                                   */
+/* Redistribution and use in source and binary forms, with or        */
+/* without modification, are permitted provided that the following   */
+/* conditions are met:                                               */
+/*                                                                   */
+/*   1. Redistributions of source code must retain the above         */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer.                                                  */
+/*                                                                   */
+/*   2. Redistributions in binary form must reproduce the above      */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer in the documentation and/or other materials       */
+/*      provided with the distribution.                              */
+/*                                                                   */
+/*    THIS  SOFTWARE IS PROVIDED  BY THE  UNIVERSITY OF  TEXAS AT    */
+/*    AUSTIN  ``AS IS''  AND ANY  EXPRESS OR  IMPLIED WARRANTIES,    */
+/*    INCLUDING, BUT  NOT LIMITED  TO, THE IMPLIED  WARRANTIES OF    */
+/*    MERCHANTABILITY  AND FITNESS FOR  A PARTICULAR  PURPOSE ARE    */
+/*    DISCLAIMED.  IN  NO EVENT SHALL THE UNIVERSITY  OF TEXAS AT    */
+/*    AUSTIN OR CONTRIBUTORS BE  LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL,  SPECIAL, EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES    */
+/*    (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF SUBSTITUTE    */
+/*    GOODS  OR  SERVICES; LOSS  OF  USE,  DATA,  OR PROFITS;  OR    */
+/*    BUSINESS INTERRUPTION) HOWEVER CAUSED  AND ON ANY THEORY OF    */
+/*    LIABILITY, WHETHER  IN CONTRACT, STRICT  LIABILITY, OR TORT    */
+/*    (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT    */
+/*    OF  THE  USE OF  THIS  SOFTWARE,  EVEN  IF ADVISED  OF  THE    */
+/*    POSSIBILITY OF SUCH DAMAGE.                                    */
+/*                                                                   */
+/* The views and conclusions contained in the software and           */
+/* documentation are those of the authors and should not be          */
+/* interpreted as representing official policies, either expressed   */
+/* or implied, of The University of Texas at Austin.                 */
+/*********************************************************************/
+
+/* Argument checks and scheduling shared by the batched interfaces  */
+/* (included from getrf_batch.c and friends after ERROR_NAME).      */
+/*                                                                  */
+/* A call is a list of groups of equal problems; a strided call is  */
+/* one group whose operands sit at fixed strides.  Runs of up to    */
+/* BATCH_LANES small problems from one group go to the compact      */
+/* kernel, the others one per worker, and those big enough for the  */
+/* whole pool one after another through the threaded driver.        */
+
+/* what an allocation failure leaves in info_array, as in LAPACKE */
+#define BATCH_MEMORY_ERROR	-1010
+
+typedef int     (*batch_routine_t)(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+typedef blasint (*batch_driver_t) (blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG);
+
+/* The routine, indexed by the uplo / trans flag */
+typedef struct {
+  int (*flag)(char);                 /* NULL if there is no flag argument */
+  int (*fits)(blas_arg_t *);         /* small enough for the compact kernel */
+  batch_routine_t one[2], compact[2];
+  batch_driver_t  parallel[2], tiled[2];
+  BLASLONG threshold;
+  int factor;                        /* info of each problem goes to args.d */
+} batch_ops_t;
+
+/* Operand of problem idx : array[idx] in grouped calls, base plus */
+/* idx * stride elements of size bytes in strided calls             */
+typedef struct {
+  void **array;
+  char *base;
+  BLASLONG stride, size, least;
+  blasint pos;                       /* position of stride, checked against least */
+} batch_operand_t;
+
+/* Per group : args.m, args.n, leading dimensions and flag, with the */
+/* positions xerbla reports for them; a strided call passes scalars  */
+/* and count = 1                                                     */
+typedef struct {
+  blasint count, *size;
+  blasint *m, *n, *lda, *ldb;
+  char *flag;
+  blasint pos_count, pos_size, pos_m, pos_n, pos_lda, pos_ldb, pos_flag;
+  batch_operand_t op[3];             /* args.a, args.b, args.c */
+  blasint *info;
+} batch_call_t;
+
+static void batch_bad(blasint *info, int bad, blasint pos){
+
+  if (bad && ((*info == 0) || (pos < *info))) *info = pos;
+}
+
+static void *batch_operand(batch_operand_t *op, BLASLONG idx){
+
+  if (op -> array) return op -> array[idx];
+  if (op -> base)  return (void *)(op -> base + idx * op -> stride * op -> size);
+  return NULL;
+}
+
+static int batch_run(batch_ops_t *ops, batch_call_t *call){
+
+  blas_arg_t args, *jobs;
+  batch_routine_t *routines;
+  void **ptrs;
+  int *group, flag;
+  blasint info;
+  BLASLONG g, i, j, k, w, idx, total, nmats, njobs;
+
+  FLOAT *buffer;
+  FLOAT *sa, *sb;
+
+#ifdef SMP
+  BLASLONG nthreads, nlarge, dim;
+#ifdef DOUBLE
+  int mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  int mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#endif
+
+  info = 0;
+  total = 0;
+
+  for (w = 0; w < 3; w++)
+    if (call -> op[w].pos) batch_bad(&info, call -> op[w].stride < call -> op[w].least, call -> op[w].pos);
+
+  batch_bad(&info, call -> count < 0, call -> pos_count);
+
+  for (g = 0; g < call -> count && !info; g++) {
+    batch_bad(&info, call -> size[g] < 0,                    call -> pos_size);
+    batch_bad(&info, call -> m[g] < 0,                       call -> pos_m);
+    batch_bad(&info, call -> n[g] < 0,                       call -> pos_n);
+    batch_bad(&info, call -> lda[g] < MAX(1, call -> m[g]),  call -> pos_lda);
+    if (call -> ldb)
+      batch_bad(&info, call -> ldb[g] < MAX(1, call -> m[g]), call -> pos_ldb);
+    if (ops -> flag)
+      batch_bad(&info, (ops -> flag)(call -> flag[g]) < 0,   call -> pos_flag);
+    total += call -> size[g];
+  }
+
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    return 0;
+  }
+
+  if (total == 0) return 0;
+
+  /* Only the problems that get a job of their own touch more than a */
+  /* few bytes of these                                              */
+  jobs     = (blas_arg_t *)malloc(total * sizeof(blas_arg_t));
+  routines = (batch_routine_t *)malloc(total * sizeof(batch_routine_t));
+  ptrs     = (void **)malloc(4 * total * sizeof(void *));
+  group    = (int *)malloc(total * sizeof(int));
+
+  if ((jobs == NULL) || (routines == NULL) || (ptrs == NULL) || (group == NULL)) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    free(jobs);
+    free(routines);
+    free(ptrs);
+    free(group);
+    for (idx = 0; idx < total; idx++) call -> info[idx] = BATCH_MEMORY_ERROR;
+    return BATCH_MEMORY_ERROR;
+  }
+
+  for (idx = 0; idx < total; idx++) call -> info[idx] = 0;
+
+  /* operand and info pointers of the non-empty problems, in order */
+  nmats = 0;
+  idx = 0;
+
+  for (g = 0; g < call -> count; g++) {
+    for (j = 0; j < call -> size[g]; j++, idx++) {
+      if ((call -> m[g] == 0) || (call -> n[g] == 0)) continue;
+      for (w = 0; w < 3; w++)
+	ptrs[nmats + w * total] = batch_operand(&call -> op[w], idx);
+      ptrs[nmats + 3 * total] = (ops -> factor) ? (void *)(call -> info + idx) : NULL;
+      group[nmats] = g;
+      nmats ++;
+    }
+  }
+
+  if (nmats > 0) {
+
+    IDEBUG_START;
+
+    FUNCTION_PROFILE_START();
+
+    buffer = (FLOAT *)blas_memory_alloc(1);
+
+    sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+    sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+
+    args.alpha = NULL;
+    args.beta  = NULL;
+#ifdef SMP
+    nthreads = num_cpu_avail(3);
+
+    args.common   = NULL;
+    args.nthreads = 1;
+#endif
+
+    /* Runs from one group go to the compact kernel, the problems that */
+    /* can use the whole pool to the end of the job list               */
+    njobs  = 0;
+#ifdef SMP
+    nlarge = 0;
+#endif
+
+    for (i = 0; i < nmats; i += k) {
+
+      g = group[i];
+
+      flag     = (ops -> flag) ? (ops -> flag)(call -> flag[g]) : 0;
+      args.m   = call -> m[g];
+      args.n   = call -> n[g];
+      args.lda = call -> lda[g];
+      if (call -> ldb) args.ldb = call -> ldb[g];
+
+      k = 1;
+
+      if ((ops -> fits)(&args)) {
+	while ((i + k < nmats) && (k < BATCH_LANES) && (group[i + k] == g)) k ++;
+      }
+
+      if (k > 1) {
+	args.a = (void *)&ptrs[i];
+	args.b = (void *)&ptrs[i + total];
+	args.c = (void *)&ptrs[i + 2 * total];
+	args.d = (void *)&ptrs[i + 3 * total];
+	args.k = k;
+	jobs[njobs] = args;
+	routines[njobs] = ops -> compact[flag];
+	njobs ++;
+	continue;
+      }
+
+      args.a = ptrs[i];
+      args.b = ptrs[i + total];
+      args.c = ptrs[i + 2 * total];
+      args.d = ptrs[i + 3 * total];
+
+#ifdef SMP
+      dim = (ops -> factor) ? MIN(args.m, args.n) : args.m;
+
+      if ((nthreads > 1) && (dim >= ops -> threshold)) {
+	/* the flag rides in k */
+	nlarge ++;
+	args.k = flag;
+	jobs[total - nlarge] = args;
+	continue;
+      }
+#endif
+
+      jobs[njobs] = args;
+      routines[njobs] = ops -> one[flag];
+      njobs ++;
+    }
+
+#ifdef SMP
+    gemm_batch_thread(mode, jobs, (int (**)())routines, njobs, sa, sb, nthreads);
+
+    for (i = total - nlarge; i < total; i++) {
+      jobs[i].nthreads = nthreads;
+      if (!ops -> factor)
+	(ops -> parallel[jobs[i].k])(&jobs[i], NULL, NULL, sa, sb, 0);
+      else if (blas_dag_use(MIN(jobs[i].m, jobs[i].n), nthreads))
+	*(blasint *)jobs[i].d = (ops -> tiled[jobs[i].k])(&jobs[i], NULL, NULL, sa, sb, 0);
+      else
+	*(blasint *)jobs[i].d = (ops -> parallel[jobs[i].k])(&jobs[i], NULL, NULL, sa, sb, 0);
+    }
+#else
+    for (i = 0; i < njobs; i++)
+      (routines[i])(&jobs[i], NULL, NULL, sa, sb, 0);
+#endif
+
+    blas_memory_free(buffer);
+
+    FUNCTION_PROFILE_END(1, nmats, 0);
+
+    IDEBUG_END;
+  }
+
+  free(jobs);
+  free(routines);
+  free(ptrs);
+  free(group);
+
+  return 0;
+}
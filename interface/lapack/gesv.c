@@ -105,6 +105,28 @@ int NAME(blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *ipiv,
 
   FUNCTION_PROFILE_START();
 
+#if !defined(COMPLEX) && !defined(XDOUBLE)
+  /* small systems are solved in place, without a buffer or threads */
+  if (args.m <= LAPACK_SMALL_THRESHOLD && args.n <= LAPACK_SMALL_THRESHOLD) {
+
+    args.n    = *N;
+    info = GETRF_SMALL(&args, NULL, NULL, NULL, NULL, 0);
+
+    if (info == 0){
+      args.n    = *NRHS;
+      GETRS_N_SMALL(&args, NULL, NULL, NULL, NULL, 0);
+    }
+
+    *Info = info;
+
+    FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, *N * *N, 2. / 3. * *N * *N * *N + *N * *N);
+
+    IDEBUG_END;
+
+    return 0;
+  }
+#endif
+
 #ifndef PPC440
   buffer = (FLOAT *)blas_memory_alloc(1);
 
@@ -115,6 +137,7 @@ int NAME(blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *ipiv,
 #ifdef SMP
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
+  if (args.m < GETRF_THREAD_THRESHOLD && args.n < GETRF_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
@@ -131,7 +154,10 @@ int NAME(blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *ipiv,
   } else {
 
     args.n    = *N;
-    info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    if (blas_dag_use(args.n, args.nthreads))
+      info = GETRF_TILED(&args, NULL, NULL, sa, sb, 0);
+    else
+      info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
 
     if (info == 0){
       args.n    = *NRHS;
@@ -86,6 +86,20 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 
   FUNCTION_PROFILE_START();
 
+#ifndef XDOUBLE
+  /* small matrices are factored in place, without a buffer or threads */
+  if (args.m <= LAPACK_SMALL_THRESHOLD && args.n <= LAPACK_SMALL_THRESHOLD) {
+
+    *Info = GETRF_SMALL(&args, NULL, NULL, NULL, NULL, 0);
+
+    FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.n,  2. / 3. * args.m * args.n * args.n);
+
+    IDEBUG_END;
+
+    return 0;
+  }
+#endif
+
 #ifndef PPC440
   buffer = (FLOAT *)blas_memory_alloc(1);
 
@@ -96,6 +110,8 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 #ifdef SMP
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
+  /* below this size the dispatch costs more than it saves */
+  if (MIN(args.m, args.n) < GETRF_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
@@ -105,7 +121,10 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 #ifdef SMP
   } else {
 
-    *Info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    if (blas_dag_use(MIN(args.m, args.n), args.nthreads))
+      *Info = GETRF_TILED(&args, NULL, NULL, sa, sb, 0);
+    else
+      *Info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
   }
 #endif
 
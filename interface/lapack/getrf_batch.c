@@ -0,0 +1,115 @@
+/*********************************************************************/
+/* Copyright 2009, 2010 The University of Texas at Austin.           */
+/* All rights reserved.                                              */
+/*                                                                   */
+/* Redistribution and use in source and binary forms, with or        */
+/* without modification, are permitted provided that the following   */
+/* conditions are met:                                               */
+/*                                                                   */
+/*   1. Redistributions of source code must retain the above         */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer.                                                  */
+/*                                                                   */
+/*   2. Redistributions in binary form must reproduce the above      */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer in the documentation and/or other materials       */
+/*      provided with the distribution.                              */
+/*                                                                   */
+/*    THIS  SOFTWARE IS PROVIDED  BY THE  UNIVERSITY OF  TEXAS AT    */
+/*    AUSTIN  ``AS IS''  AND ANY  EXPRESS OR  IMPLIED WARRANTIES,    */
+/*    INCLUDING, BUT  NOT LIMITED  TO, THE IMPLIED  WARRANTIES OF    */
+/*    MERCHANTABILITY  AND FITNESS FOR  A PARTICULAR  PURPOSE ARE    */
+/*    DISCLAIMED.  IN  NO EVENT SHALL THE UNIVERSITY  OF TEXAS AT    */
+/*    AUSTIN OR CONTRIBUTORS BE  LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL,  SPECIAL, EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES    */
+/*    (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF SUBSTITUTE    */
+/*    GOODS  OR  SERVICES; LOSS  OF  USE,  DATA,  OR PROFITS;  OR    */
+/*    BUSINESS INTERRUPTION) HOWEVER CAUSED  AND ON ANY THEORY OF    */
+/*    LIABILITY, WHETHER  IN CONTRACT, STRICT  LIABILITY, OR TORT    */
+/*    (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT    */
+/*    OF  THE  USE OF  THIS  SOFTWARE,  EVEN  IF ADVISED  OF  THE    */
+/*    POSSIBILITY OF SUCH DAMAGE.                                    */
+/*                                                                   */
+/* The views and conclusions contained in the software and           */
+/* documentation are those of the authors and should not be          */
+/* interpreted as representing official policies, either expressed   */
+/* or implied, of The University of Texas at Austin.                 */
+/*********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/* Batched LU : ?getrf_batch (grouped) and ?getrf_batch_strided */
+/* (compiled with -DSTRIDED), scheduled by batch_common.c.      */
+
+#ifdef DOUBLE
+#define ERROR_NAME "DGETRF_BATCH "
+#else
+#define ERROR_NAME "SGETRF_BATCH "
+#endif
+
+static int getrf_one(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  if (args -> m <= LAPACK_SMALL_THRESHOLD && args -> n <= LAPACK_SMALL_THRESHOLD)
+    *(blasint *)args -> d = GETRF_SMALL(args, NULL, NULL, NULL, NULL, 0);
+  else
+    *(blasint *)args -> d = GETRF_SINGLE(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+static int compact_fits(blas_arg_t *args){
+
+  return MAX(args -> m, args -> n) <= BATCH_COMPACT_MAX
+    && args -> m * args -> n * BATCH_LANES <= GEMM_P * GEMM_Q;
+}
+
+#include "batch_common.c"
+
+#ifndef STRIDED
+int NAME(blasint *m_array, blasint *n_array, FLOAT **a_array, blasint *lda_array,
+	 blasint **ipiv_array, blasint *group_count, blasint *group_size, blasint *info_array){
+#else
+int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *strideA,
+	 blasint *ipiv, blasint *strideIpiv, blasint *batch_size, blasint *info_array){
+#endif
+
+  batch_ops_t ops = {
+    NULL, compact_fits,
+    { getrf_one, NULL }, { GETRF_COMPACT, NULL },
+#ifdef SMP
+    { GETRF_PARALLEL, NULL }, { GETRF_TILED, NULL },
+#else
+    { NULL, NULL }, { NULL, NULL },
+#endif
+    GETRF_THREAD_THRESHOLD, 1,
+  };
+
+#ifndef STRIDED
+  batch_call_t call = {
+    *group_count, group_size,
+    m_array, n_array, lda_array, NULL, NULL,
+    6, 7, 1, 2, 4, 0, 0,
+    { { (void **)a_array }, { NULL }, { (void **)ipiv_array } },
+    info_array,
+  };
+#else
+  batch_call_t call = {
+    1, batch_size,
+    M, N, ldA, NULL, NULL,
+    0, 8, 1, 2, 4, 0, 0,
+    { { NULL, (char *)a, *strideA, sizeof(FLOAT), (BLASLONG)*ldA * *N, 5 },
+      { NULL },
+      { NULL, (char *)ipiv, *strideIpiv, sizeof(blasint), MIN(*M, *N), 7 } },
+    info_array,
+  };
+#endif
+
+  PRINT_DEBUG_NAME;
+
+  return batch_run(&ops, &call);
+}
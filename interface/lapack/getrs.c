@@ -54,6 +54,12 @@ static blasint (*getrs_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *,
   GETRS_N_SINGLE, GETRS_T_SINGLE,
 };
 
+#ifndef XDOUBLE
+static blasint (*getrs_small[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  GETRS_N_SMALL, GETRS_T_SMALL,
+};
+#endif
+
 #ifdef SMP
 static blasint (*getrs_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
   GETRS_N_PARALLEL, GETRS_T_PARALLEL,
@@ -117,6 +123,19 @@ int NAME(char *TRANS, blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA,
 
   FUNCTION_PROFILE_START();
 
+#ifndef XDOUBLE
+  if (args.m <= LAPACK_SMALL_THRESHOLD && args.n <= LAPACK_SMALL_THRESHOLD) {
+
+    (getrs_small[trans])(&args, NULL, NULL, NULL, NULL, 0);
+
+    FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.n, 2 * args.m * args.m * args.n);
+
+    IDEBUG_END;
+
+    return 0;
+  }
+#endif
+
 #ifndef PPC440
   buffer = (FLOAT *)blas_memory_alloc(1);
 
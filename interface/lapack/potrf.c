@@ -54,10 +54,20 @@ static blasint (*potrf_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *,
   POTRF_U_SINGLE, POTRF_L_SINGLE,
 };
 
+#ifndef XDOUBLE
+static blasint (*potrf_small[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  POTRF_U_SMALL, POTRF_L_SMALL,
+};
+#endif
+
 #ifdef SMP
 static blasint (*potrf_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
   POTRF_U_PARALLEL, POTRF_L_PARALLEL,
 };
+
+static blasint (*potrf_tiled[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  POTRF_U_TILED, POTRF_L_TILED,
+};
 #endif
 
 int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
@@ -103,6 +113,22 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 
   FUNCTION_PROFILE_START();
 
+#ifndef XDOUBLE
+  /* small matrices are factored in place, without a buffer or threads */
+  if (args.n <= LAPACK_SMALL_THRESHOLD) {
+
+    *Info = (potrf_small[uplo])(&args, NULL, NULL, NULL, NULL, 0);
+
+    FUNCTION_PROFILE_END(1, .5 * args.n * args.n,
+			 args.n * (1./3. + args.n * ( 1./2. + args.n * 1./6.))
+			 +  1./6. * args.n * (args.n * args.n - 1));
+
+    IDEBUG_END;
+
+    return 0;
+  }
+#endif
+
 #ifndef PPC440
   buffer = (FLOAT *)blas_memory_alloc(1);
 
@@ -113,6 +139,8 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 #ifdef SMP
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
+  /* below this size the dispatch costs more than it saves */
+  if (args.n < POTRF_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
@@ -121,7 +149,10 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 
 #ifdef SMP
   } else {
-    *Info = (potrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
+    if (blas_dag_use(args.n, args.nthreads))
+      *Info = (potrf_tiled[uplo])(&args, NULL, NULL, sa, sb, 0);
+    else
+      *Info = (potrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
   }
 #endif
 
@@ -0,0 +1,138 @@
+/*********************************************************************/
+/* Copyright 2009, 2010 The University of Texas at Austin.           */
+/* All rights reserved.                                              */
+/*                                                                   */
+/* Redistribution and use in source and binary forms, with or        */
+/* without modification, are permitted provided that the following   */
+/* conditions are met:                                               */
+/*                                                                   */
+/*   1. Redistributions of source code must retain the above         */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer.                                                  */
+/*                                                                   */
+/*   2. Redistributions in binary form must reproduce the above      */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer in the documentation and/or other materials       */
+/*      provided with the distribution.                              */
+/*                                                                   */
+/*    THIS  SOFTWARE IS PROVIDED  BY THE  UNIVERSITY OF  TEXAS AT    */
+/*    AUSTIN  ``AS IS''  AND ANY  EXPRESS OR  IMPLIED WARRANTIES,    */
+/*    INCLUDING, BUT  NOT LIMITED  TO, THE IMPLIED  WARRANTIES OF    */
+/*    MERCHANTABILITY  AND FITNESS FOR  A PARTICULAR  PURPOSE ARE    */
+/*    DISCLAIMED.  IN  NO EVENT SHALL THE UNIVERSITY  OF TEXAS AT    */
+/*    AUSTIN OR CONTRIBUTORS BE  LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL,  SPECIAL, EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES    */
+/*    (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF SUBSTITUTE    */
+/*    GOODS  OR  SERVICES; LOSS  OF  USE,  DATA,  OR PROFITS;  OR    */
+/*    BUSINESS INTERRUPTION) HOWEVER CAUSED  AND ON ANY THEORY OF    */
+/*    LIABILITY, WHETHER  IN CONTRACT, STRICT  LIABILITY, OR TORT    */
+/*    (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT    */
+/*    OF  THE  USE OF  THIS  SOFTWARE,  EVEN  IF ADVISED  OF  THE    */
+/*    POSSIBILITY OF SUCH DAMAGE.                                    */
+/*                                                                   */
+/* The views and conclusions contained in the software and           */
+/* documentation are those of the authors and should not be          */
+/* interpreted as representing official policies, either expressed   */
+/* or implied, of The University of Texas at Austin.                 */
+/*********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+/* Batched solves with Cholesky factors : ?potrs_batch (grouped)   */
+/* and ?potrs_batch_strided (compiled with -DSTRIDED), scheduled by */
+/* batch_common.c.                                                  */
+
+#ifdef DOUBLE
+#define ERROR_NAME "DPOTRS_BATCH "
+#else
+#define ERROR_NAME "SPOTRS_BATCH "
+#endif
+
+static int potrs_u_one(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  if (args -> m <= LAPACK_SMALL_THRESHOLD && args -> n <= LAPACK_SMALL_THRESHOLD)
+    POTRS_U_SMALL(args, NULL, NULL, NULL, NULL, 0);
+  else
+    POTRS_U_SINGLE(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+static int potrs_l_one(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid){
+
+  if (args -> m <= LAPACK_SMALL_THRESHOLD && args -> n <= LAPACK_SMALL_THRESHOLD)
+    POTRS_L_SMALL(args, NULL, NULL, NULL, NULL, 0);
+  else
+    POTRS_L_SINGLE(args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+static int get_uplo(char uplo_arg){
+
+  TOUPPER(uplo_arg);
+
+  if (uplo_arg == 'U') return 0;
+  if (uplo_arg == 'L') return 1;
+  return -1;
+}
+
+static int compact_fits(blas_arg_t *args){
+
+  return args -> m <= BATCH_COMPACT_MAX && args -> n <= BATCH_COMPACT_MAX
+    && args -> m * MAX(args -> m, args -> n) * BATCH_LANES <= GEMM_P * GEMM_Q;
+}
+
+#include "batch_common.c"
+
+#ifndef STRIDED
+int NAME(char *uplo_array, blasint *n_array, blasint *nrhs_array, FLOAT **a_array, blasint *lda_array,
+	 FLOAT **b_array, blasint *ldb_array,
+	 blasint *group_count, blasint *group_size, blasint *info_array){
+#else
+int NAME(char *UPLO, blasint *N, blasint *NRHS, FLOAT *a, blasint *ldA, blasint *strideA,
+	 FLOAT *b, blasint *ldB, blasint *strideB,
+	 blasint *batch_size, blasint *info_array){
+#endif
+
+  batch_ops_t ops = {
+    get_uplo, compact_fits,
+    { potrs_u_one, potrs_l_one }, { POTRS_U_COMPACT, POTRS_L_COMPACT },
+#ifdef SMP
+    { POTRS_U_PARALLEL, POTRS_L_PARALLEL },
+#else
+    { NULL, NULL },
+#endif
+    { NULL, NULL },
+    POTRF_THREAD_THRESHOLD, 0,
+  };
+
+#ifndef STRIDED
+  batch_call_t call = {
+    *group_count, group_size,
+    n_array, nrhs_array, lda_array, ldb_array, uplo_array,
+    8, 9, 2, 3, 5, 7, 1,
+    { { (void **)a_array }, { (void **)b_array }, { NULL } },
+    info_array,
+  };
+#else
+  batch_call_t call = {
+    1, batch_size,
+    N, NRHS, ldA, ldB, UPLO,
+    0, 10, 2, 3, 5, 8, 1,
+    { { NULL, (char *)a, *strideA, sizeof(FLOAT), (BLASLONG)*ldA * *N,    6 },
+      { NULL, (char *)b, *strideB, sizeof(FLOAT), (BLASLONG)*ldB * *NRHS, 9 },
+      { NULL } },
+    info_array,
+  };
+#endif
+
+  PRINT_DEBUG_NAME;
+
+  return batch_run(&ops, &call);
+}
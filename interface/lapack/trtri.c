@@ -128,6 +128,7 @@ int NAME(char *UPLO, char *DIAG, blasint *N, FLOAT *a, blasint *ldA, blasint *In
 
 #ifdef SMP
   args.nthreads = num_cpu_avail(4);
+  if (args.n < TRTRI_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
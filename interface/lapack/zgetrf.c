@@ -96,6 +96,7 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 #ifdef SMP
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
+  if (MIN(args.m, args.n) < GETRF_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
@@ -105,7 +106,10 @@ int NAME(blasint *M, blasint *N, FLOAT *a, blasint *ldA, blasint *ipiv, blasint
 #ifdef SMP
   } else {
 
-    *Info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
+    if (blas_dag_use(MIN(args.m, args.n), args.nthreads))
+      *Info = GETRF_TILED(&args, NULL, NULL, sa, sb, 0);
+    else
+      *Info = GETRF_PARALLEL(&args, NULL, NULL, sa, sb, 0);
 
   }
 #endif
@@ -42,6 +42,9 @@
 #include "functable.h"
 #endif
 
+/* fewer swaps than this are not worth waking the threads for */
+#define MULTI_THREAD_MINIMAL  10000
+
 static int (*laswp[])(BLASLONG, BLASLONG, BLASLONG, FLOAT, FLOAT, FLOAT *, BLASLONG, FLOAT *, BLASLONG, blasint *, BLASLONG) = {
 #ifdef XDOUBLE
   xlaswp_plus, xlaswp_minus,
@@ -78,7 +81,10 @@ int NAME(blasint *N, FLOAT *a, blasint *LDA, blasint *K1, blasint *K2, blasint *
   flag = (incx < 0);
 
 #ifdef SMP
-  nthreads = num_cpu_avail(2);
+  if ((BLASLONG)n * (k2 - k1 + 1) <= MULTI_THREAD_MINIMAL)
+    nthreads = 1;
+  else
+    nthreads = num_cpu_avail(2);
 
   if (nthreads == 1) {
 #endif
@@ -58,6 +58,10 @@ static blasint (*potrf_single[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *,
 static blasint (*potrf_parallel[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) ={
   POTRF_U_PARALLEL, POTRF_L_PARALLEL,
 };
+
+static blasint (*potrf_tiled[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
+  POTRF_U_TILED, POTRF_L_TILED,
+};
 #endif
 
 int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
@@ -113,6 +117,7 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 #ifdef SMP
   args.common = NULL;
   args.nthreads = num_cpu_avail(4);
+  if (args.n < POTRF_THREAD_THRESHOLD) args.nthreads = 1;
 
   if (args.nthreads == 1) {
 #endif
@@ -122,7 +127,10 @@ int NAME(char *UPLO, blasint *N, FLOAT *a, blasint *ldA, blasint *Info){
 #ifdef SMP
   } else {
 
-    *Info = (potrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
+    if (blas_dag_use(args.n, args.nthreads))
+      *Info = (potrf_tiled[uplo])(&args, NULL, NULL, sa, sb, 0);
+    else
+      *Info = (potrf_parallel[uplo])(&args, NULL, NULL, sa, sb, 0);
 
   }
 #endif
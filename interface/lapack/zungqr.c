@@ -0,0 +1,134 @@
+/*********************************************************************/
+/* Copyright 2009, 2010 The University of Texas at Austin.           */
+/* All rights reserved.                                              */
+/*                                                                   */
+/* Redistribution and use in source and binary forms, with or        */
+/* without modification, are permitted provided that the following   */
+/* conditions are met:                                               */
+/*                                                                   */
+/*   1. Redistributions of source code must retain the above         */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer.                                                  */
+/*                                                                   */
+/*   2. Redistributions in binary form must reproduce the above      */
+/*      copyright notice, this list of conditions and the following  */
+/*      disclaimer in the documentation and/or other materials       */
+/*      provided with the distribution.                              */
+/*                                                                   */
+/*    THIS  SOFTWARE IS PROVIDED  BY THE  UNIVERSITY OF  TEXAS AT    */
+/*    AUSTIN  ``AS IS''  AND ANY  EXPRESS OR  IMPLIED WARRANTIES,    */
+/*    INCLUDING, BUT  NOT LIMITED  TO, THE IMPLIED  WARRANTIES OF    */
+/*    MERCHANTABILITY  AND FITNESS FOR  A PARTICULAR  PURPOSE ARE    */
+/*    DISCLAIMED.  IN  NO EVENT SHALL THE UNIVERSITY  OF TEXAS AT    */
+/*    AUSTIN OR CONTRIBUTORS BE  LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL,  SPECIAL, EXEMPLARY,  OR  CONSEQUENTIAL DAMAGES    */
+/*    (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF SUBSTITUTE    */
+/*    GOODS  OR  SERVICES; LOSS  OF  USE,  DATA,  OR PROFITS;  OR    */
+/*    BUSINESS INTERRUPTION) HOWEVER CAUSED  AND ON ANY THEORY OF    */
+/*    LIABILITY, WHETHER  IN CONTRACT, STRICT  LIABILITY, OR TORT    */
+/*    (INCLUDING NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT    */
+/*    OF  THE  USE OF  THIS  SOFTWARE,  EVEN  IF ADVISED  OF  THE    */
+/*    POSSIBILITY OF SUCH DAMAGE.                                    */
+/*                                                                   */
+/* The views and conclusions contained in the software and           */
+/* documentation are those of the authors and should not be          */
+/* interpreted as representing official policies, either expressed   */
+/* or implied, of The University of Texas at Austin.                 */
+/*********************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+#ifdef FUNCTION_PROFILE
+#include "functable.h"
+#endif
+
+#ifdef XDOUBLE
+#define ERROR_NAME "XUNGQR"
+#elif defined(DOUBLE)
+#define ERROR_NAME "ZUNGQR"
+#else
+#define ERROR_NAME "CUNGQR"
+#endif
+
+/* As with geqrf, T and W live in work when lwork reaches lwkopt */
+
+int NAME(blasint *M, blasint *N, blasint *K, FLOAT *a, blasint *ldA, FLOAT *tau, FLOAT *work, blasint *lWork, blasint *Info){
+
+  blas_arg_t args;
+
+  blasint info, lwork, lwkopt;
+  FLOAT *buffer;
+#ifdef PPC440
+  extern
+#endif
+  FLOAT *sa, *sb;
+
+  PRINT_DEBUG_NAME;
+
+  args.m    = *M;
+  args.n    = *N;
+  args.k    = *K;
+  args.a    = (void *)a;
+  args.lda  = *ldA;
+  args.b    = (void *)tau;
+  args.d    = (void *)work;
+  args.ldd  = *lWork;
+
+  lwork  = *lWork;
+  lwkopt = (MAX(1, args.n) + QR_BLOCKING) * QR_BLOCKING;
+
+  info  =    0;
+  if ((lwork < MAX(1,args.n)) && (lwork != -1)) info = 8;
+  if (args.lda < MAX(1,args.m))             info = 5;
+  if ((args.k < 0) || (args.k > args.n))    info = 3;
+  if ((args.n < 0) || (args.n > args.m))    info = 2;
+  if (args.m   < 0)                         info = 1;
+  if (info) {
+    BLASFUNC(xerbla)(ERROR_NAME, &info, sizeof(ERROR_NAME));
+    *Info = - info;
+    return 0;
+  }
+
+  *Info = 0;
+  work[0] = (FLOAT)lwkopt;
+  work[1] = ZERO;
+  if (lwork == -1) return 0;
+
+  if (args.n == 0) {
+    work[0] = ONE;
+    work[1] = ZERO;
+    return 0;
+  }
+
+  IDEBUG_START;
+
+  FUNCTION_PROFILE_START();
+
+#ifndef PPC440
+  buffer = (FLOAT *)blas_memory_alloc(1);
+
+  sa = (FLOAT *)((BLASLONG)buffer + GEMM_OFFSET_A);
+  sb = (FLOAT *)(((BLASLONG)sa + ((GEMM_P * GEMM_Q * COMPSIZE * SIZE + GEMM_ALIGN) & ~GEMM_ALIGN)) + GEMM_OFFSET_B);
+#endif
+
+#ifdef SMP
+  args.common = NULL;
+  args.nthreads = num_cpu_avail(4);
+#endif
+
+  ORGQR(&args, NULL, NULL, sa, sb, 0);
+
+#ifndef PPC440
+  blas_memory_free(buffer);
+#endif
+
+  /* the drivers may have used work as scratch */
+  work[0] = (FLOAT)lwkopt;
+  work[1] = ZERO;
+
+  FUNCTION_PROFILE_END(COMPSIZE * COMPSIZE, args.m * args.n,  4. * args.m * args.n * args.k - 2. * (args.m + args.n) * args.k * args.k + 4. / 3. * args.k * args.k * args.k);
+
+  IDEBUG_END;
+
+  return 0;
+}
@@ -47,6 +47,30 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define BlasNoTrans  0
 #define BlasTrans    1
 
+#ifdef SMP
+/* Thread bodies for blas_level1_thread, which splits its m : the columns */
+/* of a column major A and the rows of a row major one                    */
+static int omatcopy_cn_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc, void *sb)
+{
+	return OMATCOPY_K_CN(n, m, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_ct_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc, void *sb)
+{
+	return OMATCOPY_K_CT(n, m, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_rn_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc, void *sb)
+{
+	return OMATCOPY_K_RN(m, n, alpha, a, lda, b, ldb);
+}
+
+static int omatcopy_rt_thread(BLASLONG m, BLASLONG n, BLASLONG dummy, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb, FLOAT *c, BLASLONG ldc, void *sb)
+{
+	return OMATCOPY_K_RT(m, n, alpha, a, lda, b, ldb);
+}
+#endif
+
 #ifndef CBLAS 
 void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha, FLOAT *a, blasint *lda, FLOAT *b, blasint *ldb)
 {
@@ -54,6 +78,9 @@ void NAME( char* ORDER, char* TRANS, blasint *rows, blasint *cols, FLOAT *alpha,
 	char Order, Trans;
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	Order = *ORDER;
 	Trans = *TRANS;
@@ -74,6 +101,9 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
 	FLOAT   *alpha; 
 	int order=-1,trans=-1;
 	blasint info = -1;
+#ifdef SMP
+	int mode, nthreads;
+#endif
 
 	if ( CORDER == CblasColMajor ) order = BlasColMajor; 
 	if ( CORDER == CblasRowMajor ) order = BlasRowMajor; 
@@ -111,6 +141,31 @@ void CNAME(enum CBLAS_ORDER CORDER, enum CBLAS_TRANSPOSE CTRANS, blasint crows,
     		return;
   	}
 
+#ifdef SMP
+	nthreads = blas_model_threads(ERROR_NAME, (double) *rows * (double) *cols, 0.,
+				      MATCOPY_THREAD_THRESHOLD, num_cpu_avail(1));
+
+	if ( nthreads > 1 )
+	{
+#ifdef DOUBLE
+		mode = BLAS_DOUBLE | BLAS_REAL;
+#else
+		mode = BLAS_SINGLE | BLAS_REAL;
+#endif
+		if ( trans == BlasTrans ) mode |= BLAS_TRANSB_T;
+
+		if ( order == BlasColMajor )
+			blas_level1_thread(mode, *cols, *rows, 0, alpha, a, *lda, b, *ldb, NULL, 0,
+					   trans == BlasNoTrans ? (void *) omatcopy_cn_thread : (void *) omatcopy_ct_thread,
+					   nthreads);
+		else
+			blas_level1_thread(mode, *rows, *cols, 0, alpha, a, *lda, b, *ldb, NULL, 0,
+					   trans == BlasNoTrans ? (void *) omatcopy_rn_thread : (void *) omatcopy_rt_thread,
+					   nthreads);
+		return;
+	}
+#endif
+
 	if ( order == BlasColMajor )
 	{
 		if ( trans == BlasNoTrans )
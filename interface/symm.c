@@ -43,6 +43,12 @@
 #include "functable.h"
 #endif
 
+#ifndef COMPLEX
+#define SMP_THRESHOLD_MIN 65536.0
+#else
+#define SMP_THRESHOLD_MIN 8192.0
+#endif
+
 #ifndef COMPLEX
 #ifdef XDOUBLE
 #define ERROR_NAME "QSYMM "
@@ -375,7 +381,12 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_SIDE Side, enum CBLAS_UPLO Uplo,
 
 #ifdef SMP
   args.common = NULL;
-  args.nthreads = num_cpu_avail(3);
+  /* A is args.m (left) or args.n (right) square, both packed */
+  args.nthreads = blas_model_threads(ERROR_NAME,
+				     (double) args.m * (double) args.n * (double) (side ? args.n : args.m),
+				     BLAS_PACK_COST * ((double) args.m + (double) args.n) * (double) (side ? args.n : args.m),
+				     SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD,
+				     num_cpu_avail(3));
 
   if (args.nthreads == 1) {
 #endif
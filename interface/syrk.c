@@ -43,6 +43,12 @@
 #include "functable.h"
 #endif
 
+#ifndef COMPLEX
+#define SMP_THRESHOLD_MIN 65536.0
+#else
+#define SMP_THRESHOLD_MIN 8192.0
+#endif
+
 #ifndef COMPLEX
 #ifdef XDOUBLE
 #define ERROR_NAME "QSYRK "
@@ -354,7 +360,12 @@ void CNAME(enum CBLAS_ORDER order, enum CBLAS_UPLO Uplo, enum CBLAS_TRANSPOSE Tr
 #endif
 
   args.common = NULL;
-  args.nthreads = num_cpu_avail(3);
+  /* Half of C is computed, A is packed on both sides */
+  args.nthreads = blas_model_threads(ERROR_NAME,
+				     0.5 * (double) args.n * (double) args.n * (double) args.k,
+				     BLAS_PACK_COST * 2.0 * (double) args.n * (double) args.k,
+				     SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD,
+				     num_cpu_avail(3));
 
   if (args.nthreads == 1) {
 #endif
@@ -82,9 +82,9 @@
 #endif
 
 #ifndef COMPLEX
-#define SMP_FACTOR 256
+#define SMP_THRESHOLD_MIN 8192.0
 #else
-#define SMP_FACTOR 128
+#define SMP_THRESHOLD_MIN 1024.0
 #endif
 
 static int (*trsm[])(blas_arg_t *, BLASLONG *, BLASLONG *, FLOAT *, FLOAT *, BLASLONG) = {
@@ -379,11 +379,14 @@ void CNAME(enum CBLAS_ORDER order,
 	if ( args.n < 2 * GEMM_MULTITHREAD_THRESHOLD )
 		args.nthreads = 1;
 */
-  if ( args.m * args.n < SMP_FACTOR * GEMM_MULTITHREAD_THRESHOLD)
-	args.nthreads = 1;
-  else
-	args.nthreads = num_cpu_avail(3);
-		
+  /* Half of the triangle times B; B columns (rows) are split, so */
+  /* threads do not synchronise and the cutoff is lower than gemm's */
+  args.nthreads = blas_model_threads(ERROR_NAME,
+				     0.5 * (double) args.m * (double) args.n * (double) (side ? args.n : args.m),
+				     BLAS_PACK_COST * (0.5 * (double) (side ? args.n : args.m) + (double) (side ? args.m : args.n)) * (double) (side ? args.n : args.m),
+				     SMP_THRESHOLD_MIN * (double) GEMM_MULTITHREAD_THRESHOLD,
+				     num_cpu_avail(3));
+
 
   if (args.nthreads == 1) {
 #endif
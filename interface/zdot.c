@@ -52,6 +52,53 @@
 #endif
 #endif
 
+#ifndef CONJ
+#define ZDOT_K	DOTU_K
+#else
+#define ZDOT_K	DOTC_K
+#endif
+
+#if defined(SMP) && !defined(XDOUBLE)
+static int zdot_chunk(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy,
+		      blas_reduce_t *result){
+
+  OPENBLAS_COMPLEX_FLOAT ret = ZDOT_K(n, x, incx, y, incy);
+
+  result -> value[0] = (double)CREAL(ret);
+  result -> value[1] = (double)CIMAG(ret);
+
+  return 0;
+}
+#endif
+
+static OPENBLAS_COMPLEX_FLOAT zdot_compute(BLASLONG n, FLOAT *x, BLASLONG incx, FLOAT *y, BLASLONG incy){
+
+#if defined(SMP) && !defined(XDOUBLE)
+  blas_reduce_t result;
+  int mode, nthreads = 1;
+
+  if (n > DOT_REDUCE_THRESHOLD / 2)
+    nthreads = blas_model_threads("ZDOT", (double)n * 2., 0., DOT_REDUCE_THRESHOLD, num_cpu_avail(1));
+
+  /* reproducible mode always goes through the fixed chunking */
+  if ((nthreads > 1) || (openblas_reproducible() && (n > BLAS_REDUCE_REPRO_CHUNK))) {
+
+#ifdef DOUBLE
+    mode  =  BLAS_DOUBLE | BLAS_COMPLEX;
+#else
+    mode  =  BLAS_SINGLE | BLAS_COMPLEX;
+#endif
+
+    blas_level1_reduce(mode, BLAS_REDUCE_SUM, n, x, incx, y, incy,
+		       (void *)zdot_chunk, &result, nthreads);
+
+    return OPENBLAS_MAKE_COMPLEX_FLOAT((FLOAT)result.value[0], (FLOAT)result.value[1]);
+  }
+#endif
+
+  return ZDOT_K(n, x, incx, y, incy);
+}
+
 #ifndef CBLAS
 
 #ifdef RETURN_BY_STRUCT
@@ -100,11 +147,7 @@ OPENBLAS_COMPLEX_FLOAT NAME(                        blasint *N, FLOAT *x, blasin
 
 #ifdef RETURN_BY_STRUCT
 
-#ifndef CONJ
-  ret = DOTU_K(n, x, incx, y, incy);
-#else
-  ret = DOTC_K(n, x, incx, y, incy);
-#endif
+  ret = zdot_compute(n, x, incx, y, incy);
 
   myret.r = CREAL ret;
   myret.i = CIMAG ret;
@@ -117,11 +160,7 @@ OPENBLAS_COMPLEX_FLOAT NAME(                        blasint *N, FLOAT *x, blasin
 
 #elif defined RETURN_BY_STACK
 
-#ifndef CONJ
-  *result = DOTU_K(n, x, incx, y, incy);
-#else
-  *result = DOTC_K(n, x, incx, y, incy);
-#endif
+  *result = zdot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(4, 2 * n, 2 * n);
 
@@ -129,11 +168,7 @@ OPENBLAS_COMPLEX_FLOAT NAME(                        blasint *N, FLOAT *x, blasin
 
 #else
 
-#ifndef CONJ
-  ret = DOTU_K(n, x, incx, y, incy);
-#else
-  ret = DOTC_K(n, x, incx, y, incy);
-#endif
+  ret = zdot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(4, 2 * n, 2 * n);
 
@@ -182,11 +217,7 @@ OPENBLAS_COMPLEX_FLOAT CNAME(blasint n, void *vx, blasint incx, void *vy, blasin
 
 #ifdef FORCE_USE_STACK
 
-#ifndef CONJ
-  *result = DOTU_K(n, x, incx, y, incy);
-#else
-  *result = DOTC_K(n, x, incx, y, incy);
-#endif
+  *result = zdot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(4, 2 * n, 2 * n);
 
@@ -194,11 +225,7 @@ OPENBLAS_COMPLEX_FLOAT CNAME(blasint n, void *vx, blasint incx, void *vy, blasin
 
 #else
 
-#ifndef CONJ
-  ret = DOTU_K(n, x, incx, y, incy);
-#else
-  ret = DOTC_K(n, x, incx, y, incy);
-#endif
+  ret = zdot_compute(n, x, incx, y, incy);
 
   FUNCTION_PROFILE_END(4, 2 * n, 2 * n);
 
@@ -252,10 +252,9 @@ void CNAME(enum CBLAS_ORDER order,
 
 #ifdef SMP
 
-  if ( 1L * m * n < 1024L * GEMM_MULTITHREAD_THRESHOLD )
-    nthreads = 1;
-  else
-    nthreads = num_cpu_avail(2);
+  nthreads = blas_model_threads(ERROR_NAME, (double) m * (double) n, 0.0,
+				1024.0 * (double) GEMM_MULTITHREAD_THRESHOLD,
+				num_cpu_avail(2));
 
   if (nthreads == 1) {
 #endif
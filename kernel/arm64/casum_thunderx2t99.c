@@ -233,7 +233,7 @@ FLOAT CNAME(BLASLONG n, FLOAT *x, BLASLONG inc_x)
 	FLOAT asum = 0.0;
 
 #if defined(SMP)
-	if (inc_x == 0 || n <= 10000)
+	if (inc_x == 0 || n <= 10000 || openblas_reproducible())
 		nthreads = 1;
 	else
 		nthreads = num_cpu_avail(1);
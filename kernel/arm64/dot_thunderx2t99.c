@@ -384,7 +384,7 @@ RETURN_TYPE CNAME(BLASLONG n, FLOAT *x, BLASLONG inc_x, FLOAT *y, BLASLONG inc_y
 	RETURN_TYPE dot = 0.0;
 
 #if defined(SMP)
-	if (inc_x == 0 || inc_y == 0 || n <= 10000)
+	if (inc_x == 0 || inc_y == 0 || n <= 10000 || openblas_reproducible())
 		nthreads = 1;
 	else
 		nthreads = num_cpu_avail(1);
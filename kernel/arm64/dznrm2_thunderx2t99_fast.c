@@ -235,7 +235,7 @@ FLOAT CNAME(BLASLONG n, FLOAT *x, BLASLONG inc_x)
 	if (n <= 0 || inc_x <= 0) return 0.0;
 
 #if defined(SMP)
-	if (n <= 10000)
+	if (n <= 10000 || openblas_reproducible())
 		nthreads = 1;
 	else
 		nthreads = num_cpu_avail(1);
@@ -0,0 +1,76 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * C := op(A) * B + beta * C for a narrow B (n <= GEMM_SKINNY_N), reading
+ * A in place. B is a block the skinny driver packed and scaled by alpha:
+ * row by row (b[l * n + j]) without TRANSA, column by column
+ * (b[l + j * k]) with TRANSA. C(i, j) is c[i * incc + j * ldc].
+ */
+
+#ifndef TRANSA
+#define A_ELEM(i, l)	a[(i) + (l) * lda]
+#define B_ELEM(l, j)	b[(l) * n + (j)]
+#else
+#define A_ELEM(i, l)	a[(l) + (i) * lda]
+#define B_ELEM(l, j)	b[(l) + (j) * k]
+#endif
+
+#define STORE_C(ptr, r) \
+	if (beta == ZERO) *(ptr) = (r); \
+	else *(ptr) = beta * *(ptr) + (r)
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *a, BLASLONG lda,
+	  FLOAT *b, FLOAT beta, FLOAT *c, BLASLONG incc, BLASLONG ldc)
+{
+	BLASLONG i, j, l, p, mm;
+	FLOAT t[GEMM_SKINNY_N][4];
+
+	/* four rows of C at a time, each element of A is read once */
+	for (i = 0; i < m; i += 4) {
+		mm = MIN(m - i, 4);
+
+		for (j = 0; j < n; j++)
+			for (p = 0; p < 4; p++) t[j][p] = ZERO;
+
+		for (l = 0; l < k; l++) {
+			for (j = 0; j < n; j++) {
+				for (p = 0; p < mm; p++)
+					t[j][p] += A_ELEM(i + p, l) * B_ELEM(l, j);
+			}
+		}
+
+		for (j = 0; j < n; j++)
+			for (p = 0; p < mm; p++) {
+				STORE_C(&c[(i + p) * incc + j * ldc], t[j][p]);
+			}
+	}
+
+	return(0);
+}
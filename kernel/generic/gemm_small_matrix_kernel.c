@@ -0,0 +1,67 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+
+/*
+ * C := alpha * op(A) * op(B) + beta * C on the caller's arrays, without
+ * packing. Only meant for the tiny problems selected in interface/gemm.c.
+ */
+
+#ifndef TRANSA
+#define A_ELEM(i, l)	a[(i) + (l) * lda]
+#else
+#define A_ELEM(i, l)	a[(l) + (i) * lda]
+#endif
+
+#ifndef TRANSB
+#define B_ELEM(l, j)	b[(l) + (j) * ldb]
+#else
+#define B_ELEM(l, j)	b[(j) + (l) * ldb]
+#endif
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha, FLOAT *a, BLASLONG lda,
+	  FLOAT *b, BLASLONG ldb, FLOAT beta, FLOAT *c, BLASLONG ldc)
+{
+	BLASLONG i, j, l;
+	FLOAT result;
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < m; i++) {
+			result = ZERO;
+			for (l = 0; l < k; l++)
+				result += A_ELEM(i, l) * B_ELEM(l, j);
+
+			if (beta == ZERO)
+				c[i + j * ldc] = alpha * result;
+			else
+				c[i + j * ldc] = alpha * result + beta * c[i + j * ldc];
+		}
+	}
+
+	return(0);
+}
@@ -642,7 +642,19 @@ gotoblas_t TABLE_NAME = {
   zimatcopy_k_cnTS, zimatcopy_k_ctTS, zimatcopy_k_rnTS, zimatcopy_k_rtTS,
   zimatcopy_k_cncTS, zimatcopy_k_ctcTS, zimatcopy_k_rncTS, zimatcopy_k_rtcTS,
 
-  sgeadd_kTS, dgeadd_kTS, cgeadd_kTS, zgeadd_kTS
+  sgeadd_kTS, dgeadd_kTS, cgeadd_kTS, zgeadd_kTS,
+
+  SGEMM_DEFAULT_SMALL_THRESHOLD, DGEMM_DEFAULT_SMALL_THRESHOLD,
+
+  LAPACK_DEFAULT_SMALL_THRESHOLD,
+  POTRF_DEFAULT_THREAD_THRESHOLD, GETRF_DEFAULT_THREAD_THRESHOLD,
+  LAUUM_DEFAULT_THREAD_THRESHOLD, TRTRI_DEFAULT_THREAD_THRESHOLD,
+
+  sgemm_small_kernel_nnTS, sgemm_small_kernel_ntTS, sgemm_small_kernel_tnTS, sgemm_small_kernel_ttTS,
+  dgemm_small_kernel_nnTS, dgemm_small_kernel_ntTS, dgemm_small_kernel_tnTS, dgemm_small_kernel_ttTS,
+
+  sgemm_skinny_kernel_nTS, sgemm_skinny_kernel_tTS,
+  dgemm_skinny_kernel_nTS, dgemm_skinny_kernel_tTS
 
 };
 
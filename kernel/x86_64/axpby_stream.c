@@ -0,0 +1,89 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * ?axpby for x86_64 : y := alpha * x + beta * y. With beta = 0 y is not
+ * read, and outputs larger than the last level cache are written with
+ * non-temporal stores (see BLAS_STREAM in common.h).
+ */
+
+#include "common.h"
+#include "stream_microk_sse2-2.c"
+
+int CNAME(BLASLONG n, FLOAT alpha, FLOAT *x, BLASLONG inc_x, FLOAT beta, FLOAT *y, BLASLONG inc_y)
+{
+	BLASLONG i, ix, iy;
+
+	if ( n <= 0 )  return(0);
+
+	if ( inc_x == 1 && inc_y == 1 )
+	{
+		if ( beta == 0.0 )
+		{
+			if ( BLAS_STREAM(n * sizeof(FLOAT)) )
+			{
+				if ( alpha == 0.0 )
+					stream_zero(n, 1, y, n);
+				else
+					stream_scal(n, alpha, x, y);
+				return(0);
+			}
+
+			if ( alpha == 0.0 )
+				for ( i = 0; i < n; i++ ) y[i] = 0.0;
+			else
+				for ( i = 0; i < n; i++ ) y[i] = alpha * x[i];
+			return(0);
+		}
+
+		if ( alpha == 0.0 )
+			for ( i = 0; i < n; i++ ) y[i] = beta * y[i];
+		else
+			for ( i = 0; i < n; i++ ) y[i] = alpha * x[i] + beta * y[i];
+		return(0);
+	}
+
+	ix = 0;
+	iy = 0;
+
+	if ( beta == 0.0 )
+	{
+		if ( alpha == 0.0 )
+			for ( i = 0; i < n; i++, iy += inc_y ) y[iy] = 0.0;
+		else
+			for ( i = 0; i < n; i++, ix += inc_x, iy += inc_y ) y[iy] = alpha * x[ix];
+		return(0);
+	}
+
+	if ( alpha == 0.0 )
+		for ( i = 0; i < n; i++, iy += inc_y ) y[iy] = beta * y[iy];
+	else
+		for ( i = 0; i < n; i++, ix += inc_x, iy += inc_y ) y[iy] = alpha * x[ix] + beta * y[iy];
+
+	return(0);
+}
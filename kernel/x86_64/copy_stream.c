@@ -0,0 +1,57 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * ?copy for x86_64 : outputs larger than the last level cache are
+ * written with non-temporal stores (see BLAS_STREAM in common.h),
+ * everything else goes to the ?COPYASMKERNEL (copy_sse.S, copy_sse2.S).
+ */
+
+#include "common.h"
+#include "stream_microk_sse2-2.c"
+
+#define COPY_ASM_KNAME(A, B)	KNAME(A, B)
+
+#ifndef DOUBLE
+#define COPY_ASM_K		COPY_ASM_KNAME(scopy_asm_k, TS)
+#else
+#define COPY_ASM_K		COPY_ASM_KNAME(dcopy_asm_k, TS)
+#endif
+
+int COPY_ASM_K(BLASLONG n, FLOAT *x, BLASLONG inc_x, FLOAT *y, BLASLONG inc_y);
+
+int CNAME(BLASLONG n, FLOAT *x, BLASLONG inc_x, FLOAT *y, BLASLONG inc_y)
+{
+	if ( n > 0 && inc_x == 1 && inc_y == 1 && BLAS_STREAM(n * sizeof(FLOAT)) )
+	{
+		stream_copy(n, x, y);
+		return(0);
+	}
+
+	return(COPY_ASM_K(n, x, inc_x, y, inc_y));
+}
@@ -37,6 +37,8 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "dscal_microk_skylakex-2.c"
 #endif
 
+#include "stream_microk_sse2-2.c"
+
 
 #if !defined(HAVE_KERNEL_8)
 
@@ -136,10 +138,10 @@ static void dscal_kernel_inc_8(BLASLONG n, FLOAT *alpha, FLOAT *x, BLASLONG inc_
 	"jnz    1b					    \n\t"
 
         :
+          "+r" (n),     // 0
+          "+r" (x),     // 1
+          "+r" (x1)     // 2
         :
-          "r" (n),      // 0
-          "r" (x),      // 1
-          "r" (x1),     // 2
           "r" (alpha),  // 3
           "r" (inc_x),  // 4
           "r" (inc_x3)  // 5
@@ -210,6 +212,12 @@ int CNAME(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT da, FLOAT *x, BLAS
 		return(0);
 	}
 
+	if ( da == 0.0 && BLAS_STREAM(n * sizeof(FLOAT)) )
+	{
+		stream_zero(n, 1, x, n);
+		return(0);
+	}
+
 	BLASLONG n1 = n & -8;
 	if ( n1 > 0 )
 	{
@@ -0,0 +1,297 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * Skinny GEMM: C := op(A) * B + beta * C for n <= GEMM_SKINNY_N, with B
+ * packed and scaled by alpha by the skinny driver (layouts as in
+ * ../generic/gemm_skinny_kernel.c). A is streamed once per call, with
+ * the B values of four of its rows or columns in registers.
+ * Uses AVX-512 when built for SKYLAKEX and AVX2 otherwise.
+ */
+
+#include "common.h"
+
+#if !defined(__AVX2__)
+#include "../generic/gemm_skinny_kernel.c"
+#else
+
+#include <immintrin.h>
+
+#if defined(__AVX512F__)
+#ifdef DOUBLE
+#define VLEN		8
+#define VEC		__m512d
+#define VZERO()		_mm512_setzero_pd()
+#define VSET1(x)	_mm512_set1_pd(x)
+#define VLOAD(p)	_mm512_loadu_pd(p)
+#define VSTORE(p, v)	_mm512_storeu_pd(p, v)
+#define VFMA(a, b, c)	_mm512_fmadd_pd(a, b, c)
+#define VSUM(v)		_mm512_reduce_add_pd(v)
+#else
+#define VLEN		16
+#define VEC		__m512
+#define VZERO()		_mm512_setzero_ps()
+#define VSET1(x)	_mm512_set1_ps(x)
+#define VLOAD(p)	_mm512_loadu_ps(p)
+#define VSTORE(p, v)	_mm512_storeu_ps(p, v)
+#define VFMA(a, b, c)	_mm512_fmadd_ps(a, b, c)
+#define VSUM(v)		_mm512_reduce_add_ps(v)
+#endif
+#else
+#ifdef DOUBLE
+#define VLEN		4
+#define VEC		__m256d
+#define VZERO()		_mm256_setzero_pd()
+#define VSET1(x)	_mm256_set1_pd(x)
+#define VLOAD(p)	_mm256_loadu_pd(p)
+#define VSTORE(p, v)	_mm256_storeu_pd(p, v)
+#ifdef __FMA__
+#define VFMA(a, b, c)	_mm256_fmadd_pd(a, b, c)
+#else
+#define VFMA(a, b, c)	_mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+#else
+#define VLEN		8
+#define VEC		__m256
+#define VZERO()		_mm256_setzero_ps()
+#define VSET1(x)	_mm256_set1_ps(x)
+#define VLOAD(p)	_mm256_loadu_ps(p)
+#define VSTORE(p, v)	_mm256_storeu_ps(p, v)
+#ifdef __FMA__
+#define VFMA(a, b, c)	_mm256_fmadd_ps(a, b, c)
+#else
+#define VFMA(a, b, c)	_mm256_add_ps(_mm256_mul_ps(a, b), c)
+#endif
+#endif
+#endif
+
+#if !defined(__AVX512F__)
+static inline FLOAT vsum(VEC v)
+{
+	FLOAT t[VLEN];
+	FLOAT s = ZERO;
+	int i;
+
+	VSTORE(t, v);
+	for (i = 0; i < VLEN; i++) s += t[i];
+	return s;
+}
+#define VSUM(v)		vsum(v)
+#endif
+
+#ifndef TRANSA
+#define A_ELEM(i, l)	a[(i) + (l) * lda]
+#define B_ELEM(l, j)	b[(l) * n + (j)]
+#else
+#define A_ELEM(i, l)	a[(l) + (i) * lda]
+#define B_ELEM(l, j)	b[(l) + (j) * k]
+#endif
+
+#define C_ELEM(i, j)	c[(i) * incc + (j) * ldc]
+
+#define STORE_C(ptr, r) \
+	if (beta == ZERO) *(ptr) = (r); \
+	else *(ptr) = beta * *(ptr) + (r)
+
+/* Without TRANSA, C is summed in t by blocks of rows, SKINNY_COLS */
+/* columns of A at a time. Long column segments and few of them    */
+/* keep the hardware prefetchers streaming A.                       */
+#define SKINNY_T	4096
+#define SKINNY_COLS	16
+
+#define T_ELEM(i, j)	t[(i) + (j) * rb]
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT *a, BLASLONG lda,
+	  FLOAT *b, FLOAT beta, FLOAT *c, BLASLONG incc, BLASLONG ldc)
+{
+	BLASLONG i, j, l;
+
+#ifndef TRANSA
+	BLASLONG is, mb, mv, ls, le, rb;
+	FLOAT t[SKINNY_T];
+
+	/* A columns are contiguous. Register tiles of 2 * VLEN rows by 4 */
+	/* columns of C run down SKINNY_COLS columns of A, the tiles being */
+	/* kept in t (a block of rb rows of C) between the column blocks.  */
+	rb = (SKINNY_T / n) & ~(2 * VLEN - 1);
+	if (rb > 1024) rb = 1024;
+
+	for (is = 0; is < m; is += rb) {
+		mb = MIN(m - is, rb);
+		mv = mb & ~(VLEN - 1);
+
+		for (i = 0; i < n * rb; i++) t[i] = ZERO;
+
+		for (ls = 0; ls < k; ls += SKINNY_COLS) {
+			le = MIN(k, ls + SKINNY_COLS);
+
+			for (i = 0; i + 2 * VLEN <= mb; i += 2 * VLEN) {
+				for (j = 0; j + 4 <= n; j += 4) {
+					VEC c00 = VLOAD(&T_ELEM(i, j + 0)), c10 = VLOAD(&T_ELEM(i + VLEN, j + 0));
+					VEC c01 = VLOAD(&T_ELEM(i, j + 1)), c11 = VLOAD(&T_ELEM(i + VLEN, j + 1));
+					VEC c02 = VLOAD(&T_ELEM(i, j + 2)), c12 = VLOAD(&T_ELEM(i + VLEN, j + 2));
+					VEC c03 = VLOAD(&T_ELEM(i, j + 3)), c13 = VLOAD(&T_ELEM(i + VLEN, j + 3));
+					for (l = ls; l < le; l++) {
+						VEC a0 = VLOAD(&A_ELEM(is + i, l));
+						VEC a1 = VLOAD(&A_ELEM(is + i + VLEN, l));
+						VEC b0 = VSET1(B_ELEM(l, j + 0));
+						VEC b1 = VSET1(B_ELEM(l, j + 1));
+						VEC b2 = VSET1(B_ELEM(l, j + 2));
+						VEC b3 = VSET1(B_ELEM(l, j + 3));
+						c00 = VFMA(a0, b0, c00); c10 = VFMA(a1, b0, c10);
+						c01 = VFMA(a0, b1, c01); c11 = VFMA(a1, b1, c11);
+						c02 = VFMA(a0, b2, c02); c12 = VFMA(a1, b2, c12);
+						c03 = VFMA(a0, b3, c03); c13 = VFMA(a1, b3, c13);
+					}
+					VSTORE(&T_ELEM(i, j + 0), c00); VSTORE(&T_ELEM(i + VLEN, j + 0), c10);
+					VSTORE(&T_ELEM(i, j + 1), c01); VSTORE(&T_ELEM(i + VLEN, j + 1), c11);
+					VSTORE(&T_ELEM(i, j + 2), c02); VSTORE(&T_ELEM(i + VLEN, j + 2), c12);
+					VSTORE(&T_ELEM(i, j + 3), c03); VSTORE(&T_ELEM(i + VLEN, j + 3), c13);
+				}
+				for (; j < n; j++) {
+					VEC c00 = VLOAD(&T_ELEM(i, j)), c10 = VLOAD(&T_ELEM(i + VLEN, j));
+					for (l = ls; l < le; l++) {
+						VEC b0 = VSET1(B_ELEM(l, j));
+						c00 = VFMA(VLOAD(&A_ELEM(is + i, l)), b0, c00);
+						c10 = VFMA(VLOAD(&A_ELEM(is + i + VLEN, l)), b0, c10);
+					}
+					VSTORE(&T_ELEM(i, j), c00); VSTORE(&T_ELEM(i + VLEN, j), c10);
+				}
+			}
+
+			for (; i + VLEN <= mb; i += VLEN) {
+				for (j = 0; j < n; j++) {
+					VEC c00 = VLOAD(&T_ELEM(i, j));
+					for (l = ls; l < le; l++)
+						c00 = VFMA(VLOAD(&A_ELEM(is + i, l)), VSET1(B_ELEM(l, j)), c00);
+					VSTORE(&T_ELEM(i, j), c00);
+				}
+			}
+
+			for (; i < mb; i++) {
+				for (j = 0; j < n; j++) {
+					FLOAT r0 = T_ELEM(i, j);
+					for (l = ls; l < le; l++)
+						r0 += A_ELEM(is + i, l) * B_ELEM(l, j);
+					T_ELEM(i, j) = r0;
+				}
+			}
+		}
+
+		for (j = 0; j < n; j++) {
+			FLOAT *tj = &T_ELEM(0, j);
+			FLOAT *cj = &C_ELEM(is, j);
+
+			if (incc == 1) {
+				if (beta == ZERO) {
+					for (i = 0; i < mv; i += VLEN) VSTORE(cj + i, VLOAD(tj + i));
+				} else {
+					VEC vbeta = VSET1(beta);
+					for (i = 0; i < mv; i += VLEN)
+						VSTORE(cj + i, VFMA(VLOAD(cj + i), vbeta, VLOAD(tj + i)));
+				}
+				for (; i < mb; i++) {
+					STORE_C(&cj[i], tj[i]);
+				}
+			} else {
+				for (i = 0; i < mb; i++) {
+					STORE_C(&cj[i * incc], tj[i]);
+				}
+			}
+		}
+	}
+
+#else
+
+	/* rows of op(A) and columns of B are contiguous: dot products along K, */
+	/* two rows of C against four columns of B at a time                   */
+	for (i = 0; i + 2 <= m; i += 2) {
+		for (j = 0; j + 4 <= n; j += 4) {
+			VEC s00 = VZERO(), s01 = VZERO(), s02 = VZERO(), s03 = VZERO();
+			VEC s10 = VZERO(), s11 = VZERO(), s12 = VZERO(), s13 = VZERO();
+			FLOAT r[2][4];
+			BLASLONG p, q;
+			for (l = 0; l + VLEN <= k; l += VLEN) {
+				VEC a0 = VLOAD(&A_ELEM(i + 0, l));
+				VEC a1 = VLOAD(&A_ELEM(i + 1, l));
+				VEC b0 = VLOAD(&B_ELEM(l, j + 0));
+				VEC b1 = VLOAD(&B_ELEM(l, j + 1));
+				VEC b2 = VLOAD(&B_ELEM(l, j + 2));
+				VEC b3 = VLOAD(&B_ELEM(l, j + 3));
+				s00 = VFMA(a0, b0, s00); s10 = VFMA(a1, b0, s10);
+				s01 = VFMA(a0, b1, s01); s11 = VFMA(a1, b1, s11);
+				s02 = VFMA(a0, b2, s02); s12 = VFMA(a1, b2, s12);
+				s03 = VFMA(a0, b3, s03); s13 = VFMA(a1, b3, s13);
+			}
+			r[0][0] = VSUM(s00); r[0][1] = VSUM(s01); r[0][2] = VSUM(s02); r[0][3] = VSUM(s03);
+			r[1][0] = VSUM(s10); r[1][1] = VSUM(s11); r[1][2] = VSUM(s12); r[1][3] = VSUM(s13);
+			for (; l < k; l++)
+				for (p = 0; p < 2; p++)
+					for (q = 0; q < 4; q++) r[p][q] += A_ELEM(i + p, l) * B_ELEM(l, j + q);
+			for (p = 0; p < 2; p++)
+				for (q = 0; q < 4; q++) {
+					STORE_C(&C_ELEM(i + p, j + q), r[p][q]);
+				}
+		}
+		for (; j < n; j++) {
+			VEC s00 = VZERO(), s10 = VZERO();
+			FLOAT r0, r1;
+			for (l = 0; l + VLEN <= k; l += VLEN) {
+				VEC b0 = VLOAD(&B_ELEM(l, j));
+				s00 = VFMA(VLOAD(&A_ELEM(i + 0, l)), b0, s00);
+				s10 = VFMA(VLOAD(&A_ELEM(i + 1, l)), b0, s10);
+			}
+			r0 = VSUM(s00);
+			r1 = VSUM(s10);
+			for (; l < k; l++) {
+				r0 += A_ELEM(i + 0, l) * B_ELEM(l, j);
+				r1 += A_ELEM(i + 1, l) * B_ELEM(l, j);
+			}
+			STORE_C(&C_ELEM(i + 0, j), r0);
+			STORE_C(&C_ELEM(i + 1, j), r1);
+		}
+	}
+
+	for (; i < m; i++) {
+		for (j = 0; j < n; j++) {
+			VEC s00 = VZERO();
+			FLOAT r0;
+			for (l = 0; l + VLEN <= k; l += VLEN)
+				s00 = VFMA(VLOAD(&A_ELEM(i, l)), VLOAD(&B_ELEM(l, j)), s00);
+			r0 = VSUM(s00);
+			for (; l < k; l++)
+				r0 += A_ELEM(i, l) * B_ELEM(l, j);
+			STORE_C(&C_ELEM(i, j), r0);
+		}
+	}
+
+#endif
+
+	return(0);
+}
+
+#endif
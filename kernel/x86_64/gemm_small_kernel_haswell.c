@@ -0,0 +1,267 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/*
+ * Unpacked GEMM for tiny problems: C := alpha * op(A) * op(B) + beta * C,
+ * reading A, B and C in place. Compiled four times with TRANSA / TRANSB
+ * selecting the NN, NT, TN and TT variants. Uses AVX-512 when built for
+ * SKYLAKEX and AVX2 otherwise.
+ */
+
+#include "common.h"
+
+#if !defined(__AVX2__)
+#include "../generic/gemm_small_matrix_kernel.c"
+#else
+
+#include <immintrin.h>
+
+#if defined(__AVX512F__)
+#ifdef DOUBLE
+#define VLEN		8
+#define VEC		__m512d
+#define VZERO()		_mm512_setzero_pd()
+#define VSET1(x)	_mm512_set1_pd(x)
+#define VLOAD(p)	_mm512_loadu_pd(p)
+#define VSTORE(p, v)	_mm512_storeu_pd(p, v)
+#define VMUL(a, b)	_mm512_mul_pd(a, b)
+#define VFMA(a, b, c)	_mm512_fmadd_pd(a, b, c)
+#define VSUM(v)		_mm512_reduce_add_pd(v)
+#else
+#define VLEN		16
+#define VEC		__m512
+#define VZERO()		_mm512_setzero_ps()
+#define VSET1(x)	_mm512_set1_ps(x)
+#define VLOAD(p)	_mm512_loadu_ps(p)
+#define VSTORE(p, v)	_mm512_storeu_ps(p, v)
+#define VMUL(a, b)	_mm512_mul_ps(a, b)
+#define VFMA(a, b, c)	_mm512_fmadd_ps(a, b, c)
+#define VSUM(v)		_mm512_reduce_add_ps(v)
+#endif
+#else
+#ifdef DOUBLE
+#define VLEN		4
+#define VEC		__m256d
+#define VZERO()		_mm256_setzero_pd()
+#define VSET1(x)	_mm256_set1_pd(x)
+#define VLOAD(p)	_mm256_loadu_pd(p)
+#define VSTORE(p, v)	_mm256_storeu_pd(p, v)
+#define VMUL(a, b)	_mm256_mul_pd(a, b)
+#ifdef __FMA__
+#define VFMA(a, b, c)	_mm256_fmadd_pd(a, b, c)
+#else
+#define VFMA(a, b, c)	_mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+#else
+#define VLEN		8
+#define VEC		__m256
+#define VZERO()		_mm256_setzero_ps()
+#define VSET1(x)	_mm256_set1_ps(x)
+#define VLOAD(p)	_mm256_loadu_ps(p)
+#define VSTORE(p, v)	_mm256_storeu_ps(p, v)
+#define VMUL(a, b)	_mm256_mul_ps(a, b)
+#ifdef __FMA__
+#define VFMA(a, b, c)	_mm256_fmadd_ps(a, b, c)
+#else
+#define VFMA(a, b, c)	_mm256_add_ps(_mm256_mul_ps(a, b), c)
+#endif
+#endif
+#endif
+
+#if !defined(__AVX512F__)
+static inline FLOAT vsum(VEC v)
+{
+	FLOAT t[VLEN];
+	FLOAT s = ZERO;
+	int i;
+
+	VSTORE(t, v);
+	for (i = 0; i < VLEN; i++) s += t[i];
+	return s;
+}
+#define VSUM(v)		vsum(v)
+#endif
+
+#ifndef TRANSA
+#define A_ELEM(i, l)	a[(i) + (l) * lda]
+#else
+#define A_ELEM(i, l)	a[(l) + (i) * lda]
+#endif
+
+#ifndef TRANSB
+#define B_ELEM(l, j)	b[(l) + (j) * ldb]
+#else
+#define B_ELEM(l, j)	b[(j) + (l) * ldb]
+#endif
+
+/* Scales a column segment of C in registers and writes it back. */
+#define STORE_C(ptr, v) \
+	if (beta == ZERO) VSTORE(ptr, VMUL(v, valpha)); \
+	else VSTORE(ptr, VFMA(VLOAD(ptr), vbeta, VMUL(v, valpha)))
+
+#define STORE_C_SCALAR(ptr, r) \
+	if (beta == ZERO) *(ptr) = alpha * (r); \
+	else *(ptr) = alpha * (r) + beta * *(ptr)
+
+int CNAME(BLASLONG m, BLASLONG n, BLASLONG k, FLOAT alpha, FLOAT *a, BLASLONG lda,
+	  FLOAT *b, BLASLONG ldb, FLOAT beta, FLOAT *c, BLASLONG ldc)
+{
+	BLASLONG i, j, l;
+	FLOAT r0;
+
+#ifndef TRANSA
+	VEC valpha = VSET1(alpha);
+	VEC vbeta  = VSET1(beta);
+
+	/* A columns are contiguous: vectorize along M, four columns of C at a time */
+	for (j = 0; j + 4 <= n; j += 4) {
+		for (i = 0; i + VLEN <= m; i += VLEN) {
+			VEC c0 = VZERO(), c1 = VZERO(), c2 = VZERO(), c3 = VZERO();
+			for (l = 0; l < k; l++) {
+				VEC va = VLOAD(&A_ELEM(i, l));
+				c0 = VFMA(va, VSET1(B_ELEM(l, j + 0)), c0);
+				c1 = VFMA(va, VSET1(B_ELEM(l, j + 1)), c1);
+				c2 = VFMA(va, VSET1(B_ELEM(l, j + 2)), c2);
+				c3 = VFMA(va, VSET1(B_ELEM(l, j + 3)), c3);
+			}
+			STORE_C(&c[i + (j + 0) * ldc], c0);
+			STORE_C(&c[i + (j + 1) * ldc], c1);
+			STORE_C(&c[i + (j + 2) * ldc], c2);
+			STORE_C(&c[i + (j + 3) * ldc], c3);
+		}
+		for (; i < m; i++) {
+			FLOAT r1 = ZERO, r2 = ZERO, r3 = ZERO;
+			r0 = ZERO;
+			for (l = 0; l < k; l++) {
+				r0 += A_ELEM(i, l) * B_ELEM(l, j + 0);
+				r1 += A_ELEM(i, l) * B_ELEM(l, j + 1);
+				r2 += A_ELEM(i, l) * B_ELEM(l, j + 2);
+				r3 += A_ELEM(i, l) * B_ELEM(l, j + 3);
+			}
+			STORE_C_SCALAR(&c[i + (j + 0) * ldc], r0);
+			STORE_C_SCALAR(&c[i + (j + 1) * ldc], r1);
+			STORE_C_SCALAR(&c[i + (j + 2) * ldc], r2);
+			STORE_C_SCALAR(&c[i + (j + 3) * ldc], r3);
+		}
+	}
+
+	for (; j < n; j++) {
+		for (i = 0; i + VLEN <= m; i += VLEN) {
+			VEC c0 = VZERO();
+			for (l = 0; l < k; l++)
+				c0 = VFMA(VLOAD(&A_ELEM(i, l)), VSET1(B_ELEM(l, j)), c0);
+			STORE_C(&c[i + j * ldc], c0);
+		}
+		for (; i < m; i++) {
+			r0 = ZERO;
+			for (l = 0; l < k; l++)
+				r0 += A_ELEM(i, l) * B_ELEM(l, j);
+			STORE_C_SCALAR(&c[i + j * ldc], r0);
+		}
+	}
+
+#elif !defined(TRANSB)
+
+	/* rows of op(A) and columns of B are contiguous: dot products along K */
+	for (j = 0; j < n; j++) {
+		for (i = 0; i + 2 <= m; i += 2) {
+			VEC s0 = VZERO(), s1 = VZERO();
+			FLOAT r1 = ZERO;
+			for (l = 0; l + VLEN <= k; l += VLEN) {
+				VEC vb = VLOAD(&B_ELEM(l, j));
+				s0 = VFMA(VLOAD(&A_ELEM(i + 0, l)), vb, s0);
+				s1 = VFMA(VLOAD(&A_ELEM(i + 1, l)), vb, s1);
+			}
+			r0 = VSUM(s0);
+			r1 = VSUM(s1);
+			for (; l < k; l++) {
+				r0 += A_ELEM(i + 0, l) * B_ELEM(l, j);
+				r1 += A_ELEM(i + 1, l) * B_ELEM(l, j);
+			}
+			STORE_C_SCALAR(&c[i + 0 + j * ldc], r0);
+			STORE_C_SCALAR(&c[i + 1 + j * ldc], r1);
+		}
+		for (; i < m; i++) {
+			VEC s0 = VZERO();
+			for (l = 0; l + VLEN <= k; l += VLEN)
+				s0 = VFMA(VLOAD(&A_ELEM(i, l)), VLOAD(&B_ELEM(l, j)), s0);
+			r0 = VSUM(s0);
+			for (; l < k; l++)
+				r0 += A_ELEM(i, l) * B_ELEM(l, j);
+			STORE_C_SCALAR(&c[i + j * ldc], r0);
+		}
+	}
+
+#else
+
+	/* rows of op(B) are contiguous: vectorize along N, four rows of C at a time */
+	for (i = 0; i < m; i += 4) {
+		BLASLONG mm = MIN(m - i, 4);
+		BLASLONG q;
+		FLOAT t[4][VLEN];
+
+		for (j = 0; j + VLEN <= n; j += VLEN) {
+			VEC c0 = VZERO(), c1 = VZERO(), c2 = VZERO(), c3 = VZERO();
+
+			for (l = 0; l < k; l++) {
+				VEC vb = VLOAD(&B_ELEM(l, j));
+				c0 = VFMA(VSET1(A_ELEM(i, l)), vb, c0);
+				if (mm > 1) c1 = VFMA(VSET1(A_ELEM(i + 1, l)), vb, c1);
+				if (mm > 2) c2 = VFMA(VSET1(A_ELEM(i + 2, l)), vb, c2);
+				if (mm > 3) c3 = VFMA(VSET1(A_ELEM(i + 3, l)), vb, c3);
+			}
+
+			VSTORE(t[0], c0);
+			VSTORE(t[1], c1);
+			VSTORE(t[2], c2);
+			VSTORE(t[3], c3);
+
+			for (q = 0; q < VLEN; q++) {
+				BLASLONG p;
+				for (p = 0; p < mm; p++) {
+					STORE_C_SCALAR(&c[i + p + (j + q) * ldc], t[p][q]);
+				}
+			}
+		}
+
+		for (; j < n; j++) {
+			BLASLONG p;
+			for (p = 0; p < mm; p++) {
+				r0 = ZERO;
+				for (l = 0; l < k; l++)
+					r0 += A_ELEM(i + p, l) * B_ELEM(l, j);
+				STORE_C_SCALAR(&c[i + p + j * ldc], r0);
+			}
+		}
+	}
+
+#endif
+
+	return(0);
+}
+
+#endif
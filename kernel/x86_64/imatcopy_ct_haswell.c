@@ -0,0 +1,111 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * In-place transpose A := alpha * A' of a square matrix, column major
+ * (CT) or row major (RT, built with ROWM; for a square matrix the two
+ * are the same operation). Pairs of MATCOPY_TR x MATCOPY_TR blocks
+ * mirrored about the diagonal are register transposed and swapped,
+ * MATCOPY_BLOCK square tiles at a time.
+ */
+
+#include "common.h"
+
+#if !defined(__AVX2__)
+#ifdef ROWM
+#include "../generic/imatcopy_rt.c"
+#else
+#include "../generic/imatcopy_ct.c"
+#endif
+#else
+
+#include "matcopy_microk_haswell-2.c"
+
+#define MATCOPY_BLOCK	32
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda)
+{
+	BLASLONG i, j, i0, j0, i1, j1, n, n_tr;
+	FLOAT tmp;
+	MATCOPY_VEC valpha, r[MATCOPY_TR], s[MATCOPY_TR];
+
+	if ( rows <= 0 )  return(0);
+	if ( cols <= 0 )  return(0);
+
+	n = MIN(rows, cols);
+
+	if ( alpha == 0.0 )
+	{
+		for ( j = 0; j < n; j++ )
+			for ( i = 0; i < n; i++ )
+				a[i + j * lda] = 0.0;
+		return(0);
+	}
+
+	valpha = MATCOPY_SET1(alpha);
+	n_tr = n & -MATCOPY_TR;
+
+	for ( j0 = 0; j0 < n_tr; j0 += MATCOPY_BLOCK )
+	{
+		j1 = MIN(j0 + MATCOPY_BLOCK, n_tr);
+		for ( i0 = 0; i0 <= j0; i0 += MATCOPY_BLOCK )
+		{
+			i1 = MIN(i0 + MATCOPY_BLOCK, n_tr);
+			for ( j = j0; j < j1; j += MATCOPY_TR )
+			{
+				for ( i = i0; i < MIN(i1, j); i += MATCOPY_TR )
+				{
+					matcopy_load_t(a + i + j * lda, lda, valpha, r);
+					matcopy_load_t(a + j + i * lda, lda, valpha, s);
+					matcopy_store(a + j + i * lda, lda, r);
+					matcopy_store(a + i + j * lda, lda, s);
+				}
+				if ( i0 == j0 )
+				{
+					matcopy_load_t(a + j + j * lda, lda, valpha, r);
+					matcopy_store(a + j + j * lda, lda, r);
+				}
+			}
+		}
+	}
+
+	for ( j = n_tr; j < n; j++ )
+	{
+		for ( i = 0; i < j; i++ )
+		{
+			tmp = a[i + j * lda];
+			a[i + j * lda] = alpha * a[j + i * lda];
+			a[j + i * lda] = alpha * tmp;
+		}
+		a[j + j * lda] *= alpha;
+	}
+
+	return(0);
+}
+
+#endif
@@ -0,0 +1,133 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * Register transposes for the Haswell matcopy kernels. matcopy_load_t
+ * reads a MATCOPY_TR x MATCOPY_TR block of a column major matrix and
+ * leaves alpha times its transpose in r[], one column per register;
+ * matcopy_store writes r[] back as columns.
+ * 4x4 for double and 8x8 for float, both on AVX2 registers.
+ */
+
+#include <immintrin.h>
+
+#ifdef DOUBLE
+
+#define MATCOPY_TR		4
+#define MATCOPY_VEC		__m256d
+#define MATCOPY_SET1(x)		_mm256_set1_pd(x)
+
+static inline void matcopy_load_t(FLOAT *a, BLASLONG lda, __m256d valpha, __m256d *r)
+{
+	__m256d c0, c1, c2, c3, t0, t1, t2, t3;
+
+	c0 = _mm256_loadu_pd(a);
+	c1 = _mm256_loadu_pd(a + lda);
+	c2 = _mm256_loadu_pd(a + 2 * lda);
+	c3 = _mm256_loadu_pd(a + 3 * lda);
+
+	t0 = _mm256_unpacklo_pd(c0, c1);
+	t1 = _mm256_unpackhi_pd(c0, c1);
+	t2 = _mm256_unpacklo_pd(c2, c3);
+	t3 = _mm256_unpackhi_pd(c2, c3);
+
+	r[0] = _mm256_mul_pd(valpha, _mm256_permute2f128_pd(t0, t2, 0x20));
+	r[1] = _mm256_mul_pd(valpha, _mm256_permute2f128_pd(t1, t3, 0x20));
+	r[2] = _mm256_mul_pd(valpha, _mm256_permute2f128_pd(t0, t2, 0x31));
+	r[3] = _mm256_mul_pd(valpha, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+static inline void matcopy_store(FLOAT *b, BLASLONG ldb, __m256d *r)
+{
+	_mm256_storeu_pd(b, r[0]);
+	_mm256_storeu_pd(b + ldb, r[1]);
+	_mm256_storeu_pd(b + 2 * ldb, r[2]);
+	_mm256_storeu_pd(b + 3 * ldb, r[3]);
+}
+
+#else
+
+#define MATCOPY_TR		8
+#define MATCOPY_VEC		__m256
+#define MATCOPY_SET1(x)		_mm256_set1_ps(x)
+
+static inline void matcopy_load_t(FLOAT *a, BLASLONG lda, __m256 valpha, __m256 *r)
+{
+	__m256 c0, c1, c2, c3, c4, c5, c6, c7;
+	__m256 t0, t1, t2, t3, t4, t5, t6, t7;
+
+	c0 = _mm256_loadu_ps(a);
+	c1 = _mm256_loadu_ps(a + lda);
+	c2 = _mm256_loadu_ps(a + 2 * lda);
+	c3 = _mm256_loadu_ps(a + 3 * lda);
+	c4 = _mm256_loadu_ps(a + 4 * lda);
+	c5 = _mm256_loadu_ps(a + 5 * lda);
+	c6 = _mm256_loadu_ps(a + 6 * lda);
+	c7 = _mm256_loadu_ps(a + 7 * lda);
+
+	t0 = _mm256_unpacklo_ps(c0, c1);
+	t1 = _mm256_unpackhi_ps(c0, c1);
+	t2 = _mm256_unpacklo_ps(c2, c3);
+	t3 = _mm256_unpackhi_ps(c2, c3);
+	t4 = _mm256_unpacklo_ps(c4, c5);
+	t5 = _mm256_unpackhi_ps(c4, c5);
+	t6 = _mm256_unpacklo_ps(c6, c7);
+	t7 = _mm256_unpackhi_ps(c6, c7);
+
+	c0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+	c1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+	c2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+	c3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	c4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+	c5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+	c6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+	c7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+	r[0] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c0, c4, 0x20));
+	r[1] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c1, c5, 0x20));
+	r[2] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c2, c6, 0x20));
+	r[3] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c3, c7, 0x20));
+	r[4] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c0, c4, 0x31));
+	r[5] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c1, c5, 0x31));
+	r[6] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c2, c6, 0x31));
+	r[7] = _mm256_mul_ps(valpha, _mm256_permute2f128_ps(c3, c7, 0x31));
+}
+
+static inline void matcopy_store(FLOAT *b, BLASLONG ldb, __m256 *r)
+{
+	_mm256_storeu_ps(b, r[0]);
+	_mm256_storeu_ps(b + ldb, r[1]);
+	_mm256_storeu_ps(b + 2 * ldb, r[2]);
+	_mm256_storeu_ps(b + 3 * ldb, r[3]);
+	_mm256_storeu_ps(b + 4 * ldb, r[4]);
+	_mm256_storeu_ps(b + 5 * ldb, r[5]);
+	_mm256_storeu_ps(b + 6 * ldb, r[6]);
+	_mm256_storeu_ps(b + 7 * ldb, r[7]);
+}
+
+#endif
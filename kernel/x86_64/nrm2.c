@@ -0,0 +1,351 @@
+/***************************************************************************
+Copyright (c) 2019, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#include "common.h"
+#include <math.h>
+
+/* Single pass ?nrm2 for s/d/c/z (complex vectors are treated as 2n  */
+/* reals).  Single precision squares are summed in double, where     */
+/* they can neither overflow nor underflow.  Double precision uses   */
+/* Blue's algorithm one block at a time: the block maximum picks the */
+/* accumulator (small, medium or big) and its scale, so the inner    */
+/* loops are a plain max and a plain sum of squares that vectorize.  */
+/* Strided vectors are walked in place by scalar loops; in double,   */
+/* a plain sum of squares comes first and the blocks only follow if  */
+/* it overflowed or underflowed.                                     */
+
+#if defined(SKYLAKEX)
+#include "nrm2_microk_skylakex-2.c"
+#endif
+#if defined(SKYLAKEX) || defined(HASWELL) || defined(ZEN)
+#include "nrm2_microk_haswell-2.c"
+#endif
+
+#define NRM2_BLOCK 1024
+
+#ifndef DOUBLE
+
+#ifndef HAVE_NRM2_SUMSQ_S
+static double nrm2_sumsq_s(BLASLONG n, float *x)
+{
+	BLASLONG i;
+	double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+	for (i = 0; i < (n & -4); i += 4) {
+		s0 += (double)x[i    ] * (double)x[i    ];
+		s1 += (double)x[i + 1] * (double)x[i + 1];
+		s2 += (double)x[i + 2] * (double)x[i + 2];
+		s3 += (double)x[i + 3] * (double)x[i + 3];
+	}
+	for (; i < n; i++) s0 += (double)x[i] * (double)x[i];
+
+	return (s0 + s1) + (s2 + s3);
+}
+#endif
+
+#else
+
+/* Blue's thresholds and scales for IEEE double (as in LAPACK 3.10) */
+#define TSML 1.4916681462400413e-154	/* 2^-511 */
+#define TBIG 1.9979190722022350e+146	/* 2^486  */
+#define SSML 4.4989137945431964e+161	/* 2^537  */
+#define SBIG 1.1113793747425387e-162	/* 2^-538 */
+
+/* a plain sum of squares above this has no underflow worth keeping */
+#define NRM2_SAFE_MIN 2.4099198651028841e-181	/* 2^-600 */
+
+#ifndef HAVE_NRM2_AMAX_D
+static double nrm2_amax_d(BLASLONG n, double *x)
+{
+	BLASLONG i;
+	double m0 = 0.0, m1 = 0.0, a;
+
+	for (i = 0; i < (n & -2); i += 2) {
+		a = fabs(x[i    ]); m0 = (a > m0) ? a : m0;
+		a = fabs(x[i + 1]); m1 = (a > m1) ? a : m1;
+	}
+	for (; i < n; i++) {
+		a = fabs(x[i]); m0 = (a > m0) ? a : m0;
+	}
+
+	return (m0 > m1) ? m0 : m1;
+}
+#endif
+
+#ifndef HAVE_NRM2_SUMSQ_D
+static double nrm2_sumsq_d(BLASLONG n, double *x, double scale)
+{
+	BLASLONG i;
+	double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+	for (i = 0; i < (n & -4); i += 4) {
+		s0 += (x[i    ] * scale) * (x[i    ] * scale);
+		s1 += (x[i + 1] * scale) * (x[i + 1] * scale);
+		s2 += (x[i + 2] * scale) * (x[i + 2] * scale);
+		s3 += (x[i + 3] * scale) * (x[i + 3] * scale);
+	}
+	for (; i < n; i++) s0 += (x[i] * scale) * (x[i] * scale);
+
+	return (s0 + s1) + (s2 + s3);
+}
+#endif
+
+#endif
+
+/* strided input is walked in place: gathering it into a buffer first */
+/* costs more than the scalar loops save                              */
+static double nrm2_sumsq_strided(BLASLONG n, FLOAT *x, BLASLONG inc_x, double scale)
+{
+	BLASLONG i;
+	double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0, a0, a1, a2, a3;
+
+#ifndef COMPLEX
+	for (i = 0; i < (n & -4); i += 4) {
+		a0 = (double)x[0        ] * scale;
+		a1 = (double)x[inc_x    ] * scale;
+		a2 = (double)x[inc_x * 2] * scale;
+		a3 = (double)x[inc_x * 3] * scale;
+		s0 += a0 * a0; s1 += a1 * a1;
+		s2 += a2 * a2; s3 += a3 * a3;
+		x += inc_x * 4;
+	}
+	for (; i < n; i++) {
+		a0 = (double)x[0] * scale; s0 += a0 * a0;
+		x += inc_x;
+	}
+#else
+	inc_x *= 2;
+
+	for (i = 0; i < (n & -2); i += 2) {
+		a0 = (double)x[0        ] * scale;
+		a1 = (double)x[1        ] * scale;
+		a2 = (double)x[inc_x    ] * scale;
+		a3 = (double)x[inc_x + 1] * scale;
+		s0 += a0 * a0; s1 += a1 * a1;
+		s2 += a2 * a2; s3 += a3 * a3;
+		x += inc_x * 2;
+	}
+	if (n & 1) {
+		a0 = (double)x[0] * scale; s0 += a0 * a0;
+		a1 = (double)x[1] * scale; s1 += a1 * a1;
+	}
+#endif
+
+	return (s0 + s1) + (s2 + s3);
+}
+
+#ifdef DOUBLE
+#define NRM2_MAX(m, v) { double a = fabs(v); m = (a > m) ? a : m; }
+
+static double nrm2_amax_strided(BLASLONG n, double *x, BLASLONG inc_x)
+{
+	BLASLONG i;
+	double m0 = 0.0, m1 = 0.0, m2 = 0.0, m3 = 0.0;
+
+#ifndef COMPLEX
+	for (i = 0; i < (n & -4); i += 4) {
+		NRM2_MAX(m0, x[0        ]);
+		NRM2_MAX(m1, x[inc_x    ]);
+		NRM2_MAX(m2, x[inc_x * 2]);
+		NRM2_MAX(m3, x[inc_x * 3]);
+		x += inc_x * 4;
+	}
+	for (; i < n; i++) {
+		NRM2_MAX(m0, x[0]);
+		x += inc_x;
+	}
+#else
+	inc_x *= 2;
+
+	for (i = 0; i < (n & -2); i += 2) {
+		NRM2_MAX(m0, x[0        ]);
+		NRM2_MAX(m1, x[1        ]);
+		NRM2_MAX(m2, x[inc_x    ]);
+		NRM2_MAX(m3, x[inc_x + 1]);
+		x += inc_x * 2;
+	}
+	if (n & 1) {
+		NRM2_MAX(m0, x[0]);
+		NRM2_MAX(m1, x[1]);
+	}
+#endif
+
+	m0 = (m1 > m0) ? m1 : m0;
+	m2 = (m3 > m2) ? m3 : m2;
+	return (m2 > m0) ? m2 : m0;
+}
+#endif
+
+static FLOAT nrm2_compute(BLASLONG n, FLOAT *x, BLASLONG inc_x)
+{
+#ifndef DOUBLE
+	if (inc_x == 1)
+		return (FLOAT)sqrt(nrm2_sumsq_s(n * COMPSIZE, x));
+	else
+		return (FLOAT)sqrt(nrm2_sumsq_strided(n, x, inc_x, 1.0));
+#else
+	FLOAT *p;
+	BLASLONG i, step;
+	double asml = 0.0, amed = 0.0, abig = 0.0, m, scale, sumsq, scl, ymin, ymax;
+
+	/* strided data gets one unscaled pass first: a finite sum that is */
+	/* not tiny cannot have overflowed or lost anything to underflow  */
+	if (inc_x != 1) {
+		sumsq = nrm2_sumsq_strided(n, x, inc_x, 1.0);
+		if (sumsq < HUGE_VAL && sumsq > NRM2_SAFE_MIN) return sqrt(sumsq);
+	}
+
+	for (i = 0; i < n; i += step) {
+		step = n - i;
+		if (step > NRM2_BLOCK / COMPSIZE) step = NRM2_BLOCK / COMPSIZE;
+		p = x + i * inc_x * COMPSIZE;
+
+		if (inc_x == 1)
+			m = nrm2_amax_d(step * COMPSIZE, p);
+		else
+			m = nrm2_amax_strided(step, p, inc_x);
+
+		/* the maximum may skip NaNs; the sums never do, and a block */
+		/* whose maximum is 0 can only hold zeros and NaNs           */
+		if (m > TBIG)
+			scale = SBIG;
+		else if (m < TSML && m > 0.0)
+			scale = SSML;
+		else
+			scale = 1.0;
+
+		if (inc_x == 1)
+			sumsq = nrm2_sumsq_d(step * COMPSIZE, p, scale);
+		else
+			sumsq = nrm2_sumsq_strided(step, p, inc_x, scale);
+
+		if (scale == SBIG)
+			abig += sumsq;
+		else if (scale == SSML)
+			asml += sumsq;
+		else
+			amed += sumsq;
+	}
+
+	/* a NaN can sit in any accumulator: test for nonzero, not > 0 */
+	if (abig != 0.0) {
+		if (amed != 0.0) abig += (amed * SBIG) * SBIG;
+		scl   = 1.0 / SBIG;
+		sumsq = abig;
+	} else if (asml != 0.0) {
+		if (amed != 0.0) {
+			amed = sqrt(amed);
+			asml = sqrt(asml) / SSML;
+			if (asml > amed) { ymin = amed; ymax = asml; }
+			else             { ymin = asml; ymax = amed; }
+			scl   = 1.0;
+			sumsq = ymax * ymax * (1.0 + (ymin / ymax) * (ymin / ymax));
+		} else {
+			scl   = 1.0 / SSML;
+			sumsq = asml;
+		}
+	} else {
+		scl   = 1.0;
+		sumsq = amed;
+	}
+
+	return scl * sqrt(sumsq);
+#endif
+}
+
+#if defined(SMP)
+#ifndef COMPLEX
+static int nrm2_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2,
+				FLOAT *x, BLASLONG inc_x, FLOAT *dummy3, BLASLONG dummy4,
+				FLOAT *result, BLASLONG dummy5)
+#else
+static int nrm2_thread_function(BLASLONG n, BLASLONG dummy0, BLASLONG dummy1, FLOAT dummy2, FLOAT dummy2i,
+				FLOAT *x, BLASLONG inc_x, FLOAT *dummy3, BLASLONG dummy4,
+				FLOAT *result, BLASLONG dummy5)
+#endif
+{
+	*(double *)result = (double)nrm2_compute(n, x, inc_x);
+
+	return 0;
+}
+
+extern int blas_level1_thread_with_return_value(int mode, BLASLONG m, BLASLONG n,
+	BLASLONG k, void *alpha, void *a, BLASLONG lda, void *b, BLASLONG ldb,
+	void *c, BLASLONG ldc, int (*function)(), int nthreads);
+#endif
+
+FLOAT CNAME(BLASLONG n, FLOAT *x, BLASLONG inc_x)
+{
+#if defined(SMP)
+	int nthreads;
+	FLOAT dummy_alpha[2];
+#endif
+
+	if (n <= 0 || inc_x <= 0) return 0.0;
+
+#if defined(SMP)
+	if (n <= 10000 || openblas_reproducible())
+		nthreads = 1;
+	else
+		nthreads = num_cpu_avail(1);
+
+	if (nthreads > 1) {
+		int mode, i;
+		double result[MAX_CPU_NUMBER * 2], scale = 0.0, ssq = 0.0;
+
+#ifndef DOUBLE
+		mode = BLAS_SINGLE;
+#else
+		mode = BLAS_DOUBLE;
+#endif
+#ifndef COMPLEX
+		mode |= BLAS_REAL;
+#else
+		mode |= BLAS_COMPLEX;
+#endif
+
+		for (i = 0; i < nthreads * 2; i++) result[i] = 0.0;
+
+		blas_level1_thread_with_return_value(mode, n, 0, 0, dummy_alpha,
+				   x, inc_x, NULL, 0, result, 0,
+				   (void *)nrm2_thread_function, nthreads);
+
+		/* combine the partial norms, scaled by the largest */
+		for (i = 0; i < nthreads; i++)
+			if (!(result[i * 2] <= scale)) scale = result[i * 2];
+
+		if (scale == 0.0 || isinf(scale) || isnan(scale)) return (FLOAT)scale;
+
+		for (i = 0; i < nthreads; i++)
+			ssq += (result[i * 2] / scale) * (result[i * 2] / scale);
+
+		return (FLOAT)(scale * sqrt(ssq));
+	}
+#endif
+
+	return nrm2_compute(n, x, inc_x);
+}
@@ -0,0 +1,131 @@
+/***************************************************************************
+Copyright (c) 2019, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+/* fills in whatever the AVX-512 kernels did not provide */
+
+#ifndef DOUBLE
+
+#ifndef HAVE_NRM2_SUMSQ_S
+#define HAVE_NRM2_SUMSQ_S 1
+
+static double nrm2_sumsq_s(BLASLONG n, float *x)
+{
+	BLASLONG i = 0;
+	double sum[4];
+	__m256d a0, a1, a2, a3;
+	__m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+	__m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+
+	for (; i < (n & -16); i += 16) {
+		a0 = _mm256_cvtps_pd(_mm_loadu_ps(&x[i     ]));
+		a1 = _mm256_cvtps_pd(_mm_loadu_ps(&x[i +  4]));
+		a2 = _mm256_cvtps_pd(_mm_loadu_ps(&x[i +  8]));
+		a3 = _mm256_cvtps_pd(_mm_loadu_ps(&x[i + 12]));
+		s0 = _mm256_add_pd(s0, _mm256_mul_pd(a0, a0));
+		s1 = _mm256_add_pd(s1, _mm256_mul_pd(a1, a1));
+		s2 = _mm256_add_pd(s2, _mm256_mul_pd(a2, a2));
+		s3 = _mm256_add_pd(s3, _mm256_mul_pd(a3, a3));
+	}
+
+	_mm256_storeu_pd(sum, _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+
+	for (; i < n; i++) sum[0] += (double)x[i] * (double)x[i];
+
+	return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+#endif
+
+#else
+
+#ifndef HAVE_NRM2_AMAX_D
+#define HAVE_NRM2_AMAX_D 1
+
+static double nrm2_amax_d(BLASLONG n, double *x)
+{
+	BLASLONG i = 0;
+	double m[4], a;
+	__m256d sign = _mm256_set1_pd(-0.0);
+	__m256d m0 = _mm256_setzero_pd(), m1 = _mm256_setzero_pd();
+	__m256d m2 = _mm256_setzero_pd(), m3 = _mm256_setzero_pd();
+
+	for (; i < (n & -16); i += 16) {
+		m0 = _mm256_max_pd(m0, _mm256_andnot_pd(sign, _mm256_loadu_pd(&x[i     ])));
+		m1 = _mm256_max_pd(m1, _mm256_andnot_pd(sign, _mm256_loadu_pd(&x[i +  4])));
+		m2 = _mm256_max_pd(m2, _mm256_andnot_pd(sign, _mm256_loadu_pd(&x[i +  8])));
+		m3 = _mm256_max_pd(m3, _mm256_andnot_pd(sign, _mm256_loadu_pd(&x[i + 12])));
+	}
+
+	_mm256_storeu_pd(m, _mm256_max_pd(_mm256_max_pd(m0, m1), _mm256_max_pd(m2, m3)));
+
+	for (; i < n; i++) {
+		a = fabs(x[i]);
+		if (a > m[0]) m[0] = a;
+	}
+
+	if (m[1] > m[0]) m[0] = m[1];
+	if (m[3] > m[2]) m[2] = m[3];
+	return (m[2] > m[0]) ? m[2] : m[0];
+}
+#endif
+
+#ifndef HAVE_NRM2_SUMSQ_D
+#define HAVE_NRM2_SUMSQ_D 1
+
+static double nrm2_sumsq_d(BLASLONG n, double *x, double scale)
+{
+	BLASLONG i = 0;
+	double sum[4];
+	__m256d a0, a1, a2, a3, vs = _mm256_set1_pd(scale);
+	__m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+	__m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+
+	for (; i < (n & -16); i += 16) {
+		a0 = _mm256_mul_pd(vs, _mm256_loadu_pd(&x[i     ]));
+		a1 = _mm256_mul_pd(vs, _mm256_loadu_pd(&x[i +  4]));
+		a2 = _mm256_mul_pd(vs, _mm256_loadu_pd(&x[i +  8]));
+		a3 = _mm256_mul_pd(vs, _mm256_loadu_pd(&x[i + 12]));
+		s0 = _mm256_add_pd(s0, _mm256_mul_pd(a0, a0));
+		s1 = _mm256_add_pd(s1, _mm256_mul_pd(a1, a1));
+		s2 = _mm256_add_pd(s2, _mm256_mul_pd(a2, a2));
+		s3 = _mm256_add_pd(s3, _mm256_mul_pd(a3, a3));
+	}
+
+	_mm256_storeu_pd(sum, _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+
+	for (; i < n; i++) sum[0] += (x[i] * scale) * (x[i] * scale);
+
+	return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+#endif
+
+#endif
+
+#endif
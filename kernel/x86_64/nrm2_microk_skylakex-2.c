@@ -0,0 +1,120 @@
+/***************************************************************************
+Copyright (c) 2019, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+/* need a new enough GCC for avx512 support */
+#if (( defined(__GNUC__)  && __GNUC__   > 6 && defined(__AVX512F__)) || (defined(__clang__) && __clang_major__ >= 6 && defined(__AVX512F__)))
+
+#include <immintrin.h>
+
+#ifndef DOUBLE
+
+#define HAVE_NRM2_SUMSQ_S 1
+
+static double nrm2_sumsq_s(BLASLONG n, float *x)
+{
+	BLASLONG i = 0;
+	double sum;
+	__m512d a0, a1, a2, a3;
+	__m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+	__m512d s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+
+	for (; i < (n & -32); i += 32) {
+		a0 = _mm512_cvtps_pd(_mm256_loadu_ps(&x[i     ]));
+		a1 = _mm512_cvtps_pd(_mm256_loadu_ps(&x[i +  8]));
+		a2 = _mm512_cvtps_pd(_mm256_loadu_ps(&x[i + 16]));
+		a3 = _mm512_cvtps_pd(_mm256_loadu_ps(&x[i + 24]));
+		s0 = _mm512_fmadd_pd(a0, a0, s0);
+		s1 = _mm512_fmadd_pd(a1, a1, s1);
+		s2 = _mm512_fmadd_pd(a2, a2, s2);
+		s3 = _mm512_fmadd_pd(a3, a3, s3);
+	}
+
+	sum = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+
+	for (; i < n; i++) sum += (double)x[i] * (double)x[i];
+
+	return sum;
+}
+
+#else
+
+#define HAVE_NRM2_AMAX_D 1
+#define HAVE_NRM2_SUMSQ_D 1
+
+static double nrm2_amax_d(BLASLONG n, double *x)
+{
+	BLASLONG i = 0;
+	double m, a;
+	__m512d m0 = _mm512_setzero_pd(), m1 = _mm512_setzero_pd();
+	__m512d m2 = _mm512_setzero_pd(), m3 = _mm512_setzero_pd();
+
+	for (; i < (n & -32); i += 32) {
+		m0 = _mm512_max_pd(m0, _mm512_abs_pd(_mm512_loadu_pd(&x[i     ])));
+		m1 = _mm512_max_pd(m1, _mm512_abs_pd(_mm512_loadu_pd(&x[i +  8])));
+		m2 = _mm512_max_pd(m2, _mm512_abs_pd(_mm512_loadu_pd(&x[i + 16])));
+		m3 = _mm512_max_pd(m3, _mm512_abs_pd(_mm512_loadu_pd(&x[i + 24])));
+	}
+
+	m = _mm512_reduce_max_pd(_mm512_max_pd(_mm512_max_pd(m0, m1), _mm512_max_pd(m2, m3)));
+
+	for (; i < n; i++) {
+		a = fabs(x[i]);
+		if (a > m) m = a;
+	}
+
+	return m;
+}
+
+static double nrm2_sumsq_d(BLASLONG n, double *x, double scale)
+{
+	BLASLONG i = 0;
+	double sum;
+	__m512d a0, a1, a2, a3, vs = _mm512_set1_pd(scale);
+	__m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+	__m512d s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+
+	for (; i < (n & -32); i += 32) {
+		a0 = _mm512_mul_pd(vs, _mm512_loadu_pd(&x[i     ]));
+		a1 = _mm512_mul_pd(vs, _mm512_loadu_pd(&x[i +  8]));
+		a2 = _mm512_mul_pd(vs, _mm512_loadu_pd(&x[i + 16]));
+		a3 = _mm512_mul_pd(vs, _mm512_loadu_pd(&x[i + 24]));
+		s0 = _mm512_fmadd_pd(a0, a0, s0);
+		s1 = _mm512_fmadd_pd(a1, a1, s1);
+		s2 = _mm512_fmadd_pd(a2, a2, s2);
+		s3 = _mm512_fmadd_pd(a3, a3, s3);
+	}
+
+	sum = _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+
+	for (; i < n; i++) sum += (x[i] * scale) * (x[i] * scale);
+
+	return sum;
+}
+
+#endif
+
+#endif
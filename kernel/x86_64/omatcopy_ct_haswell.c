@@ -0,0 +1,109 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * Out-of-place transpose B := alpha * A' for a column major A (CT) and,
+ * built with ROWM, a row major A (RT, which is CT with rows and cols
+ * swapped). A is walked in strips of MATCOPY_ROWS rows, one cache line
+ * of each column, and MATCOPY_COLS columns, so that every line of A is
+ * read once and B is written in runs of MATCOPY_COLS elements; each
+ * strip is moved as register transposed MATCOPY_TR x MATCOPY_TR blocks.
+ */
+
+#include "common.h"
+
+#if !defined(__AVX2__)
+#ifdef ROWM
+#include "../arm/omatcopy_rt.c"
+#else
+#include "../arm/omatcopy_ct.c"
+#endif
+#else
+
+#include "matcopy_microk_haswell-2.c"
+
+#define MATCOPY_ROWS	(64 / (BLASLONG) sizeof(FLOAT))
+#define MATCOPY_COLS	128
+
+static void omatcopy_tile(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, k;
+	BLASLONG rows_tr = rows & -MATCOPY_TR;
+	BLASLONG cols_tr = cols & -MATCOPY_TR;
+	MATCOPY_VEC valpha = MATCOPY_SET1(alpha);
+	MATCOPY_VEC r[MATCOPY_TR];
+
+	for (j = 0; j < cols_tr; j += MATCOPY_TR)
+	{
+		for (i = 0; i < rows_tr; i += MATCOPY_TR)
+		{
+			matcopy_load_t(a + i + j * lda, lda, valpha, r);
+			matcopy_store(b + j + i * ldb, ldb, r);
+		}
+		for (; i < rows; i++)
+			for (k = 0; k < MATCOPY_TR; k++)
+				b[j + k + i * ldb] = alpha * a[i + (j + k) * lda];
+	}
+
+	for (; j < cols; j++)
+		for (i = 0; i < rows; i++)
+			b[j + i * ldb] = alpha * a[i + j * lda];
+}
+
+int CNAME(BLASLONG rows, BLASLONG cols, FLOAT alpha, FLOAT *a, BLASLONG lda, FLOAT *b, BLASLONG ldb)
+{
+	BLASLONG i, j, m, n;
+
+#ifdef ROWM
+	m = cols;
+	n = rows;
+#else
+	m = rows;
+	n = cols;
+#endif
+
+	if ( m <= 0 )  return(0);
+	if ( n <= 0 )  return(0);
+
+	if ( alpha == 0.0 )
+	{
+		for ( i = 0; i < m; i++ )
+			for ( j = 0; j < n; j++ )
+				b[j + i * ldb] = 0.0;
+		return(0);
+	}
+
+	for ( i = 0; i < m; i += MATCOPY_ROWS )
+		for ( j = 0; j < n; j += MATCOPY_COLS )
+			omatcopy_tile(MIN(m - i, MATCOPY_ROWS), MIN(n - j, MATCOPY_COLS), alpha,
+				      a + i + j * lda, lda, b + j + i * ldb, ldb);
+
+	return(0);
+}
+
+#endif
@@ -0,0 +1,118 @@
+/***************************************************************************
+Copyright (c) 2013, The OpenBLAS Project
+All rights reserved.
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+1. Redistributions of source code must retain the above copyright
+notice, this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright
+notice, this list of conditions and the following disclaimer in
+the documentation and/or other materials provided with the
+distribution.
+3. Neither the name of the OpenBLAS project nor the names of
+its contributors may be used to endorse or promote products
+derived from this software without specific prior written permission.
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*****************************************************************************/
+
+
+/*
+ * Non-temporal store loops for the copy, scal and axpby kernels,
+ * used when BLAS_STREAM() says the output is larger than the
+ * last level cache. y is stored with movntp[sd] once aligned to 16
+ * bytes, and an sfence orders the streaming stores before the return.
+ */
+
+#include <emmintrin.h>
+
+#ifdef DOUBLE
+#define STREAM_VLEN		2
+#define STREAM_VEC		__m128d
+#define STREAM_LOADU(p)		_mm_loadu_pd(p)
+#define STREAM_STORE(p, v)	_mm_stream_pd(p, v)
+#define STREAM_SET1(x)		_mm_set1_pd(x)
+#define STREAM_ZERO()		_mm_setzero_pd()
+#define STREAM_MUL(a, b)	_mm_mul_pd(a, b)
+#else
+#define STREAM_VLEN		4
+#define STREAM_VEC		__m128
+#define STREAM_LOADU(p)		_mm_loadu_ps(p)
+#define STREAM_STORE(p, v)	_mm_stream_ps(p, v)
+#define STREAM_SET1(x)		_mm_set1_ps(x)
+#define STREAM_ZERO()		_mm_setzero_ps()
+#define STREAM_MUL(a, b)	_mm_mul_ps(a, b)
+#endif
+
+/* Elements to store one by one until y is 16 byte aligned */
+#define STREAM_HEAD(n, y)	MIN((n), (BLASLONG)((16 - ((BLASULONG)(y) & 15)) & 15) / (BLASLONG)sizeof(FLOAT))
+
+static inline void stream_copy(BLASLONG n, FLOAT *x, FLOAT *y)
+{
+	BLASLONG i, head = STREAM_HEAD(n, y);
+
+	for (i = 0; i < head; i++) y[i] = x[i];
+
+	for (; i + 4 * STREAM_VLEN <= n; i += 4 * STREAM_VLEN) {
+		STREAM_STORE(y + i, STREAM_LOADU(x + i));
+		STREAM_STORE(y + i + STREAM_VLEN, STREAM_LOADU(x + i + STREAM_VLEN));
+		STREAM_STORE(y + i + 2 * STREAM_VLEN, STREAM_LOADU(x + i + 2 * STREAM_VLEN));
+		STREAM_STORE(y + i + 3 * STREAM_VLEN, STREAM_LOADU(x + i + 3 * STREAM_VLEN));
+	}
+
+	for (; i < n; i++) y[i] = x[i];
+
+	_mm_sfence();
+}
+
+static inline void stream_scal(BLASLONG n, FLOAT alpha, FLOAT *x, FLOAT *y)
+{
+	BLASLONG i, head = STREAM_HEAD(n, y);
+	STREAM_VEC va = STREAM_SET1(alpha);
+
+	for (i = 0; i < head; i++) y[i] = alpha * x[i];
+
+	for (; i + 4 * STREAM_VLEN <= n; i += 4 * STREAM_VLEN) {
+		STREAM_STORE(y + i, STREAM_MUL(va, STREAM_LOADU(x + i)));
+		STREAM_STORE(y + i + STREAM_VLEN, STREAM_MUL(va, STREAM_LOADU(x + i + STREAM_VLEN)));
+		STREAM_STORE(y + i + 2 * STREAM_VLEN, STREAM_MUL(va, STREAM_LOADU(x + i + 2 * STREAM_VLEN)));
+		STREAM_STORE(y + i + 3 * STREAM_VLEN, STREAM_MUL(va, STREAM_LOADU(x + i + 3 * STREAM_VLEN)));
+	}
+
+	for (; i < n; i++) y[i] = alpha * x[i];
+
+	_mm_sfence();
+}
+
+/* Zeros m elements of each of n columns */
+static inline void stream_zero(BLASLONG m, BLASLONG n, FLOAT *c, BLASLONG ldc)
+{
+	BLASLONG i, j, head;
+	STREAM_VEC vz = STREAM_ZERO();
+
+	for (j = 0; j < n; j++, c += ldc) {
+		head = STREAM_HEAD(m, c);
+
+		for (i = 0; i < head; i++) c[i] = 0.0;
+
+		for (; i + 4 * STREAM_VLEN <= m; i += 4 * STREAM_VLEN) {
+			STREAM_STORE(c + i, vz);
+			STREAM_STORE(c + i + STREAM_VLEN, vz);
+			STREAM_STORE(c + i + 2 * STREAM_VLEN, vz);
+			STREAM_STORE(c + i + 3 * STREAM_VLEN, vz);
+		}
+
+		for (; i < m; i++) c[i] = 0.0;
+	}
+
+	_mm_sfence();
+}
@@ -0,0 +1,61 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#ifndef COMPACT_H
+#define COMPACT_H
+
+/* Lane loops shared by the compact batch kernels.  The operands of  */
+/* one call never overlap, and saying so lets the compiler turn each */
+/* loop into a few vector instructions without an alias check.       */
+
+#define LANES	BATCH_LANES
+
+/* y -= x * t */
+static inline void lanes_update(FLOAT * __restrict y, FLOAT * __restrict x, FLOAT * __restrict t){
+  BLASLONG l;
+  for (l = 0; l < LANES; l++) y[l] -= x[l] * t[l];
+}
+
+/* y *= r */
+static inline void lanes_scale(FLOAT * __restrict y, FLOAT * __restrict r){
+  BLASLONG l;
+  for (l = 0; l < LANES; l++) y[l] *= r[l];
+}
+
+/* y /= d */
+static inline void lanes_div(FLOAT * __restrict y, FLOAT * __restrict d){
+  BLASLONG l;
+  for (l = 0; l < LANES; l++) y[l] /= d[l];
+}
+
+#endif
@@ -0,0 +1,143 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+#include "compact.h"
+
+/* LU with partial pivoting of up to BATCH_LANES matrices at once.   */
+/* The matrices are copied into sa interleaved, element (i, j) of    */
+/* every matrix side by side, so each step of the elimination is one */
+/* vector operation across the batch.  args -> a, c and d hold the   */
+/* matrix, ipiv and info pointers and args -> k the number in use;   */
+/* the spare lanes factor an identity.                               */
+
+#define W(i, j)	(w + ((i) + (j) * m) * LANES)
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, count, mn;
+  BLASLONG i, j, k, l;
+  FLOAT **a, *w, *wj, *wi, *ap[LANES];
+  blasint **ipiv, **info;
+  FLOAT amax[LANES], rcp[LANES], temp;
+  BLASLONG piv[LANES];
+  blasint stat[LANES];
+
+  m      = args -> m;
+  n      = args -> n;
+  lda    = args -> lda;
+  a      = (FLOAT **)args -> a;
+  ipiv   = (blasint **)args -> c;
+  info   = (blasint **)args -> d;
+  count  = args -> k;
+  mn     = MIN(m, n);
+
+  w = sa;
+
+  for (l = 0; l < count; l++) ap[l] = a[l];
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < m; i++) {
+      wi = W(i, j);
+      for (l = 0; l < count; l++) wi[l] = ap[l][i + j * lda];
+    }
+  }
+
+  for (l = count; l < LANES; l++) {
+    for (j = 0; j < n; j++) {
+      for (i = 0; i < m; i++) W(i, j)[l] = (i == j) ? ONE : ZERO;
+    }
+  }
+
+  for (l = 0; l < LANES; l++) stat[l] = 0;
+
+  for (j = 0; j < mn; j++) {
+
+    wj = W(j, j);
+
+    for (l = 0; l < LANES; l++) {
+      amax[l] = fabs(wj[l]);
+      piv[l]  = j;
+    }
+
+    for (i = j + 1; i < m; i++) {
+      wi = W(i, j);
+      for (l = 0; l < LANES; l++) {
+	temp    = fabs(wi[l]);
+	piv[l]  = (temp > amax[l]) ? i    : piv[l];
+	amax[l] = (temp > amax[l]) ? temp : amax[l];
+      }
+    }
+
+    /* interchanges differ per matrix, so they go lane by lane */
+    for (l = 0; l < count; l++) {
+      ipiv[l][j] = piv[l] + 1;
+      if (piv[l] != j) {
+	for (k = 0; k < n; k++) {
+	  temp            = W(j,      k)[l];
+	  W(j,      k)[l] = W(piv[l], k)[l];
+	  W(piv[l], k)[l] = temp;
+	}
+      }
+    }
+
+    /* a zero pivot leaves its column, which is zero already, alone */
+    for (l = 0; l < LANES; l++) {
+      if ((wj[l] == ZERO) && !stat[l]) stat[l] = j + 1;
+    }
+
+    for (l = 0; l < LANES; l++) {
+      rcp[l] = ONE / ((wj[l] == ZERO) ? ONE : wj[l]);
+      rcp[l] = (wj[l] == ZERO) ? ZERO : rcp[l];
+    }
+
+    for (i = j + 1; i < m; i++) lanes_scale(W(i, j), rcp);
+
+    for (k = j + 1; k < n; k++) {
+      for (i = j + 1; i < m; i++) lanes_update(W(i, k), W(i, j), W(j, k));
+    }
+  }
+
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < m; i++) {
+      wi = W(i, j);
+      for (l = 0; l < count; l++) ap[l][i + j * lda] = wi[l];
+    }
+  }
+
+  for (l = 0; l < count; l++) *info[l] = stat[l];
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+#include "compact.h"
+
+#ifndef SQRT
+#define SQRT(x)	sqrt(x)
+#endif
+
+/* Cholesky of up to BATCH_LANES matrices at once, interleaved in sa */
+/* as in getrf_compact.  Only the referenced triangle is copied.  A  */
+/* matrix that turns out not to be positive definite carries on with */
+/* a unit pivot so the others are not disturbed, and is factored     */
+/* again on its own to leave A as potrf would.                       */
+
+#define W(i, j)	(w + ((i) + (j) * n) * LANES)
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda, count;
+  BLASLONG i, j, k, l;
+  FLOAT **a, *w, *wj;
+  blasint **info;
+  FLOAT rcp[LANES];
+  blasint stat[LANES];
+  blas_arg_t newarg;
+
+  n      = args -> n;
+  lda    = args -> lda;
+  a      = (FLOAT **)args -> a;
+  info   = (blasint **)args -> d;
+  count  = args -> k;
+
+  w = sa;
+
+  for (l = 0; l < count; l++) {
+    for (j = 0; j < n; j++) {
+#ifdef UPPER
+      for (i = 0; i <= j; i++) W(i, j)[l] = a[l][i + j * lda];
+#else
+      for (i = j; i < n; i++)  W(i, j)[l] = a[l][i + j * lda];
+#endif
+    }
+  }
+
+  for (l = count; l < LANES; l++) {
+    for (j = 0; j < n; j++) {
+#ifdef UPPER
+      for (i = 0; i <= j; i++) W(i, j)[l] = (i == j) ? ONE : ZERO;
+#else
+      for (i = j; i < n; i++)  W(i, j)[l] = (i == j) ? ONE : ZERO;
+#endif
+    }
+  }
+
+  for (l = 0; l < LANES; l++) stat[l] = 0;
+
+  for (j = 0; j < n; j++) {
+
+    wj = W(j, j);
+
+    for (l = 0; l < LANES; l++) {
+      if (wj[l] <= ZERO) {
+	if (!stat[l]) stat[l] = j + 1;
+	wj[l] = ONE;
+      }
+      wj[l]  = SQRT(wj[l]);
+      rcp[l] = ONE / wj[l];
+    }
+
+#ifdef UPPER
+    /* row j of U, then the trailing upper triangle */
+    for (k = j + 1; k < n; k++) lanes_scale(W(j, k), rcp);
+
+    for (k = j + 1; k < n; k++) {
+      for (i = j + 1; i <= k; i++) lanes_update(W(i, k), W(j, i), W(j, k));
+    }
+#else
+    /* column j of L, then the trailing lower triangle */
+    for (i = j + 1; i < n; i++) lanes_scale(W(i, j), rcp);
+
+    for (k = j + 1; k < n; k++) {
+      for (i = k; i < n; i++) lanes_update(W(i, k), W(i, j), W(k, j));
+    }
+#endif
+  }
+
+  for (l = 0; l < count; l++) {
+
+    if (stat[l]) {
+      newarg.n   = n;
+      newarg.a   = (void *)a[l];
+      newarg.lda = lda;
+#ifdef UPPER
+      *info[l] = POTRF_U_SMALL(&newarg, NULL, NULL, NULL, NULL, 0);
+#else
+      *info[l] = POTRF_L_SMALL(&newarg, NULL, NULL, NULL, NULL, 0);
+#endif
+      continue;
+    }
+
+    for (j = 0; j < n; j++) {
+#ifdef UPPER
+      for (i = 0; i <= j; i++) a[l][i + j * lda] = W(i, j)[l];
+#else
+      for (i = j; i < n; i++)  a[l][i + j * lda] = W(i, j)[l];
+#endif
+    }
+    *info[l] = 0;
+  }
+
+  return 0;
+}
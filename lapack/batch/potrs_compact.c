@@ -0,0 +1,123 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+#include "compact.h"
+
+/* Solves with the Cholesky factors of up to BATCH_LANES matrices at */
+/* once, interleaved as in getrf_compact : the factor goes to sa and */
+/* the right hand sides to sb.  args -> a and b hold the matrix and  */
+/* rhs pointers and args -> k the number in use.                     */
+
+#define WA(i, j)	(wa + ((i) + (j) * m) * LANES)
+#define WB(i, j)	(wb + ((i) + (j) * m) * LANES)
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, ldb, count;
+  BLASLONG i, j, k, l;
+  FLOAT **a, **b, *wa, *wb;
+
+  m      = args -> m;
+  n      = args -> n;
+  lda    = args -> lda;
+  ldb    = args -> ldb;
+  a      = (FLOAT **)args -> a;
+  b      = (FLOAT **)args -> b;
+  count  = args -> k;
+
+  wa = sa;
+  wb = sb;
+
+  for (l = 0; l < count; l++) {
+    for (j = 0; j < m; j++) {
+#ifdef UPPER
+      for (i = 0; i <= j; i++) WA(i, j)[l] = a[l][i + j * lda];
+#else
+      for (i = j; i < m; i++)  WA(i, j)[l] = a[l][i + j * lda];
+#endif
+    }
+    for (j = 0; j < n; j++) {
+      for (i = 0; i < m; i++) WB(i, j)[l] = b[l][i + j * ldb];
+    }
+  }
+
+  for (l = count; l < LANES; l++) {
+    for (j = 0; j < m; j++) {
+#ifdef UPPER
+      for (i = 0; i <= j; i++) WA(i, j)[l] = (i == j) ? ONE : ZERO;
+#else
+      for (i = j; i < m; i++)  WA(i, j)[l] = (i == j) ? ONE : ZERO;
+#endif
+    }
+    for (j = 0; j < n; j++) {
+      for (i = 0; i < m; i++) WB(i, j)[l] = ZERO;
+    }
+  }
+
+  for (j = 0; j < n; j++) {
+
+#ifdef UPPER
+    /* U^T y = b, then U x = y */
+    for (k = 0; k < m; k++) {
+      for (i = 0; i < k; i++) lanes_update(WB(k, j), WA(i, k), WB(i, j));
+      lanes_div(WB(k, j), WA(k, k));
+    }
+
+    for (k = m - 1; k >= 0; k--) {
+      lanes_div(WB(k, j), WA(k, k));
+      for (i = 0; i < k; i++) lanes_update(WB(i, j), WA(i, k), WB(k, j));
+    }
+#else
+    /* L y = b, then L^T x = y */
+    for (k = 0; k < m; k++) {
+      lanes_div(WB(k, j), WA(k, k));
+      for (i = k + 1; i < m; i++) lanes_update(WB(i, j), WA(i, k), WB(k, j));
+    }
+
+    for (k = m - 1; k >= 0; k--) {
+      for (i = k + 1; i < m; i++) lanes_update(WB(k, j), WA(i, k), WB(i, j));
+      lanes_div(WB(k, j), WA(k, k));
+    }
+#endif
+  }
+
+  for (l = 0; l < count; l++) {
+    for (j = 0; j < n; j++) {
+      for (i = 0; i < m; i++) b[l][i + j * ldb] = WB(i, j)[l];
+    }
+  }
+
+  return 0;
+}
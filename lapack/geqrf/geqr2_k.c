@@ -0,0 +1,206 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include "common.h"
+
+/* Unblocked Householder QR of the m x n matrix args -> a; the      */
+/* scalar factors go to args -> b.  Each reflector is applied to    */
+/* the trailing columns with one gemv and one rank-1 update.        */
+
+#ifdef DOUBLE
+#define SAFMIN	(DBL_MIN / (DBL_EPSILON * 0.5))
+#else
+#define SAFMIN	(FLT_MIN / (FLT_EPSILON * 0.5))
+#endif
+
+static FLOAT lapy3(FLOAT x, FLOAT y, FLOAT z) {
+
+  FLOAT w;
+
+  x = fabs(x);
+  y = fabs(y);
+  z = fabs(z);
+
+  w = MAX(x, MAX(y, z));
+  if (w == ZERO) return x + y + z;
+
+  x /= w;
+  y /= w;
+  z /= w;
+
+  return w * sqrt(x * x + y * y + z * z);
+}
+
+/* Generates H with H^H (alpha, x) = (beta, 0) and beta real, as ?larfg */
+static void larfg(BLASLONG n, FLOAT *alpha, FLOAT *x, FLOAT *tau) {
+
+  FLOAT xnorm, alphr, alphi, beta, rsafmn;
+  BLASLONG j, knt;
+#ifdef COMPLEX
+  FLOAT dr, di, ratio, den, sr, si;
+#endif
+
+  tau[0] = ZERO;
+#ifdef COMPLEX
+  tau[1] = ZERO;
+#endif
+
+  if (n <= 0) return;
+
+  xnorm = (n > 1) ? NRM2_K(n - 1, x, 1) : ZERO;
+  alphr = alpha[0];
+#ifdef COMPLEX
+  alphi = alpha[1];
+#else
+  alphi = ZERO;
+#endif
+
+  if ((xnorm == ZERO) && (alphi == ZERO)) return;
+
+  beta = -copysign(lapy3(alphr, alphi, xnorm), alphr);
+
+  /* beta and x may be tiny : rescale until beta is representable */
+  knt = 0;
+  if (fabs(beta) < SAFMIN) {
+    rsafmn = ONE / SAFMIN;
+    do {
+      knt ++;
+      SCAL_K(n - 1, 0, 0, rsafmn,
+#ifdef COMPLEX
+	     ZERO,
+#endif
+	     x, 1, NULL, 0, NULL, 0);
+      beta  *= rsafmn;
+      alphi *= rsafmn;
+      alphr *= rsafmn;
+    } while ((fabs(beta) < SAFMIN) && (knt < 20));
+
+    xnorm = NRM2_K(n - 1, x, 1);
+    beta  = -copysign(lapy3(alphr, alphi, xnorm), alphr);
+  }
+
+  tau[0] = (beta - alphr) / beta;
+
+#ifdef COMPLEX
+  tau[1] = -alphi / beta;
+
+  /* x *= 1 / (alpha - beta) */
+  dr = alphr - beta;
+  di = alphi;
+  if (fabs(dr) >= fabs(di)) {
+    ratio = di / dr;
+    den   = dr + di * ratio;
+    sr    = ONE / den;
+    si    = -ratio / den;
+  } else {
+    ratio = dr / di;
+    den   = di + dr * ratio;
+    sr    = ratio / den;
+    si    = -ONE / den;
+  }
+  if (n > 1) SCAL_K(n - 1, 0, 0, sr, si, x, 1, NULL, 0, NULL, 0);
+#else
+  if (n > 1) SCAL_K(n - 1, 0, 0, ONE / (alphr - beta), x, 1, NULL, 0, NULL, 0);
+#endif
+
+  for (j = 0; j < knt; j++) beta *= SAFMIN;
+
+  alpha[0] = beta;
+#ifdef COMPLEX
+  alpha[1] = ZERO;
+#endif
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, i, j, js, jn, mn;
+  FLOAT *a, *tau, *aii, *w;
+  FLOAT temp[2];
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  w  = sa;
+  mn = MIN(m, n);
+
+  for (i = 0; i < mn; i++) {
+
+    aii = a + (i + i * lda) * COMPSIZE;
+
+    larfg(m - i, aii, aii + COMPSIZE, tau + i * COMPSIZE);
+
+    if (i < n - 1) {
+
+      temp[0] = aii[0];
+      aii[0]  = ONE;
+#ifdef COMPLEX
+      temp[1] = aii[1];
+      aii[1]  = ZERO;
+#endif
+
+      /* A := H(i)^H A : w = A^H v, A -= conj(tau) v w^H, in pieces */
+      /* that fit the GEMM buffer sa                                 */
+      for (js = i + 1; js < n; js += GEMM_P * GEMM_Q) {
+
+	jn = MIN(n - js, GEMM_P * GEMM_Q);
+
+	for (j = 0; j < jn * COMPSIZE; j++) w[j] = ZERO;
+
+	GEMV_C(m - i, jn, 0, ONE,
+#ifdef COMPLEX
+	       ZERO,
+#endif
+	       a + (i + js * lda) * COMPSIZE, lda, aii, 1, w, 1, sb);
+
+	GERC_K(m - i, jn, 0, -tau[i * COMPSIZE],
+#ifdef COMPLEX
+	       tau[i * COMPSIZE + 1],
+#endif
+	       aii, 1, w, 1, a + (i + js * lda) * COMPSIZE, lda, sb);
+      }
+
+      aii[0] = temp[0];
+#ifdef COMPLEX
+      aii[1] = temp[1];
+#endif
+    }
+  }
+
+  return 0;
+}
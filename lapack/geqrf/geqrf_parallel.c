@@ -0,0 +1,211 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Blocked QR with a look-ahead of one panel.  While the pool threads */
+/* apply the reflectors of panel j to the columns right of panel j+1, */
+/* the caller updates panel j+1 alone and factors it, so the level 2  */
+/* panel work is hidden behind the level 3 trailing update.           */
+
+typedef struct {
+  blas_arg_t update;		/* LARFB_LT of the current panel */
+  blas_arg_t panel;		/* GEQR2 of the next panel */
+  FLOAT     *t;			/* its triangular factor */
+  BLASLONG   ldt;
+} panel_arg_t;
+
+static int panel_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  panel_arg_t *arg = (panel_arg_t *)args;
+
+  LARFB_LT(&arg -> update, NULL, range_n, sa, sb, 0);
+
+  GEQR2(&arg -> panel, NULL, NULL, sa, sb, 0);
+
+  LARFT(arg -> panel.m, arg -> panel.n, (FLOAT *)arg -> panel.a, arg -> panel.lda,
+	(FLOAT *)arg -> panel.b, arg -> t, arg -> ldt, sb);
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, mn, nb, j, jb, next, rest, width, i, num_cpu, nthreads;
+  FLOAT *a, *tau, *t[2], *w;
+  int mode, cur;
+
+  panel_arg_t arg;
+  blas_queue_t queue[MAX_CPU_NUMBER];
+  BLASLONG range[MAX_CPU_NUMBER + 1];
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  nthreads = args -> nthreads;
+  if (nthreads > MAX_CPU_NUMBER) nthreads = MAX_CPU_NUMBER;
+
+  mn = MIN(m, n);
+  nb = QR_BLOCKING;
+
+  if ((nthreads == 1) || (mn <= 2 * nb) || (n <= 4 * nb)) {
+    GEQRF_SINGLE(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  /* Both T and W go into the caller's work when it is large enough */
+  if ((args -> d != NULL) && (args -> ldd >= 2 * nb * nb + nb * n))
+    t[0] = (FLOAT *)args -> d;
+  else
+    t[0] = (FLOAT *)malloc((2 * nb * nb + nb * n) * COMPSIZE * sizeof(FLOAT));
+
+  if (t[0] == NULL) {
+    GEQRF_SINGLE(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  t[1] = t[0] + nb * nb * COMPSIZE;
+  w    = t[1] + nb * nb * COMPSIZE;
+  cur  = 0;
+
+  /* The first panel has nothing to wait for */
+  jb = MIN(mn, nb);
+
+  arg.panel.m   = m;
+  arg.panel.n   = jb;
+  arg.panel.a   = a;
+  arg.panel.lda = lda;
+  arg.panel.b   = tau;
+
+  GEQR2(&arg.panel, NULL, NULL, sa, sb, 0);
+  LARFT(m, jb, a, lda, tau, t[cur], nb, sb);
+
+  j = 0;
+
+  while (j + jb < n) {
+
+    arg.update.a   = a + (j + j * lda) * COMPSIZE;
+    arg.update.lda = lda;
+    arg.update.b   = t[cur];
+    arg.update.ldb = nb;
+    arg.update.c   = a + (j + (j + jb) * lda) * COMPSIZE;
+    arg.update.ldc = lda;
+    arg.update.d   = w;
+    arg.update.ldd = nb;
+    arg.update.m   = m - j;
+    arg.update.n   = n - j - jb;
+    arg.update.k   = jb;
+
+    next = MIN(mn - j - jb, nb);
+    rest = n - j - jb - next;
+
+    if (next <= 0) {
+      /* Only the columns beyond min(m, n) are left */
+      gemm_thread_n(mode, &arg.update, NULL, NULL, (void *)LARFB_LT, sa, sb, nthreads);
+      break;
+    }
+
+    arg.panel.m   = m - j - jb;
+    arg.panel.n   = next;
+    arg.panel.a   = a + ((j + jb) + (j + jb) * lda) * COMPSIZE;
+    arg.panel.lda = lda;
+    arg.panel.b   = tau + (j + jb) * COMPSIZE;
+    arg.t         = t[1 - cur];
+    arg.ldt       = nb;
+
+    /* queue[0] is the look-ahead panel, run by the caller */
+    range[0] = 0;
+    range[1] = next;
+    num_cpu  = 1;
+
+    while (rest > 0) {
+      width = blas_quickdivide(rest + nthreads - num_cpu - 1, nthreads - num_cpu);
+      width = ((width + GEMM_UNROLL_N - 1) / GEMM_UNROLL_N) * GEMM_UNROLL_N;
+      if (width > rest) width = rest;
+
+      range[num_cpu + 1] = range[num_cpu] + width;
+      rest -= width;
+      num_cpu ++;
+      if (num_cpu >= nthreads) break;
+    }
+    if (rest > 0) range[num_cpu] += rest;
+
+    for (i = 0; i < num_cpu; i++) {
+      queue[i].mode    = mode;
+      queue[i].routine = (i == 0) ? (void *)panel_thread : (void *)LARFB_LT;
+      queue[i].args    = (i == 0) ? (blas_arg_t *)&arg : &arg.update;
+      queue[i].range_m = NULL;
+      queue[i].range_n = &range[i];
+      queue[i].sa      = NULL;
+      queue[i].sb      = NULL;
+      queue[i].next    = &queue[i + 1];
+    }
+
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, queue);
+
+    cur = 1 - cur;
+    j  += jb;
+    jb  = next;
+  }
+
+  if (t[0] != (FLOAT *)args -> d) free(t[0]);
+
+  return 0;
+}
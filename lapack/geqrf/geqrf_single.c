@@ -0,0 +1,110 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Blocked QR : each panel of QR_BLOCKING columns is factored by   */
+/* geqr2, its reflectors are gathered into the compact WY form     */
+/* I - V T V^H and applied to the trailing columns with level 3.   */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda, mn, nb, j, jb;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  mn = MIN(m, n);
+  if (mn <= 0) return 0;
+
+  nb = QR_BLOCKING;
+
+  /* T and W go into the caller's work when it is large enough */
+  t = NULL;
+  if ((mn > nb) || (n > 2 * nb)) {
+    if ((args -> d != NULL) && (args -> ldd >= nb * nb + nb * n))
+      t = (FLOAT *)args -> d;
+    else
+      t = (FLOAT *)malloc((nb * nb + nb * n) * COMPSIZE * sizeof(FLOAT));
+  }
+
+  if (t == NULL) {
+    GEQR2(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  w = t + nb * nb * COMPSIZE;
+
+  for (j = 0; j < mn; j += nb) {
+
+    jb = MIN(mn - j, nb);
+
+    newarg.m   = m - j;
+    newarg.n   = jb;
+    newarg.a   = a + (j + j * lda) * COMPSIZE;
+    newarg.lda = lda;
+    newarg.b   = tau + j * COMPSIZE;
+
+    GEQR2(&newarg, NULL, NULL, sa, sb, 0);
+
+    if (j + jb < n) {
+
+      LARFT(m - j, jb, a + (j + j * lda) * COMPSIZE, lda, tau + j * COMPSIZE, t, nb, sb);
+
+      newarg.a   = a + (j + j * lda) * COMPSIZE;
+      newarg.lda = lda;
+      newarg.b   = t;
+      newarg.ldb = nb;
+      newarg.c   = a + (j + (j + jb) * lda) * COMPSIZE;
+      newarg.ldc = lda;
+      newarg.d   = w;
+      newarg.ldd = nb;
+      newarg.m   = m - j;
+      newarg.n   = n - j - jb;
+      newarg.k   = jb;
+
+      LARFB_LT(&newarg, NULL, NULL, sa, sb, 0);
+    }
+  }
+
+  if (t != (FLOAT *)args -> d) free(t);
+
+  return 0;
+}
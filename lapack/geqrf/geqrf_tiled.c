@@ -0,0 +1,175 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include "common.h"
+
+/* Blocked QR on the task DAG.  The column blocks are the handles : */
+/* a panel task factors block k and forms its T, an update task     */
+/* applies it to one block right of it.  The panel of k + 1 starts  */
+/* once block k + 1 has its update, while the other blocks are      */
+/* still being updated, which gives a look-ahead of any depth.      */
+
+typedef struct {
+  FLOAT *a, *tau, *t, *w;
+  BLASLONG m, n, lda, nb, nt, mn;
+} tiled_t;
+
+#define BLOCK(t, j)	((t) -> a + (j) * (t) -> nb * (t) -> lda * COMPSIZE)
+#define WIDTH(t, j)	MIN((t) -> nb, (t) -> n  - (j) * (t) -> nb)
+#define PANEL(t, k)	MIN((t) -> nb, (t) -> mn - (k) * (t) -> nb)
+#define TFACTOR(t, k)	((t) -> t + (k) * (t) -> nb * (t) -> nb * COMPSIZE)
+
+/* Applies H^H of panel k to ncol columns from col */
+static void update(tiled_t *t, BLASLONG k, BLASLONG col, BLASLONG ncol, void *sa, void *sb){
+
+  blas_arg_t args;
+  BLASLONG row = k * t -> nb;
+
+  args.a   = t -> a + (row + row * t -> lda) * COMPSIZE;
+  args.lda = t -> lda;
+  args.b   = TFACTOR(t, k);
+  args.ldb = t -> nb;
+  args.c   = t -> a + (row + col * t -> lda) * COMPSIZE;
+  args.ldc = t -> lda;
+  args.d   = t -> w + col * t -> nb * COMPSIZE;
+  args.ldd = t -> nb;
+  args.m   = t -> m - row;
+  args.n   = ncol;
+  args.k   = PANEL(t, k);
+
+  LARFB_LT(&args, NULL, NULL, sa, sb, 0);
+}
+
+static int panel_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+  BLASLONG row = k * t -> nb, kb = PANEL(t, k);
+
+  args.m   = t -> m - row;
+  args.n   = kb;
+  args.a   = t -> a + (row + row * t -> lda) * COMPSIZE;
+  args.lda = t -> lda;
+  args.b   = t -> tau + row * COMPSIZE;
+
+  GEQR2(&args, NULL, NULL, sa, sb, 0);
+
+  if (row + kb < t -> n) {
+    LARFT(t -> m - row, kb, (FLOAT *)args.a, t -> lda, (FLOAT *)args.b, TFACTOR(t, k), t -> nb, (FLOAT *)sb);
+
+    /* m < n leaves columns of the last block right of the last panel */
+    if (WIDTH(t, k) > kb) update(t, k, row + kb, WIDTH(t, k) - kb, sa, sb);
+  }
+
+  return 0;
+}
+
+static int update_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+
+  update(t, k, j * t -> nb, WIDTH(t, j), sa, sb);
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  tiled_t t;
+  blas_dag_t *dag;
+  BLASLONG j, k, kt, in, out;
+  int mode, err;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  t.m   = args -> m;
+  t.n   = args -> n;
+  t.mn  = MIN(t.m, t.n);
+  t.a   = (FLOAT *)args -> a;
+  t.lda = args -> lda;
+  t.tau = (FLOAT *)args -> b;
+
+  t.nb = blas_dag_blocking(t.mn, GEMM_Q, GEMM_UNROLL_N, 1, args -> nthreads);
+  t.nt = (t.n  + t.nb - 1) / t.nb;
+  kt   = (t.mn + t.nb - 1) / t.nb;
+
+  if ((args -> nthreads == 1) || (kt < 2)) return GEQRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  /* one T per panel, W is shared as the updates of a block are ordered */
+  t.t = (FLOAT *)malloc((kt * t.nb * t.nb + t.nb * t.n) * COMPSIZE * sizeof(FLOAT));
+  dag = blas_dag_create(&t, t.nt);
+
+  if ((t.t == NULL) || (dag == NULL)) {
+    free(t.t);
+    blas_dag_destroy(dag);
+    return GEQRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+  }
+
+  t.w = t.t + kt * t.nb * t.nb * COMPSIZE;
+
+  err = 0;
+  for (k = 0; (k < kt) && !err; k++) {
+    in = k;
+    err |= blas_dag_insert(dag, panel_task, k, k, k, 2 * (t.nt - k) + 1, NULL, 0, &in, 1);
+
+    for (j = k + 1; j < t.nt; j++) {
+      out = j;
+      err |= blas_dag_insert(dag, update_task, k, j, k, 2 * (t.nt - j), &in, 1, &out, 1);
+    }
+  }
+
+  if (!err) err = blas_dag_execute(dag, mode, args -> nthreads, sa, sb);
+
+  blas_dag_destroy(dag);
+  free(t.t);
+
+  if (err) return GEQRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  return 0;
+}
@@ -0,0 +1,251 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Applies the block reflector H = I - V T V^H (or H^H with TRANSA)  */
+/* from the left, or from the right with RSIDE, to the m x n matrix  */
+/* args -> c.  V is the unit lower trapezoidal args -> a with k      */
+/* columns, T the k x k upper triangle args -> b and args -> d the   */
+/* workspace W, k x n on the left side and m x k on the right.  When */
+/* called through gemm_thread_n (left) or gemm_thread_m (right) the  */
+/* range selects the slice of C, and of W, to update.                */
+
+static FLOAT dp1[2] = { ONE, ZERO};
+static FLOAT dm1[2] = {-ONE, ZERO};
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, ldv, ldt, ldc, ldw, j;
+  FLOAT *v, *t, *c, *w;
+  blas_arg_t newarg;
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  v   = (FLOAT *)args -> a;
+  t   = (FLOAT *)args -> b;
+  c   = (FLOAT *)args -> c;
+  w   = (FLOAT *)args -> d;
+  ldv = args -> lda;
+  ldt = args -> ldb;
+  ldc = args -> ldc;
+  ldw = args -> ldd;
+
+#ifndef RSIDE
+  if (range_n) {
+    n  = range_n[1] - range_n[0];
+    c += range_n[0] * ldc * COMPSIZE;
+    w += range_n[0] * ldw * COMPSIZE;
+  }
+#else
+  if (range_m) {
+    m  = range_m[1] - range_m[0];
+    c += range_m[0] * COMPSIZE;
+    w += range_m[0] * COMPSIZE;
+  }
+#endif
+
+  if ((m <= 0) || (n <= 0) || (k <= 0)) return 0;
+
+#ifndef RSIDE
+
+  /* W = V1^H C1, k x n */
+  for (j = 0; j < n; j++)
+    COPY_K(k, c + j * ldc * COMPSIZE, 1, w + j * ldw * COMPSIZE, 1);
+
+  newarg.a    = v;
+  newarg.lda  = ldv;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = k;
+  newarg.n    = n;
+  newarg.beta = dp1;
+
+  TRMM_LCLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  /* W += V2^H C2 */
+  if (m > k) {
+    newarg.a     = v + k * COMPSIZE;
+    newarg.lda   = ldv;
+    newarg.b     = c + k * COMPSIZE;
+    newarg.ldb   = ldc;
+    newarg.c     = w;
+    newarg.ldc   = ldw;
+    newarg.m     = k;
+    newarg.n     = n;
+    newarg.k     = m - k;
+    newarg.alpha = dp1;
+    newarg.beta  = dp1;
+
+    GEMM_CN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* W = T W, or T^H W */
+  newarg.a    = t;
+  newarg.lda  = ldt;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = k;
+  newarg.n    = n;
+  newarg.beta = dp1;
+
+#ifdef TRANSA
+  TRMM_LCUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_LNUN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+  /* C2 -= V2 W */
+  if (m > k) {
+    newarg.a     = v + k * COMPSIZE;
+    newarg.lda   = ldv;
+    newarg.b     = w;
+    newarg.ldb   = ldw;
+    newarg.c     = c + k * COMPSIZE;
+    newarg.ldc   = ldc;
+    newarg.m     = m - k;
+    newarg.n     = n;
+    newarg.k     = k;
+    newarg.alpha = dm1;
+    newarg.beta  = dp1;
+
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* C1 -= V1 W */
+  newarg.a    = v;
+  newarg.lda  = ldv;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = k;
+  newarg.n    = n;
+  newarg.beta = dp1;
+
+  TRMM_LNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < n; j++)
+    AXPYU_K(k, 0, 0, -ONE,
+#ifdef COMPLEX
+	    ZERO,
+#endif
+	    w + j * ldw * COMPSIZE, 1, c + j * ldc * COMPSIZE, 1, NULL, 0);
+
+#else
+
+  /* W = C1 V1, m x k */
+  for (j = 0; j < k; j++)
+    COPY_K(m, c + j * ldc * COMPSIZE, 1, w + j * ldw * COMPSIZE, 1);
+
+  newarg.a    = v;
+  newarg.lda  = ldv;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = m;
+  newarg.n    = k;
+  newarg.beta = dp1;
+
+  TRMM_RNLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  /* W += C2 V2 */
+  if (n > k) {
+    newarg.a     = c + k * ldc * COMPSIZE;
+    newarg.lda   = ldc;
+    newarg.b     = v + k * COMPSIZE;
+    newarg.ldb   = ldv;
+    newarg.c     = w;
+    newarg.ldc   = ldw;
+    newarg.m     = m;
+    newarg.n     = k;
+    newarg.k     = n - k;
+    newarg.alpha = dp1;
+    newarg.beta  = dp1;
+
+    GEMM_NN(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* W = W T, or W T^H */
+  newarg.a    = t;
+  newarg.lda  = ldt;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = m;
+  newarg.n    = k;
+  newarg.beta = dp1;
+
+#ifdef TRANSA
+  TRMM_RCUN(&newarg, NULL, NULL, sa, sb, 0);
+#else
+  TRMM_RNUN(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+
+  /* C2 -= W V2^H */
+  if (n > k) {
+    newarg.a     = w;
+    newarg.lda   = ldw;
+    newarg.b     = v + k * COMPSIZE;
+    newarg.ldb   = ldv;
+    newarg.c     = c + k * ldc * COMPSIZE;
+    newarg.ldc   = ldc;
+    newarg.m     = m;
+    newarg.n     = n - k;
+    newarg.k     = k;
+    newarg.alpha = dm1;
+    newarg.beta  = dp1;
+
+    GEMM_NC(&newarg, NULL, NULL, sa, sb, 0);
+  }
+
+  /* C1 -= W V1^H */
+  newarg.a    = v;
+  newarg.lda  = ldv;
+  newarg.b    = w;
+  newarg.ldb  = ldw;
+  newarg.m    = m;
+  newarg.n    = k;
+  newarg.beta = dp1;
+
+  TRMM_RCLU(&newarg, NULL, NULL, sa, sb, 0);
+
+  for (j = 0; j < k; j++)
+    AXPYU_K(m, 0, 0, -ONE,
+#ifdef COMPLEX
+	    ZERO,
+#endif
+	    w + j * ldw * COMPSIZE, 1, c + j * ldc * COMPSIZE, 1, NULL, 0);
+
+#endif
+
+  return 0;
+}
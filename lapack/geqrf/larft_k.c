@@ -0,0 +1,98 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+#ifndef COMPLEX
+#define TRMV	TRMV_NUN
+#else
+#define TRMV	ZTRMV_NUN
+#endif
+
+/* Upper triangular factor T of the block reflector                 */
+/* H = H(0) H(1) ... H(k-1) = I - V T V^H, with the m x k unit lower */
+/* trapezoidal V stored below the diagonal as geqr2 leaves it.      */
+
+int CNAME(BLASLONG m, BLASLONG k, FLOAT *v, BLASLONG ldv, FLOAT *tau, FLOAT *t, BLASLONG ldt, FLOAT *buffer) {
+
+  BLASLONG i, j;
+  FLOAT tr, ti, *col, *vi;
+
+  for (i = 0; i < k; i++) {
+
+    tr  = tau[i * COMPSIZE + 0];
+#ifdef COMPLEX
+    ti  = tau[i * COMPSIZE + 1];
+#else
+    ti  = ZERO;
+#endif
+    col = t + i * ldt * COMPSIZE;
+
+    if ((tr == ZERO) && (ti == ZERO)) {
+
+      for (j = 0; j < i * COMPSIZE; j++) col[j] = ZERO;
+
+    } else {
+
+      /* T(0:i, i) = -tau(i) V(i:m, 0:i)^H v(i), v(i) having a unit head */
+      vi = v + i * COMPSIZE;
+      for (j = 0; j < i; j++) {
+#ifndef COMPLEX
+	col[j] = -tr * vi[j * ldv];
+#else
+	col[j * 2 + 0] = -(tr * vi[j * ldv * 2 + 0] + ti * vi[j * ldv * 2 + 1]);
+	col[j * 2 + 1] = -(ti * vi[j * ldv * 2 + 0] - tr * vi[j * ldv * 2 + 1]);
+#endif
+      }
+
+      if ((i > 0) && (m - i - 1 > 0)) {
+	GEMV_C(m - i - 1, i, 0, -tr,
+#ifdef COMPLEX
+	       -ti,
+#endif
+	       v + (i + 1) * COMPSIZE, ldv, v + (i + 1 + i * ldv) * COMPSIZE, 1, col, 1, buffer);
+      }
+
+      /* T(0:i, i) = T(0:i, 0:i) T(0:i, i) */
+      if (i > 0) TRMV(i, t, ldt, col, 1, buffer);
+    }
+
+    col[i * COMPSIZE + 0] = tr;
+#ifdef COMPLEX
+    col[i * COMPSIZE + 1] = ti;
+#endif
+  }
+
+  return 0;
+}
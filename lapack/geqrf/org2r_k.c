@@ -0,0 +1,118 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Generates the m x n matrix Q with orthonormal columns, the first  */
+/* n columns of H(0) H(1) ... H(k-1), from the reflectors geqr2      */
+/* leaves in args -> a and their scalar factors in args -> b.        */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda, i, j, js, jn;
+  FLOAT *a, *tau, *aii, *w;
+  FLOAT tr, ti;
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  w = sa;
+
+  if (n <= 0) return 0;
+
+  /* Columns k:n start as columns of the unit matrix */
+  for (j = k; j < n; j++) {
+    for (i = 0; i < m * COMPSIZE; i++) a[i + j * lda * COMPSIZE] = ZERO;
+    a[(j + j * lda) * COMPSIZE] = ONE;
+  }
+
+  for (i = k - 1; i >= 0; i--) {
+
+    aii = a + (i + i * lda) * COMPSIZE;
+    tr  = tau[i * COMPSIZE + 0];
+#ifdef COMPLEX
+    ti  = tau[i * COMPSIZE + 1];
+#else
+    ti  = ZERO;
+#endif
+
+    /* A(i:m, i+1:n) := H(i) A : w = A^H v, A -= tau v w^H */
+    if (i < n - 1) {
+
+      aii[0] = ONE;
+#ifdef COMPLEX
+      aii[1] = ZERO;
+#endif
+
+      for (js = i + 1; js < n; js += GEMM_P * GEMM_Q) {
+
+	jn = MIN(n - js, GEMM_P * GEMM_Q);
+
+	for (j = 0; j < jn * COMPSIZE; j++) w[j] = ZERO;
+
+	GEMV_C(m - i, jn, 0, ONE,
+#ifdef COMPLEX
+	       ZERO,
+#endif
+	       a + (i + js * lda) * COMPSIZE, lda, aii, 1, w, 1, sb);
+
+	GERC_K(m - i, jn, 0, -tr,
+#ifdef COMPLEX
+	       -ti,
+#endif
+	       aii, 1, w, 1, a + (i + js * lda) * COMPSIZE, lda, sb);
+      }
+    }
+
+    if (i < m - 1)
+      SCAL_K(m - i - 1, 0, 0, -tr,
+#ifdef COMPLEX
+	     -ti,
+#endif
+	     aii + COMPSIZE, 1, NULL, 0, NULL, 0);
+
+    aii[0] = ONE - tr;
+#ifdef COMPLEX
+    aii[1] = -ti;
+#endif
+
+    for (j = 0; j < i * COMPSIZE; j++) a[j + i * lda * COMPSIZE] = ZERO;
+  }
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Blocked generation of Q, walking the panels of QR_BLOCKING        */
+/* reflectors backwards as ?orgqr does : each block reflector is     */
+/* applied to the columns already generated, then its own columns    */
+/* are built by org2r.  The block updates run across args->nthreads. */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda, nb, ki, kk, i, ib, j, js;
+  FLOAT *a, *tau, *t, *w;
+  blas_arg_t newarg;
+#ifdef SMP
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+
+  if (n <= 0) return 0;
+
+  nb = QR_BLOCKING;
+
+  /* T and W go into the caller's work when it is large enough */
+  t = NULL;
+  if (k > nb) {
+    if ((args -> d != NULL) && (args -> ldd >= nb * nb + nb * n))
+      t = (FLOAT *)args -> d;
+    else
+      t = (FLOAT *)malloc((nb * nb + nb * n) * COMPSIZE * sizeof(FLOAT));
+  }
+
+  if (t == NULL) {
+    ORG2R(args, NULL, NULL, sa, sb, 0);
+    return 0;
+  }
+
+  w = t + nb * nb * COMPSIZE;
+
+  /* The last block is generated unblocked, with the columns past k */
+  ki = ((k - nb - 1) / nb) * nb;
+  kk = MIN(k, ki + nb);
+
+  for (js = kk; js < n; js++)
+    for (j = 0; j < kk * COMPSIZE; j++) a[j + js * lda * COMPSIZE] = ZERO;
+
+  newarg.m   = m - kk;
+  newarg.n   = n - kk;
+  newarg.k   = k - kk;
+  newarg.a   = a + (kk + kk * lda) * COMPSIZE;
+  newarg.lda = lda;
+  newarg.b   = tau + kk * COMPSIZE;
+
+  ORG2R(&newarg, NULL, NULL, sa, sb, 0);
+
+  for (i = ki; i >= 0; i -= nb) {
+
+    ib = MIN(nb, k - i);
+
+    if (i + ib < n) {
+
+      LARFT(m - i, ib, a + (i + i * lda) * COMPSIZE, lda, tau + i * COMPSIZE, t, nb, sb);
+
+      newarg.a   = a + (i + i * lda) * COMPSIZE;
+      newarg.lda = lda;
+      newarg.b   = t;
+      newarg.ldb = nb;
+      newarg.c   = a + (i + (i + ib) * lda) * COMPSIZE;
+      newarg.ldc = lda;
+      newarg.d   = w;
+      newarg.ldd = nb;
+      newarg.m   = m - i;
+      newarg.n   = n - i - ib;
+      newarg.k   = ib;
+
+#ifdef SMP
+      if ((args -> nthreads > 1) && (newarg.n > 2 * nb))
+	gemm_thread_n(mode, &newarg, NULL, NULL, (void *)LARFB_LN, sa, sb, args -> nthreads);
+      else
+#endif
+	LARFB_LN(&newarg, NULL, NULL, sa, sb, 0);
+    }
+
+    newarg.m   = m - i;
+    newarg.n   = ib;
+    newarg.k   = ib;
+    newarg.a   = a + (i + i * lda) * COMPSIZE;
+    newarg.lda = lda;
+    newarg.b   = tau + i * COMPSIZE;
+
+    ORG2R(&newarg, NULL, NULL, sa, sb, 0);
+
+    for (js = i; js < i + ib; js++)
+      for (j = 0; j < i * COMPSIZE; j++) a[j + js * lda * COMPSIZE] = ZERO;
+  }
+
+  if (t != (FLOAT *)args -> d) free(t);
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "common.h"
+
+/* Multiplies the m x n matrix args -> c by Q, or Q^H with TRANSA,  */
+/* from the left, or from the right with RSIDE.  Q is the product   */
+/* of the k reflectors geqrf leaves in args -> a and args -> b;     */
+/* they are applied a block of QR_BLOCKING at a time.               */
+
+#ifndef RSIDE
+#ifndef TRANSA
+#define LARFB	LARFB_LN
+#else
+#define LARFB	LARFB_LT
+#define FORWARD
+#endif
+#else
+#ifndef TRANSA
+#define LARFB	LARFB_RN
+#define FORWARD
+#else
+#define LARFB	LARFB_RT
+#endif
+#endif
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, k, lda, ldc, nq, nw, nb, i, ib, start, step;
+  FLOAT *a, *tau, *c, *t;
+  blas_arg_t newarg;
+#ifdef SMP
+  int mode;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+#endif
+
+  m   = args -> m;
+  n   = args -> n;
+  k   = args -> k;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  tau = (FLOAT *)args -> b;
+  c   = (FLOAT *)args -> c;
+  ldc = args -> ldc;
+
+  if ((m <= 0) || (n <= 0) || (k <= 0)) return 0;
+
+  nb = QR_BLOCKING;
+
+#ifndef RSIDE
+  nq = m;
+  nw = n;
+  newarg.ldd = nb;
+#else
+  nq = n;
+  nw = m;
+  newarg.ldd = m;
+#endif
+
+  /* T and W go into the caller's work when it is large enough */
+  if ((args -> d != NULL) && (args -> ldd >= nb * nb + nb * nw))
+    t = (FLOAT *)args -> d;
+  else
+    t = (FLOAT *)malloc((nb * nb + nb * nw) * COMPSIZE * sizeof(FLOAT));
+
+  if (t == NULL) return 1;
+
+  newarg.d = t + nb * nb * COMPSIZE;
+
+#ifdef FORWARD
+  start = 0;
+  step  = nb;
+#else
+  start = ((k - 1) / nb) * nb;
+  step  = -nb;
+#endif
+
+  for (i = start; (i >= 0) && (i < k); i += step) {
+
+    ib = MIN(nb, k - i);
+
+    LARFT(nq - i, ib, a + (i + i * lda) * COMPSIZE, lda, tau + i * COMPSIZE, t, nb, sb);
+
+    newarg.a   = a + (i + i * lda) * COMPSIZE;
+    newarg.lda = lda;
+    newarg.b   = t;
+    newarg.ldb = nb;
+    newarg.ldc = ldc;
+    newarg.k   = ib;
+
+#ifndef RSIDE
+    newarg.c   = c + i * COMPSIZE;
+    newarg.m   = m - i;
+    newarg.n   = n;
+#ifdef SMP
+    if ((args -> nthreads > 1) && (n > 2 * nb))
+      gemm_thread_n(mode, &newarg, NULL, NULL, (void *)LARFB, sa, sb, args -> nthreads);
+    else
+#endif
+      LARFB(&newarg, NULL, NULL, sa, sb, 0);
+#else
+    newarg.c   = c + i * ldc * COMPSIZE;
+    newarg.m   = m;
+    newarg.n   = n - i;
+#ifdef SMP
+    if ((args -> nthreads > 1) && (m > 2 * nb))
+      gemm_thread_m(mode, &newarg, NULL, NULL, (void *)LARFB, sa, sb, args -> nthreads);
+    else
+#endif
+      LARFB(&newarg, NULL, NULL, sa, sb, 0);
+#endif
+  }
+
+  if (t != (FLOAT *)args -> d) free(t);
+
+  return 0;
+}
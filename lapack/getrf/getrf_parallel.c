@@ -148,6 +148,8 @@ static void inner_basic_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *ra
       min_jj = js + min_j - jjs;
       if (min_jj > GEMM_UNROLL_N) min_jj = GEMM_UNROLL_N;
 
+      /* Not LASWP_NCOPY: it leaves the pivot rows of c unswapped, */
+      /* and TRSM_KERNEL_LT takes its right-hand side from c.       */
       if (0 && GEMM_UNROLL_N <= 8) {
 
 	LASWP_NCOPY(min_jj, off + 1, off + k,
@@ -296,7 +298,6 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
       if (min_jj > GEMM_UNROLL_N) min_jj = GEMM_UNROLL_N;
 
       if (0 && GEMM_UNROLL_N <= 8) {
-	printf("helllo\n");
 
 	LASWP_NCOPY(min_jj, off + 1, off + k,
 		    b + (- off + jjs * lda) * COMPSIZE, lda,
@@ -419,6 +420,31 @@ static int inner_advanced_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *
   return 0;
 }
 
+/* Applies the pivots of the later panels to the columns left of them. */
+/* panel[] holds the first column of each panel.                        */
+static int laswp_left_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos){
+
+  BLASLONG *panel = (BLASLONG *)args -> common;
+  BLASLONG mn     = args -> m;
+  BLASLONG lda    = args -> lda;
+  BLASLONG offset = args -> ldb;
+  BLASLONG i, js, je;
+
+  for (i = 0; (i < args -> k) && (panel[i] < range_n[1]); i++) {
+    js = MAX(panel[i],     range_n[0]);
+    je = MIN(panel[i + 1], range_n[1]);
+
+    if (js < je)
+      LASWP_PLUS(je - js, panel[i + 1] + offset + 1, mn + offset, ZERO,
+#ifdef COMPLEX
+		 ZERO,
+#endif
+		 (FLOAT *)args -> a + (- offset + js * lda) * COMPSIZE, lda, NULL, 0, (blasint *)args -> c, 1);
+  }
+
+  return 0;
+}
+
 #if 1
 
 blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
@@ -430,7 +456,6 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
   blas_arg_t newarg;
 
   FLOAT *a, *sbb;
-  FLOAT dummyalpha[2] = {ZERO, ZERO};
 
   blas_queue_t queue[MAX_CPU_NUMBER];
 
@@ -449,6 +474,9 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
   BLASLONG num_cpu;
   BLASLONG f;
 
+  BLASLONG *panel, npanel;
+  double work;
+
 #ifdef _MSC_VER
   BLASLONG flag[MAX_CPU_NUMBER * CACHE_LINE_SIZE];
 #else
@@ -531,6 +559,14 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
   newarg.common   = (void *)job;
 
+  /* every panel but the last is wider than GEMM_UNROLL_N */
+  panel = (BLASLONG *)malloc((mn / GEMM_UNROLL_N + 2) * sizeof(BLASLONG));
+  if (panel == NULL) {
+    fprintf(stderr, "OpenBLAS: malloc failed in %s\n", __func__);
+    exit(1);
+  }
+  npanel = 0;
+
   TRSM_ILTCOPY(bk, bk, a, lda, 0, sb);
 
   sbb = (FLOAT *)((((BLASULONG)(sb + bk * bk * COMPSIZE) + GEMM_ALIGN) & ~GEMM_ALIGN) + GEMM_OFFSET_B);
@@ -540,6 +576,8 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
   while (is < mn) {
 
+    panel[npanel ++] = is;
+
     width  = ((FORMULA1(m, n, is, bk, args -> nthreads) + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
     if (width > mn - is - bk) width = mn - is - bk;
 
@@ -682,29 +720,57 @@ blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa,
 
   }
 
-  next_bk = init_bk;
-  is = 0;
+  /* the last panel's update right of mn may still be running */
+  if (num_cpu > 0) exec_blas_async_wait(num_cpu, &queue[0]);
 
-  while (is < mn) {
+  /* The columns left of the last panel get all their later pivots in */
+  /* one dispatch.  Column j takes about mn - j swaps, so the ranges   */
+  /* narrow towards the left to give each thread the same share.      */
+  newarg.a      = a;
+  newarg.c      = ipiv;
+  newarg.m      = mn;
+  newarg.k      = npanel - 1;
+  newarg.lda    = lda;
+  newarg.ldb    = offset;
+  newarg.common = (void *)panel;
 
-    bk = mn - is;
-    if (bk > next_bk) bk = next_bk;
+  nn   = panel[npanel - 1];
+  work = (double)mn * (double)mn - (double)(mn - nn) * (double)(mn - nn);
 
-    width  = ((FORMULA1(m, n, is, bk, args -> nthreads) + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
-    if (width > mn - is - bk) width = mn - is - bk;
+  range_N[0] = 0;
+  num_cpu    = 0;
 
-    if (width < bk) {
-      next_bk = ((FORMULA2(m, n, is, bk, args -> nthreads) + GEMM_UNROLL_N)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
-      if (next_bk > bk) next_bk = bk;
-    }
+  while (range_N[num_cpu] < nn) {
 
-    blas_level1_thread(mode, bk, is + bk + offset + 1, mn + offset, (void *)dummyalpha,
-		       a + (- offset + is * lda) * COMPSIZE, lda, NULL, 0,
-		       ipiv, 1, (void *)LASWP_PLUS, args -> nthreads);
+    width = mn - (BLASLONG)sqrt((double)mn * (double)mn - work * (double)(num_cpu + 1) / (double)args -> nthreads);
+    width = ((width + GEMM_UNROLL_N - 1)/GEMM_UNROLL_N) * GEMM_UNROLL_N;
+    if (width <= range_N[num_cpu]) width = range_N[num_cpu] + GEMM_UNROLL_N;
+    if ((width > nn) || (num_cpu == args -> nthreads - 1)) width = nn;
 
-    is += bk;
+    range_N[num_cpu + 1] = width;
+
+    queue[num_cpu].mode    = mode;
+    queue[num_cpu].routine = laswp_left_thread;
+    queue[num_cpu].args    = &newarg;
+    queue[num_cpu].range_m = NULL;
+    queue[num_cpu].range_n = &range_N[num_cpu];
+    queue[num_cpu].sa      = NULL;
+    queue[num_cpu].sb      = NULL;
+    queue[num_cpu].next    = &queue[num_cpu + 1];
+
+    num_cpu ++;
   }
 
+  if (num_cpu > 0) {
+    queue[0].sa = sa;
+    queue[0].sb = sb;
+    queue[num_cpu - 1].next = NULL;
+
+    exec_blas(num_cpu, &queue[0]);
+  }
+
+  free(panel);
+
 #ifdef USE_ALLOC_HEAP
   free(job);
 #endif
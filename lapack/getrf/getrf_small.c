@@ -0,0 +1,117 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Left looking LU with partial pivoting for matrices that stay in L1.  */
+/* Row interchanges are applied to the whole row as soon as the pivot   */
+/* is known, and the columns below the diagonal take their update from  */
+/* four earlier columns at a time.  No buffer is used.                  */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG m, n, lda;
+  BLASLONG i, j, k, jp, kmax;
+  blasint *ipiv, info;
+  FLOAT *a, *aj, *a0, *a1, *a2, *a3;
+  FLOAT t0, t1, t2, t3, temp;
+
+  m      = args -> m;
+  n      = args -> n;
+  a      = (FLOAT *)args -> a;
+  lda    = args -> lda;
+  ipiv   = (blasint *)args -> c;
+
+  info = 0;
+
+  for (j = 0; j < n; j++) {
+
+    aj   = a + j * lda;
+    kmax = MIN(j, m);
+
+    /* unit lower triangular solve for the part above the diagonal */
+    for (k = 0; k < kmax; k++) {
+      t0 = aj[k];
+      a0 = a + k * lda;
+      for (i = k + 1; i < kmax; i++) aj[i] -= t0 * a0[i];
+    }
+
+    if (j >= m) continue;
+
+    for (k = 0; k + 3 < j; k += 4) {
+      a0 = a + (k + 0) * lda;
+      a1 = a + (k + 1) * lda;
+      a2 = a + (k + 2) * lda;
+      a3 = a + (k + 3) * lda;
+      t0 = aj[k + 0];
+      t1 = aj[k + 1];
+      t2 = aj[k + 2];
+      t3 = aj[k + 3];
+      for (i = j; i < m; i++)
+	aj[i] -= t0 * a0[i] + t1 * a1[i] + t2 * a2[i] + t3 * a3[i];
+    }
+
+    for (; k < j; k++) {
+      a0 = a + k * lda;
+      t0 = aj[k];
+      for (i = j; i < m; i++) aj[i] -= t0 * a0[i];
+    }
+
+    jp = j + IAMAX_K(m - j, aj + j, 1);
+    if (jp > m) jp = m;
+    ipiv[j] = jp;
+    jp--;
+
+    temp = aj[jp];
+
+    if (temp != ZERO) {
+
+      if (jp != j) {
+	for (k = 0; k < n; k++) {
+	  t0 = a[j  + k * lda];
+	  a[j  + k * lda] = a[jp + k * lda];
+	  a[jp + k * lda] = t0;
+	}
+      }
+
+      temp = ONE / temp;
+      for (i = j + 1; i < m; i++) aj[i] *= temp;
+
+    } else {
+      if (!info) info = j + 1;
+    }
+  }
+
+  return info;
+}
@@ -0,0 +1,234 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Tiled LU with partial pivoting on the task DAG.  The panel of   */
+/* tile column k is factored by one task over all the rows below,  */
+/* so ipiv keeps the LAPACK meaning; its row swaps are then applied */
+/* per tile column, right of the panel together with the triangular */
+/* solve, left of it as low priority tasks off the critical path.  */
+
+typedef struct {
+  FLOAT *a;
+  blasint *ipiv;
+  BLASLONG m, n, lda, nb, mt, nt, mn;
+  volatile BLASLONG info;
+  volatile BLASULONG lock;
+} tiled_t;
+
+#define TILE(t, i, j)	((t) -> a + ((i) * (t) -> nb + (j) * (t) -> nb * (t) -> lda) * COMPSIZE)
+#define HEIGHT(t, i)	MIN((t) -> nb, (t) -> m  - (i) * (t) -> nb)
+#define WIDTH(t, j)	MIN((t) -> nb, (t) -> n  - (j) * (t) -> nb)
+#define PANEL(t, k)	MIN((t) -> nb, (t) -> mn - (k) * (t) -> nb)
+
+/* Row swaps of panel k on the columns of tile j, then for j right */
+/* of the panel the solve with its unit lower triangle              */
+static void swap_trsm(tiled_t *t, BLASLONG j, BLASLONG k, BLASLONG col, BLASLONG ncol, void *sa, void *sb){
+
+  blas_arg_t args;
+  BLASLONG kb = PANEL(t, k);
+
+  LASWP_PLUS(ncol, k * t -> nb + 1, k * t -> nb + kb, ZERO,
+#ifdef COMPLEX
+	     ZERO,
+#endif
+	     t -> a + col * t -> lda * COMPSIZE, t -> lda, NULL, 0, t -> ipiv, 1);
+
+  if (j < k) return;
+
+  args.a    = TILE(t, k, k);
+  args.b    = t -> a + (k * t -> nb + col * t -> lda) * COMPSIZE;
+  args.m    = kb;
+  args.n    = ncol;
+  args.lda  = t -> lda;
+  args.ldb  = t -> lda;
+  args.beta = NULL;
+
+  TRSM_LNLU(&args, NULL, NULL, sa, sb, 0);
+}
+
+static int panel_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+  BLASLONG range_n[2], kb;
+  blasint info;
+
+  kb = PANEL(t, k);
+
+  args.m   = t -> m;
+  args.n   = t -> n;
+  args.a   = t -> a;
+  args.lda = t -> lda;
+  args.c   = t -> ipiv;
+
+  range_n[0] = k * t -> nb;
+  range_n[1] = k * t -> nb + kb;
+
+  info = GETRF_SINGLE(&args, NULL, range_n, sa, sb, 0);
+
+  if (info) {
+    blas_lock(&t -> lock);
+    if ((t -> info == 0) || (k * t -> nb + info < t -> info)) t -> info = k * t -> nb + info;
+    blas_unlock(&t -> lock);
+  }
+
+  /* m < n leaves columns of the last tile right of the last panel */
+  if (WIDTH(t, k) > kb) swap_trsm(t, k, k, k * t -> nb + kb, WIDTH(t, k) - kb, sa, sb);
+
+  return 0;
+}
+
+static int swap_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+
+  swap_trsm(t, j, k, j * t -> nb, WIDTH(t, j), sa, sb);
+
+  return 0;
+}
+
+static int update_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+  FLOAT alpha[2] = { -ONE, ZERO};
+
+  args.a     = TILE(t, i, k);
+  args.b     = TILE(t, k, j);
+  args.c     = TILE(t, i, j);
+  args.m     = HEIGHT(t, i);
+  args.n     = WIDTH(t, j);
+  args.k     = PANEL(t, k);
+  args.lda   = t -> lda;
+  args.ldb   = t -> lda;
+  args.ldc   = t -> lda;
+  args.alpha = alpha;
+  args.beta  = NULL;
+
+  GEMM_NN(&args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  tiled_t t;
+  blas_dag_t *dag;
+  BLASLONG i, j, k, kt, in[2], *out;
+  int mode, err;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  if (range_n) return GETRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  t.m    = args -> m;
+  t.n    = args -> n;
+  t.mn   = MIN(t.m, t.n);
+  t.a    = (FLOAT *)args -> a;
+  t.lda  = args -> lda;
+  t.ipiv = (blasint *)args -> c;
+  t.info = 0;
+  t.lock = 0;
+
+  t.nb = blas_dag_blocking(t.mn, GEMM_Q, GEMM_UNROLL_N, 2, args -> nthreads);
+  t.mt = (t.m  + t.nb - 1) / t.nb;
+  t.nt = (t.n  + t.nb - 1) / t.nb;
+  kt   = (t.mn + t.nb - 1) / t.nb;
+
+  if ((args -> nthreads == 1) || (kt < 2)) return GETRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  out = (BLASLONG *)malloc(t.mt * sizeof(BLASLONG));
+  dag = blas_dag_create(&t, t.mt * t.nt);
+
+  if ((out == NULL) || (dag == NULL)) {
+    free(out);
+    blas_dag_destroy(dag);
+    return GETRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+  }
+
+  /* Tiles (k.., j) make one handle set : the swaps touch all of them */
+  err = 0;
+  for (k = 0; (k < kt) && !err; k++) {
+    in[0] = k * t.nt + k;
+
+    for (i = k; i < t.mt; i++) out[i - k] = i * t.nt + k;
+    err |= blas_dag_insert(dag, panel_task, k, k, k, 3 * (t.nt - k) + 2, NULL, 0, out, t.mt - k);
+
+    for (j = k + 1; j < t.nt; j++) {
+      for (i = k; i < t.mt; i++) out[i - k] = i * t.nt + j;
+      err |= blas_dag_insert(dag, swap_task, k, j, k, 3 * (t.nt - j) + 1, in, 1, out, t.mt - k);
+    }
+
+    for (j = 0; j < k; j++) {
+      for (i = k; i < t.mt; i++) out[i - k] = i * t.nt + j;
+      err |= blas_dag_insert(dag, swap_task, k, j, k, 0, in, 1, out, t.mt - k);
+    }
+
+    for (j = k + 1; j < t.nt; j++) {
+      for (i = k + 1; i < t.mt; i++) {
+	in[0]  = i * t.nt + k;
+	in[1]  = k * t.nt + j;
+	out[0] = i * t.nt + j;
+	err |= blas_dag_insert(dag, update_task, i, j, k, 3 * (t.nt - j), in, 2, out, 1);
+      }
+    }
+  }
+
+  if (!err) err = blas_dag_execute(dag, mode, args -> nthreads, sa, sb);
+
+  blas_dag_destroy(dag);
+  free(out);
+
+  if (err) return GETRF_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  return t.info;
+}
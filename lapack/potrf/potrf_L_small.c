@@ -0,0 +1,96 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+#ifndef SQRT
+#define SQRT(x)	sqrt(x)
+#endif
+
+/* Left looking Cholesky for matrices that stay in L1 : each column  */
+/* takes its update from four earlier columns at a time, so a column */
+/* is loaded and stored once per four.  No buffer is used.           */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda;
+  BLASLONG i, j, k;
+  FLOAT *a, *aj, *a0, *a1, *a2, *a3;
+  FLOAT t0, t1, t2, t3, ajj;
+
+  n      = args -> n;
+  a      = (FLOAT *)args -> a;
+  lda    = args -> lda;
+
+  if (range_n) {
+    n      = range_n[1] - range_n[0];
+    a     += range_n[0] * (lda + 1);
+  }
+
+  for (j = 0; j < n; j++) {
+
+    aj = a + j * lda;
+
+    for (k = 0; k + 3 < j; k += 4) {
+      a0 = a + (k + 0) * lda;
+      a1 = a + (k + 1) * lda;
+      a2 = a + (k + 2) * lda;
+      a3 = a + (k + 3) * lda;
+      t0 = a0[j];
+      t1 = a1[j];
+      t2 = a2[j];
+      t3 = a3[j];
+      for (i = j; i < n; i++)
+	aj[i] -= t0 * a0[i] + t1 * a1[i] + t2 * a2[i] + t3 * a3[i];
+    }
+
+    for (; k < j; k++) {
+      a0 = a + k * lda;
+      t0 = a0[j];
+      for (i = j; i < n; i++) aj[i] -= t0 * a0[i];
+    }
+
+    ajj = aj[j];
+    if (ajj <= ZERO) return j + 1;
+
+    ajj = SQRT(ajj);
+    aj[j] = ajj;
+
+    ajj = ONE / ajj;
+    for (i = j + 1; i < n; i++) aj[i] *= ajj;
+  }
+
+  return 0;
+}
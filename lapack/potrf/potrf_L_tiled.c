@@ -0,0 +1,197 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Tiled Cholesky, A = L L^H, on the task DAG.  Tile (i, j) of the */
+/* lower triangle is one handle; the tasks are the right-looking   */
+/* steps of potrf_L_parallel.c, each on a single tile.             */
+
+typedef struct {
+  FLOAT *a;
+  BLASLONG n, lda, nb, nt;
+  volatile BLASLONG info;
+  volatile BLASULONG lock;
+} tiled_t;
+
+#define TILE(t, i, j)	((t) -> a + ((i) * (t) -> nb + (j) * (t) -> nb * (t) -> lda) * COMPSIZE)
+#define TSIZE(t, i)	MIN((t) -> nb, (t) -> n - (i) * (t) -> nb)
+
+static int potrf_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+  BLASLONG info;
+
+  if (t -> info) return 0;
+
+  args.a   = TILE(t, k, k);
+  args.m   = TSIZE(t, k);
+  args.n   = TSIZE(t, k);
+  args.lda = t -> lda;
+
+  info = POTRF_L_SINGLE(&args, NULL, NULL, sa, sb, 0);
+
+  if (info) {
+    blas_lock(&t -> lock);
+    if ((t -> info == 0) || (k * t -> nb + info < t -> info)) t -> info = k * t -> nb + info;
+    blas_unlock(&t -> lock);
+  }
+
+  return 0;
+}
+
+static int trsm_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+
+  if (t -> info) return 0;
+
+  args.a    = TILE(t, k, k);
+  args.b    = TILE(t, i, k);
+  args.m    = TSIZE(t, i);
+  args.n    = TSIZE(t, k);
+  args.lda  = t -> lda;
+  args.ldb  = t -> lda;
+  args.beta = NULL;
+
+  TRSM_RCLN(&args, NULL, NULL, sa, sb, 0);
+
+  return 0;
+}
+
+static int update_task(void *ctx, BLASLONG i, BLASLONG j, BLASLONG k, void *sa, void *sb){
+
+  tiled_t *t = (tiled_t *)ctx;
+  blas_arg_t args;
+  FLOAT alpha[2] = { -ONE, ZERO};
+
+  if (t -> info) return 0;
+
+  args.a     = TILE(t, i, k);
+  args.b     = TILE(t, j, k);
+  args.c     = TILE(t, i, j);
+  args.m     = TSIZE(t, i);
+  args.n     = TSIZE(t, j);
+  args.k     = TSIZE(t, k);
+  args.lda   = t -> lda;
+  args.ldb   = t -> lda;
+  args.ldc   = t -> lda;
+  args.alpha = alpha;
+  args.beta  = NULL;
+
+  if (i == j) {
+    HERK_LN(&args, NULL, NULL, sa, sb, 0);
+  } else {
+    GEMM_NC(&args, NULL, NULL, sa, sb, 0);
+  }
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  tiled_t t;
+  blas_dag_t *dag;
+  BLASLONG i, j, k, nt, in[2], out;
+  int mode, err;
+
+#ifndef COMPLEX
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+#else
+#ifdef XDOUBLE
+  mode  =  BLAS_XDOUBLE | BLAS_COMPLEX;
+#elif defined(DOUBLE)
+  mode  =  BLAS_DOUBLE  | BLAS_COMPLEX;
+#else
+  mode  =  BLAS_SINGLE  | BLAS_COMPLEX;
+#endif
+#endif
+
+  t.n    = args -> n;
+  t.a    = (FLOAT *)args -> a;
+  t.lda  = args -> lda;
+  t.info = 0;
+  t.lock = 0;
+
+  if (range_n) {
+    t.n  = range_n[1] - range_n[0];
+    t.a += range_n[0] * (t.lda + 1) * COMPSIZE;
+  }
+
+  t.nb = blas_dag_blocking(t.n, GEMM_Q, GEMM_UNROLL_N, 2, args -> nthreads);
+  t.nt = nt = (t.n + t.nb - 1) / t.nb;
+
+  if ((args -> nthreads == 1) || (nt < 2)) return POTRF_L_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  dag = blas_dag_create(&t, nt * nt);
+  if (dag == NULL) return POTRF_L_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  /* the panel of column k outranks the updates of the columns after it */
+  err = 0;
+  for (k = 0; (k < nt) && !err; k++) {
+    out = k * nt + k;
+    err |= blas_dag_insert(dag, potrf_task, k, k, k, 3 * (nt - k) + 2, NULL, 0, &out, 1);
+
+    in[0] = k * nt + k;
+    for (i = k + 1; i < nt; i++) {
+      out = i * nt + k;
+      err |= blas_dag_insert(dag, trsm_task, i, k, k, 3 * (nt - k) + 1, in, 1, &out, 1);
+    }
+
+    for (j = k + 1; j < nt; j++) {
+      in[1] = j * nt + k;
+      for (i = j; i < nt; i++) {
+	in[0] = i * nt + k;
+	out   = i * nt + j;
+	err |= blas_dag_insert(dag, update_task, i, j, k, 3 * (nt - j), in, (i == j) ? 1 : 2, &out, 1);
+      }
+    }
+  }
+
+  if (!err) err = blas_dag_execute(dag, mode, args -> nthreads, sa, sb);
+
+  blas_dag_destroy(dag);
+
+  if (err) return POTRF_L_PARALLEL(args, range_m, range_n, sa, sb, 0);
+
+  return t.info;
+}
@@ -0,0 +1,97 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include "common.h"
+
+#ifndef SQRT
+#define SQRT(x)	sqrt(x)
+#endif
+
+/* Column j of U solves U(0:j,0:j)^T u = a(0:j,j), one dot product per */
+/* entry over contiguous columns.  Meant for matrices that stay in L1; */
+/* no buffer is used.                                                  */
+
+static inline FLOAT dot_small(BLASLONG n, FLOAT *x, FLOAT *y) {
+
+  FLOAT s0 = ZERO, s1 = ZERO, s2 = ZERO, s3 = ZERO;
+  BLASLONG i;
+
+  for (i = 0; i + 3 < n; i += 4) {
+    s0 += x[i + 0] * y[i + 0];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for (; i < n; i++) s0 += x[i] * y[i];
+
+  return (s0 + s1) + (s2 + s3);
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG myid) {
+
+  BLASLONG n, lda;
+  BLASLONG i, j;
+  FLOAT *a, *ai, *aj;
+  FLOAT ajj;
+
+  n      = args -> n;
+  a      = (FLOAT *)args -> a;
+  lda    = args -> lda;
+
+  if (range_n) {
+    n      = range_n[1] - range_n[0];
+    a     += range_n[0] * (lda + 1);
+  }
+
+  for (j = 0; j < n; j++) {
+
+    aj = a + j * lda;
+
+    for (i = 0; i < j; i++) {
+      ai = a + i * lda;
+      aj[i] = (aj[i] - dot_small(i, ai, aj)) / ai[i];
+    }
+
+    ajj = aj[j] - dot_small(j, aj, aj);
+    if (ajj <= ZERO) {
+      aj[j] = ajj;
+      return j + 1;
+    }
+
+    aj[j] = SQRT(ajj);
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+static int inner_thread(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n,
+			 FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+#ifdef UPPER
+  TRSM_LTUN (args, range_m, range_n, sa, sb, 0);
+  TRSM_LNUN (args, range_m, range_n, sa, sb, 0);
+#else
+  TRSM_LNLN (args, range_m, range_n, sa, sb, 0);
+  TRSM_LTLN (args, range_m, range_n, sa, sb, 0);
+#endif
+
+  return 0;
+}
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  int mode;
+
+  if (args -> n == 1){
+#ifdef UPPER
+    TRSV_TUN (args -> m, args -> a, args -> lda, args -> b, 1, sb);
+    TRSV_NUN (args -> m, args -> a, args -> lda, args -> b, 1, sb);
+#else
+    TRSV_NLN (args -> m, args -> a, args -> lda, args -> b, 1, sb);
+    TRSV_TLN (args -> m, args -> a, args -> lda, args -> b, 1, sb);
+#endif
+  } else {
+#ifdef XDOUBLE
+    mode  =  BLAS_XDOUBLE | BLAS_REAL;
+#elif defined(DOUBLE)
+    mode  =  BLAS_DOUBLE  | BLAS_REAL;
+#else
+    mode  =  BLAS_SINGLE  | BLAS_REAL;
+#endif
+
+    gemm_thread_n(mode, args, NULL, NULL, inner_thread, sa, sb,  args -> nthreads);
+  }
+
+  return 0;
+}
@@ -0,0 +1,91 @@
+/***************************************************************************
+Copyright (c) 2011-2019,                              The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+
+   3. Neither the name of the OpenBLAS project nor the names of
+      its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE OPENBLAS PROJECT OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*****************************************************************************/
+
+#include <stdio.h>
+#include "common.h"
+
+/* Triangular solves with the Cholesky factor of a matrix that stays */
+/* in L1, one right hand side at a time.  No buffer is used.         */
+
+blasint CNAME(blas_arg_t *args, BLASLONG *range_m, BLASLONG *range_n, FLOAT *sa, FLOAT *sb, BLASLONG mypos) {
+
+  BLASLONG m, n, lda, ldb;
+  BLASLONG i, j, k;
+  FLOAT *a, *b, *ak, *bj;
+  FLOAT temp;
+
+  m   = args -> m;
+  n   = args -> n;
+  a   = (FLOAT *)args -> a;
+  lda = args -> lda;
+  b   = (FLOAT *)args -> b;
+  ldb = args -> ldb;
+
+  for (j = 0; j < n; j++) {
+    bj = b + j * ldb;
+
+#ifdef UPPER
+    /* U^T y = b, then U x = y */
+    for (k = 0; k < m; k++) {
+      ak   = a + k * lda;
+      temp = bj[k];
+      for (i = 0; i < k; i++) temp -= ak[i] * bj[i];
+      bj[k] = temp / ak[k];
+    }
+
+    for (k = m - 1; k >= 0; k--) {
+      ak    = a + k * lda;
+      bj[k] /= ak[k];
+      temp  = bj[k];
+      for (i = 0; i < k; i++) bj[i] -= temp * ak[i];
+    }
+#else
+    /* L y = b, then L^T x = y */
+    for (k = 0; k < m; k++) {
+      ak    = a + k * lda;
+      bj[k] /= ak[k];
+      temp  = bj[k];
+      for (i = k + 1; i < m; i++) bj[i] -= temp * ak[i];
+    }
+
+    for (k = m - 1; k >= 0; k--) {
+      ak   = a + k * lda;
+      temp = bj[k];
+      for (i = k + 1; i < m; i++) temp -= ak[i] * bj[i];
+      bj[k] = temp / ak[k];
+    }
+#endif
+  }
+
+  return 0;
+}
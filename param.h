@@ -1509,6 +1509,13 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SWITCH_RATIO	32
 #define GEMM_PREFERED_SIZE	16
+#define SGEMM_DEFAULT_SMALL_THRESHOLD	32
+#define DGEMM_DEFAULT_SMALL_THRESHOLD	32
+#define LAPACK_DEFAULT_SMALL_THRESHOLD	64
+#define POTRF_DEFAULT_THREAD_THRESHOLD	192
+#define GETRF_DEFAULT_THREAD_THRESHOLD	160
+#define LAUUM_DEFAULT_THREAD_THRESHOLD	256
+#define TRTRI_DEFAULT_THREAD_THRESHOLD	256
 
 #ifdef ARCH_X86
 
@@ -1629,6 +1636,13 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SWITCH_RATIO	32
 #define GEMM_PREFERED_SIZE	32
+#define SGEMM_DEFAULT_SMALL_THRESHOLD	32
+#define DGEMM_DEFAULT_SMALL_THRESHOLD	32
+#define LAPACK_DEFAULT_SMALL_THRESHOLD	64
+#define POTRF_DEFAULT_THREAD_THRESHOLD	192
+#define GETRF_DEFAULT_THREAD_THRESHOLD	160
+#define LAUUM_DEFAULT_THREAD_THRESHOLD	256
+#define TRTRI_DEFAULT_THREAD_THRESHOLD	256
 #define USE_SGEMM_KERNEL_DIRECT 1
 
 #ifdef ARCH_X86
@@ -3029,6 +3043,36 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define XGEMM_DEFAULT_UNROLL_N 2
 #endif
 
+#ifndef SGEMM_DEFAULT_SMALL_THRESHOLD
+#define SGEMM_DEFAULT_SMALL_THRESHOLD 8
+#endif
+
+#ifndef DGEMM_DEFAULT_SMALL_THRESHOLD
+#define DGEMM_DEFAULT_SMALL_THRESHOLD 8
+#endif
+
+/* Native LAPACK : n at or below LAPACK_SMALL_THRESHOLD uses the unblocked */
+/* kernels without a buffer, n below *_THREAD_THRESHOLD runs on one thread */
+#ifndef LAPACK_DEFAULT_SMALL_THRESHOLD
+#define LAPACK_DEFAULT_SMALL_THRESHOLD 32
+#endif
+
+#ifndef POTRF_DEFAULT_THREAD_THRESHOLD
+#define POTRF_DEFAULT_THREAD_THRESHOLD 128
+#endif
+
+#ifndef GETRF_DEFAULT_THREAD_THRESHOLD
+#define GETRF_DEFAULT_THREAD_THRESHOLD 128
+#endif
+
+#ifndef LAUUM_DEFAULT_THREAD_THRESHOLD
+#define LAUUM_DEFAULT_THREAD_THRESHOLD 128
+#endif
+
+#ifndef TRTRI_DEFAULT_THREAD_THRESHOLD
+#define TRTRI_DEFAULT_THREAD_THRESHOLD 128
+#endif
+
 #ifndef HAVE_SSE2
 #define SHUFPD_0	shufps	$0x44,
 #define SHUFPD_1	shufps	$0x4e,
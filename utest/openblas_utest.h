@@ -42,4 +42,14 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define SINGLE_EPS 1e-04
 #define DOUBLE_EPS 1e-13
+
+/* utest_helper.c */
+void utest_fill(double *x, blasint n, int seed);
+void utest_naive_dgemm(int transa, int transb, blasint m, blasint n, blasint k,
+		       double alpha, double *a, blasint lda, double *b, blasint ldb,
+		       double beta, double *c, blasint ldc);
+void utest_compare_dmatrix(blasint m, blasint n, double *r, blasint ldr,
+			   double *c, blasint ldc, double tol);
+void utest_check_dgemm(int transa, int transb, blasint m, blasint n, blasint k,
+		       double alpha, double beta);
 #endif
@@ -0,0 +1,135 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <cblas.h>
+#include "openblas_utest.h"
+
+CTEST(async, queues_in_order)
+{
+	blasint n = 200, i;
+	double *a, *b, *c, *l, *x, *y, *rc, *ry;
+	openblas_queue_t *q1, *q2;
+	openblas_request_t *gemm, *trsm, *gemv;
+
+	a  = (double *)malloc(n * n * sizeof(double));
+	b  = (double *)malloc(n * n * sizeof(double));
+	c  = (double *)malloc(n * n * sizeof(double));
+	l  = (double *)malloc(n * n * sizeof(double));
+	rc = (double *)malloc(n * n * sizeof(double));
+	x  = (double *)malloc(n * sizeof(double));
+	y  = (double *)malloc(n * sizeof(double));
+	ry = (double *)malloc(n * sizeof(double));
+	utest_fill(a, n * n, 1);
+	utest_fill(b, n * n, 2);
+	utest_fill(l, n * n, 3);
+	for (i = 0; i < n; i++) l[i + i * n] = n;
+	utest_fill(x, n, 4);
+	utest_fill(y, n, 5);
+	memcpy(ry, y, n * sizeof(double));
+
+	/* C = A * B, then L^-1 C : the trsm has to see the gemm result */
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+		    1.0, a, n, b, n, 0.0, rc, n);
+	cblas_dtrsm(CblasColMajor, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit,
+		    n, n, 1.0, l, n, rc, n);
+	cblas_dgemv(CblasColMajor, CblasTrans, n, n, 2.0, a, n, x, 1, 0.5, ry, 1);
+
+	q1 = openblas_queue_create(2);
+	q2 = openblas_queue_create(2);
+	ASSERT_NOT_NULL(q1);
+	ASSERT_NOT_NULL(q2);
+
+	gemm = cblas_dgemm_async(q1, CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+				 1.0, a, n, b, n, 0.0, c, n);
+	trsm = cblas_dtrsm_async(q1, CblasColMajor, CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit,
+				 n, n, 1.0, l, n, c, n);
+	gemv = cblas_dgemv_async(q2, CblasColMajor, CblasTrans, n, n, 2.0, a, n, x, 1, 0.5, y, 1);
+	ASSERT_NOT_NULL(gemm);
+	ASSERT_NOT_NULL(trsm);
+	ASSERT_NOT_NULL(gemv);
+
+	ASSERT_EQUAL(0, openblas_request_wait(trsm));
+	ASSERT_EQUAL(1, openblas_request_test(gemm));
+	ASSERT_EQUAL(0, openblas_queue_synchronize(q2));
+	ASSERT_EQUAL(1, openblas_request_test(gemv));
+
+	for (i = 0; i < n * n; i++)
+		ASSERT_DBL_NEAR_TOL(rc[i], c[i], 1e-9);
+	for (i = 0; i < n; i++)
+		ASSERT_DBL_NEAR_TOL(ry[i], y[i], 1e-9);
+
+	openblas_request_free(gemm);
+	openblas_request_free(trsm);
+	openblas_request_free(gemv);
+	openblas_queue_destroy(q1);
+	openblas_queue_destroy(q2);
+
+	free(a); free(b); free(c); free(l); free(rc);
+	free(x); free(y); free(ry);
+}
+
+static void count_done(openblas_request_t *request, void *data)
+{
+	(void)request;
+	(*(int *)data) ++;
+}
+
+CTEST(async, callback_default_queue)
+{
+	blasint n = 64, i;
+	float a[64 * 64], c[64 * 64];
+	int calls = 0;
+	openblas_request_t *req;
+
+	for (i = 0; i < n * n; i++) a[i] = (float)(i % 5) - 2.0f;
+
+	req = cblas_sgemm_async(NULL, CblasRowMajor, CblasNoTrans, CblasTrans, n, n, n,
+				1.0f, a, n, a, n, 0.0f, c, n);
+	ASSERT_NOT_NULL(req);
+	openblas_request_set_callback(req, count_done, &calls);
+	openblas_request_wait(req);
+	ASSERT_EQUAL(1, calls);
+
+	/* already finished : the callback runs in the caller */
+	openblas_request_set_callback(req, count_done, &calls);
+	ASSERT_EQUAL(2, calls);
+	openblas_request_free(req);
+
+	/* row i of A times itself */
+	for (i = 0; i < n; i++) {
+		float s = 0.0f;
+		blasint k;
+		for (k = 0; k < n; k++) s += a[i * n + k] * a[i * n + k];
+		ASSERT_DBL_NEAR_TOL(s, c[i * n + i], 1e-3);
+	}
+}
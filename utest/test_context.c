@@ -0,0 +1,221 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include <cblas.h>
+#include "openblas_utest.h"
+
+CTEST(context, attach_detach)
+{
+	openblas_context_t *ctx, *inner, *prev;
+	int cpus[2] = {0, 0};
+
+	ctx = openblas_context_create(2);
+	ASSERT_NOT_NULL(ctx);
+	/* capped at the thread count the library was built for */
+	ASSERT_TRUE(openblas_context_get_num_threads(ctx) >= 1);
+	ASSERT_TRUE(openblas_context_get_num_threads(ctx) <= 2);
+
+	openblas_context_set_num_threads(ctx, 0);
+	ASSERT_EQUAL(1, openblas_context_get_num_threads(ctx));
+	ASSERT_EQUAL(0, openblas_context_set_cpus(ctx, cpus, 2));
+	ASSERT_EQUAL(-1, openblas_context_set_cpus(ctx, NULL, 2));
+
+	prev = openblas_set_context(ctx);
+	ASSERT_NULL(prev);
+	ASSERT_TRUE(openblas_get_context() == ctx);
+
+	inner = openblas_context_create(1);
+	prev = openblas_set_context(inner);
+	ASSERT_TRUE(prev == ctx);
+	ASSERT_TRUE(openblas_set_context(prev) == inner);
+	openblas_context_destroy(inner);
+
+	openblas_context_destroy(ctx);
+	ASSERT_NULL(openblas_get_context());
+}
+
+CTEST(context, dgemm_in_context)
+{
+	blasint n = 257, i;
+	double *a, *b, *c, *r;
+	int cpus[1] = {0};
+	openblas_context_t *ctx;
+
+	a = (double *)malloc(n * n * sizeof(double));
+	b = (double *)malloc(n * n * sizeof(double));
+	c = (double *)malloc(n * n * sizeof(double));
+	r = (double *)malloc(n * n * sizeof(double));
+	for (i = 0; i < n * n; i++) {
+		a[i] = (double)((i * 7) % 17) / 8.0 - 1.0;
+		b[i] = (double)((i * 5) % 13) / 8.0 - 0.5;
+	}
+
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+		    1.0, a, n, b, n, 0.0, r, n);
+
+	ctx = openblas_context_create(4);
+	openblas_context_set_cpus(ctx, cpus, 1);
+	openblas_set_context(ctx);
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, n, n, n,
+		    1.0, a, n, b, n, 0.0, c, n);
+	openblas_set_context(NULL);
+	openblas_context_destroy(ctx);
+
+	for (i = 0; i < n * n; i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], 1e-9);
+
+	free(a); free(b); free(c); free(r);
+}
+
+/* The model gives a tiny GEMM one thread and a large one every thread */
+/* of the context, never fewer for a larger problem in between         */
+CTEST(context, model_thread_count)
+{
+	blasint sizes[] = {20, 40, 80, 160, 320, 640, 1000};
+	blasint k = 200, s, i;
+	int threads = openblas_get_num_threads();
+	int nmax, last = 1;
+	double *a, *b, *c;
+	openblas_context_t *ctx;
+
+	a = (double *)malloc(1000 * k * sizeof(double));
+	b = (double *)malloc(k * 1000 * sizeof(double));
+	c = (double *)malloc(1000 * 1000 * sizeof(double));
+	utest_fill(a, 1000 * k, 1);
+	utest_fill(b, k * 1000, 2);
+
+	/* a pool of at least four threads behind the context */
+	openblas_set_num_threads(4);
+	ctx = openblas_context_create(4);
+	nmax = openblas_context_get_num_threads(ctx);
+	openblas_set_context(ctx);
+
+	for (s = 0; s < (blasint)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+		i = sizes[s];
+		cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, i, i, k,
+			    1.0, a, i, b, k, 0.0, c, i);
+		if (s == 0) ASSERT_EQUAL(1, openblas_get_last_num_threads());
+		ASSERT_TRUE(openblas_get_last_num_threads() >= last);
+		last = openblas_get_last_num_threads();
+	}
+	ASSERT_EQUAL(nmax, last);
+
+	openblas_context_set_num_threads(ctx, 1);
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, 1000, 1000, k,
+		    1.0, a, 1000, b, k, 0.0, c, 1000);
+	ASSERT_EQUAL(1, openblas_get_last_num_threads());
+
+	openblas_set_context(NULL);
+	openblas_context_destroy(ctx);
+	openblas_set_num_threads(threads);
+	free(a); free(b); free(c);
+}
+
+#ifndef _WIN32
+struct overlap_job {
+	openblas_context_t *ctx;
+	blasint n;
+	double *a, *b, *c;
+	volatile int started, done;
+	int threads;
+};
+
+static void *overlap_run(void *arg)
+{
+	struct overlap_job *job = (struct overlap_job *)arg;
+
+	openblas_set_context(job->ctx);
+	job->started = 1;
+	cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, job->n, job->n, job->n,
+		    1.0, job->a, job->n, job->b, job->n, 0.0, job->c, job->n);
+	job->threads = openblas_get_last_num_threads();
+	job->done = 1;
+	openblas_set_context(NULL);
+
+	return NULL;
+}
+
+/* Contexts on disjoint pool threads do not wait for each other : a  */
+/* small threaded GEMM finishes while a large one, started first in */
+/* another context, is still running                                 */
+CTEST(context, disjoint_cpus_overlap)
+{
+	struct overlap_job big = {NULL, 2000}, small = {NULL, 256};
+	int threads = openblas_get_num_threads();
+	int cpu0 = 0, cpu1 = 1;
+	pthread_t thread;
+
+	/* the pthreads server with two pool threads besides the callers */
+	if (openblas_get_parallel() != 1) return;
+	openblas_set_num_threads(3);
+	if (openblas_get_num_threads() < 3) {
+		openblas_set_num_threads(threads);
+		return;
+	}
+
+	big.a = (double *)malloc(big.n * big.n * sizeof(double));
+	big.b = (double *)malloc(big.n * big.n * sizeof(double));
+	big.c = (double *)malloc(big.n * big.n * sizeof(double));
+	utest_fill(big.a, big.n * big.n, 1);
+	utest_fill(big.b, big.n * big.n, 2);
+	small.a = big.a;
+	small.b = big.b;
+	small.c = (double *)malloc(small.n * small.n * sizeof(double));
+
+	big.ctx = openblas_context_create(2);
+	small.ctx = openblas_context_create(2);
+	ASSERT_EQUAL(0, openblas_context_set_cpus(big.ctx, &cpu0, 1));
+	ASSERT_EQUAL(0, openblas_context_set_cpus(small.ctx, &cpu1, 1));
+
+	ASSERT_EQUAL(0, pthread_create(&thread, NULL, overlap_run, &big));
+	while (!big.started) usleep(1000);
+	usleep(20 * 1000);
+
+	overlap_run(&small);
+	ASSERT_EQUAL(2, small.threads);
+	ASSERT_FALSE(big.done);
+
+	pthread_join(thread, NULL);
+	ASSERT_EQUAL(2, big.threads);
+
+	openblas_context_destroy(big.ctx);
+	openblas_context_destroy(small.ctx);
+	openblas_set_num_threads(threads);
+	free(big.a); free(big.b); free(big.c); free(small.c);
+}
+#endif
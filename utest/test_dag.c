@@ -0,0 +1,240 @@
+/*****************************************************************************
+Copyright (c) 2011-2016, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+void openblas_set_tiled_lapack(int);
+int openblas_get_tiled_lapack(void);
+
+/* The task-DAG drivers are forced on 4 threads with sizes that give */
+/* several tiles and ragged edges; the factors must rebuild A.  The  */
+/* utest_fill data repeat with a short period, so the matrices get a */
+/* dominant diagonal (potrf) or anti-diagonal (getrf, where it also  */
+/* moves every pivot) to be regular.                                 */
+
+static void tiled_on(int *threads, int *mode)
+{
+	*threads = openblas_get_num_threads();
+	*mode = openblas_get_tiled_lapack();
+	openblas_set_num_threads(4);
+	openblas_set_tiled_lapack(2);
+}
+
+static void tiled_off(int threads, int mode)
+{
+	openblas_set_tiled_lapack(mode);
+	openblas_set_num_threads(threads);
+}
+
+/* max |A - L L^T| or |A - U^T U| */
+static double check_dpotrf(char uplo, blasint n)
+{
+	blasint lda = n + 5, info, i, j, l;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double err = 0.0, s;
+
+	utest_fill(a0, lda * n, 1);
+	/* symmetric, diagonally dominant */
+	for (j = 0; j < n; j++)
+		for (i = 0; i < j; i++) a0[i + j * lda] = a0[j + i * lda];
+	for (i = 0; i < n; i++) a0[i + i * lda] += n;
+	for (i = 0; i < lda * n; i++) a[i] = a0[i];
+
+	BLASFUNC(dpotrf)(&uplo, &n, a, &lda, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = j; i < n; i++) {
+			s = 0.0;
+			for (l = 0; l <= j; l++)
+				s += (uplo == 'L') ? a[i + l * lda] * a[j + l * lda] : a[l + i * lda] * a[l + j * lda];
+			err = fmax(err, fabs(s - a0[i + j * lda]) / n);
+		}
+
+	free(a0); free(a);
+	return err;
+}
+
+/* max |P A - L U| */
+static double check_dgetrf(blasint m, blasint n)
+{
+	blasint lda = m + 2, k = (m < n) ? m : n, info, i, j, l;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	blasint *ipiv = malloc(sizeof(blasint) * k);
+	double err = 0.0, s, t;
+
+	utest_fill(a0, lda * n, 2);
+	for (j = 0; j < k; j++) a0[(m - 1 - j) + j * lda] += 2 * m;
+	for (i = 0; i < lda * n; i++) a[i] = a0[i];
+
+	BLASFUNC(dgetrf)(&m, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (i = 0; i < k; i++)
+		for (j = 0; j < n; j++) {
+			t = a0[i + j * lda];
+			a0[i + j * lda] = a0[ipiv[i] - 1 + j * lda];
+			a0[ipiv[i] - 1 + j * lda] = t;
+		}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) {
+			s = 0.0;
+			for (l = 0; l <= i && l <= j && l < k; l++)
+				s += ((l == i) ? 1.0 : a[i + l * lda]) * a[l + j * lda];
+			err = fmax(err, fabs(s - a0[i + j * lda]));
+		}
+
+	free(ipiv); free(a0); free(a);
+	return err;
+}
+
+/* max |P A - L U| in complex */
+static double check_zgetrf(blasint m, blasint n)
+{
+	blasint lda = m + 1, k = (m < n) ? m : n, info, i, j, l;
+	double *a = malloc(sizeof(double) * 2 * lda * n);
+	double *a0 = malloc(sizeof(double) * 2 * lda * n);
+	blasint *ipiv = malloc(sizeof(blasint) * k);
+	double err = 0.0, sr, si, lr, li, t;
+
+	utest_fill(a0, 2 * lda * n, 3);
+	for (j = 0; j < k; j++) a0[2 * ((m - 1 - j) + j * lda)] += 2 * m;
+	for (i = 0; i < 2 * lda * n; i++) a[i] = a0[i];
+
+	BLASFUNC(zgetrf)(&m, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (i = 0; i < k; i++)
+		for (j = 0; j < n; j++)
+			for (l = 0; l < 2; l++) {
+				t = a0[2 * (i + j * lda) + l];
+				a0[2 * (i + j * lda) + l] = a0[2 * (ipiv[i] - 1 + j * lda) + l];
+				a0[2 * (ipiv[i] - 1 + j * lda) + l] = t;
+			}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) {
+			sr = si = 0.0;
+			for (l = 0; l <= i && l <= j && l < k; l++) {
+				lr = (l == i) ? 1.0 : a[2 * (i + l * lda) + 0];
+				li = (l == i) ? 0.0 : a[2 * (i + l * lda) + 1];
+				sr += lr * a[2 * (l + j * lda) + 0] - li * a[2 * (l + j * lda) + 1];
+				si += lr * a[2 * (l + j * lda) + 1] + li * a[2 * (l + j * lda) + 0];
+			}
+			err = fmax(err, fabs(sr - a0[2 * (i + j * lda) + 0]));
+			err = fmax(err, fabs(si - a0[2 * (i + j * lda) + 1]));
+		}
+
+	free(ipiv); free(a0); free(a);
+	return err;
+}
+
+/* max |A - Q R|, Q applied to R with dormqr */
+static double check_dgeqrf(blasint m, blasint n)
+{
+	blasint lda = m + 3, k = (m < n) ? m : n, lwork = -1, info, i, j;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double *r = malloc(sizeof(double) * lda * n);
+	double *tau = malloc(sizeof(double) * k);
+	double query, *work, err = 0.0;
+	char left = 'L', notrans = 'N';
+
+	utest_fill(a0, lda * n, 4);
+	for (i = 0; i < lda * n; i++) a[i] = a0[i];
+
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, &query, &lwork, &info);
+	lwork = (blasint)query;
+	work = malloc(sizeof(double) * lwork);
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < lda; i++)
+			r[i + j * lda] = (i <= j && i < m) ? a[i + j * lda] : 0.0;
+
+	BLASFUNC(dormqr)(&left, &notrans, &m, &n, &k, a, &lda, tau, r, &lda, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++)
+			err = fmax(err, fabs(r[i + j * lda] - a0[i + j * lda]));
+
+	free(work); free(tau); free(r); free(a0); free(a);
+	return err;
+}
+
+CTEST(dag, dpotrf)
+{
+	int threads, mode;
+
+	tiled_on(&threads, &mode);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dpotrf('L', 333), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dpotrf('U', 333), DOUBLE_EPS * 100);
+	tiled_off(threads, mode);
+}
+
+CTEST(dag, dgetrf)
+{
+	int threads, mode;
+
+	tiled_on(&threads, &mode);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(301, 301), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(350, 190), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(190, 350), DOUBLE_EPS * 1000);
+	tiled_off(threads, mode);
+}
+
+CTEST(dag, zgetrf)
+{
+	int threads, mode;
+
+	tiled_on(&threads, &mode);
+	ASSERT_DBL_NEAR_TOL(0.0, check_zgetrf(211, 199), DOUBLE_EPS * 1000);
+	tiled_off(threads, mode);
+}
+
+CTEST(dag, dgeqrf)
+{
+	int threads, mode;
+
+	tiled_on(&threads, &mode);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(437, 351), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgeqrf(130, 600), DOUBLE_EPS * 1000);
+	tiled_off(threads, mode);
+}
@@ -33,6 +33,7 @@ USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <unistd.h>
 #include <cblas.h>
 #include "openblas_utest.h"
 
@@ -125,3 +126,81 @@ CTEST(fork, safety)
         ASSERT_EQUAL(0, WEXITSTATUS (child_status));
     }
 }
+
+void check_dgemm_async(openblas_queue_t *queue, double *a, double *b, double *result, double *expected, blasint n)
+{
+    openblas_request_t *req;
+    int i;
+    req = cblas_dgemm_async(queue, CblasColMajor, CblasTrans, CblasNoTrans, n, n, n,
+                            1.0, a, n, b, n, 0.0, result, n);
+    ASSERT_NOT_NULL(req);
+    ASSERT_EQUAL(0, openblas_request_wait(req));
+    openblas_request_free(req);
+    for(i = 0; i < n * n; ++i) {
+        ASSERT_DBL_NEAR_TOL(expected[i], result[i], DOUBLE_EPS);
+    }
+}
+
+CTEST(fork, async_default_queue)
+{
+    blasint n = 300;
+    int i;
+
+    double *a, *b, *c, *d;
+    size_t n_bytes;
+
+    openblas_queue_t *queue, *child_queue;
+    pid_t fork_pid;
+
+    n_bytes = sizeof(*a) * n * n;
+
+    a = xmalloc(n_bytes);
+    b = xmalloc(n_bytes);
+    c = xmalloc(n_bytes);
+    d = xmalloc(n_bytes);
+
+    for(i = 0; i < n * n; ++i) {
+        a[i] = 1;
+        b[i] = 1;
+    }
+
+    char trans1 = 'T';
+    char trans2 = 'N';
+    double zerod = 0, oned = 1;
+    BLASFUNC(dgemm)(&trans1, &trans2, &n, &n, &n, &oned, a, &n, b, &n, &zerod, c, &n);
+
+    // Start the dispatcher of the default queue, and hold the free pool
+    // threads in a queue of our own across the fork.
+    check_dgemm_async(NULL, a, b, d, c, n);
+    queue = openblas_queue_create(0);
+    ASSERT_NOT_NULL(queue);
+
+    fork_pid = fork();
+    if (fork_pid == -1) {
+        CTEST_ERR("Failed to fork process.");
+    } else if (fork_pid == 0) {
+        // No dispatcher survives the fork: the child needs a new default
+        // queue, and a new queue gets the pool threads back. A hang here
+        // ends in SIGALRM.
+        alarm(60);
+        check_dgemm_async(NULL, a, b, d, c, n);
+
+        child_queue = openblas_queue_create(0);
+        ASSERT_NOT_NULL(child_queue);
+        check_dgemm_async(child_queue, a, b, d, c, n);
+        openblas_queue_destroy(child_queue);
+        exit(0);
+    } else {
+        check_dgemm_async(NULL, a, b, d, c, n);
+        check_dgemm_async(queue, a, b, d, c, n);
+        // Wait for the child to finish and check the exit code.
+        int child_status = 0;
+        pid_t wait_pid = wait(&child_status);
+        ASSERT_EQUAL(wait_pid, fork_pid);
+        ASSERT_TRUE(WIFEXITED(child_status));
+        ASSERT_EQUAL(0, WEXITSTATUS (child_status));
+    }
+
+    openblas_queue_destroy(queue);
+    free(a); free(b); free(c); free(d);
+}
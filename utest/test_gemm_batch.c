@@ -0,0 +1,151 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+CTEST(gemm_batch, dgemm_batch_groups)
+{
+	enum CBLAS_TRANSPOSE transa[2] = {CblasNoTrans, CblasTrans};
+	enum CBLAS_TRANSPOSE transb[2] = {CblasTrans, CblasNoTrans};
+	blasint m[2] = {5, 16}, n[2] = {7, 3}, k[2] = {4, 9};
+	blasint lda[2] = {5, 9}, ldb[2] = {7, 9}, ldc[2] = {6, 16};
+	double alpha[2] = {1.5, -0.5}, beta[2] = {0.0, 2.0};
+	blasint group_size[2] = {3, 2};
+	double *a[5], *b[5], *c[5], *r[5];
+	blasint i, j, g;
+
+	for (i = 0, g = 0; g < 2; g++) {
+		for (j = 0; j < group_size[g]; j++, i++) {
+			a[i] = (double *)malloc(lda[g] * 16 * sizeof(double));
+			b[i] = (double *)malloc(ldb[g] * 16 * sizeof(double));
+			c[i] = (double *)malloc(ldc[g] * 16 * sizeof(double));
+			r[i] = (double *)malloc(ldc[g] * 16 * sizeof(double));
+			utest_fill(a[i], lda[g] * 16, i);
+			utest_fill(b[i], ldb[g] * 16, i + 5);
+			utest_fill(c[i], ldc[g] * 16, i + 9);
+			memcpy(r[i], c[i], ldc[g] * 16 * sizeof(double));
+			cblas_dgemm(CblasColMajor, transa[g], transb[g], m[g], n[g], k[g],
+				    alpha[g], a[i], lda[g], b[i], ldb[g], beta[g], r[i], ldc[g]);
+		}
+	}
+
+	cblas_dgemm_batch(CblasColMajor, transa, transb, m, n, k, alpha,
+			  (const double **)a, lda, (const double **)b, ldb, beta,
+			  c, ldc, 2, group_size);
+
+	for (i = 0, g = 0; g < 2; g++) {
+		for (j = 0; j < group_size[g]; j++, i++) {
+			blasint l;
+			for (l = 0; l < ldc[g] * n[g]; l++)
+				ASSERT_DBL_NEAR_TOL(r[i][l], c[i][l], DOUBLE_EPS);
+			free(a[i]); free(b[i]); free(c[i]); free(r[i]);
+		}
+	}
+}
+
+CTEST(gemm_batch, dgemm_batch_strided_rowmajor)
+{
+	blasint m = 6, n = 5, k = 7, count = 40;
+	blasint stridea = m * k, strideb = k * n, stridec = m * n;
+	double *a = (double *)malloc(stridea * count * sizeof(double));
+	double *b = (double *)malloc(strideb * count * sizeof(double));
+	double *c = (double *)malloc(stridec * count * sizeof(double));
+	double *r = (double *)malloc(stridec * count * sizeof(double));
+	blasint i;
+
+	utest_fill(a, stridea * count, 1);
+	utest_fill(b, strideb * count, 2);
+	utest_fill(c, stridec * count, 3);
+	memcpy(r, c, stridec * count * sizeof(double));
+
+	for (i = 0; i < count; i++)
+		cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+			    0.75, a + i * stridea, k, b + i * strideb, n, 1.0, r + i * stridec, n);
+
+	cblas_dgemm_batch_strided(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+				  0.75, a, k, stridea, b, n, strideb, 1.0, c, n, stridec, count);
+
+	for (i = 0; i < stridec * count; i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], DOUBLE_EPS);
+
+	free(a); free(b); free(c); free(r);
+}
+
+CTEST(gemm_batch, zgemm_batch_strided)
+{
+	blasint m = 4, n = 3, k = 5, count = 8;
+	blasint stridea = 2 * m * k, strideb = 2 * k * n, stridec = 2 * m * n;
+	double alpha[2] = {0.5, -1.0}, beta[2] = {1.0, 0.25};
+	double a[2 * 4 * 5 * 8], b[2 * 5 * 3 * 8], c[2 * 4 * 3 * 8], r[2 * 4 * 3 * 8];
+	blasint i;
+
+	utest_fill(a, stridea * count, 4);
+	utest_fill(b, strideb * count, 5);
+	utest_fill(c, stridec * count, 6);
+	memcpy(r, c, sizeof(c));
+
+	for (i = 0; i < count; i++)
+		cblas_zgemm(CblasColMajor, CblasConjTrans, CblasNoTrans, m, n, k,
+			    alpha, a + i * stridea, k, b + i * strideb, k, beta, r + i * stridec, m);
+
+	cblas_zgemm_batch_strided(CblasColMajor, CblasConjTrans, CblasNoTrans, m, n, k,
+				  alpha, a, k, stridea / 2, b, k, strideb / 2, beta, c, m, stridec / 2, count);
+
+	for (i = 0; i < stridec * count; i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], DOUBLE_EPS);
+}
+
+/* Overlapping C blocks and negative strides are rejected, C is left alone */
+CTEST(gemm_batch, dgemm_batch_strided_bad_stride)
+{
+	blasint m = 4, n = 3, k = 2, count = 3;
+	double a[4 * 2 * 3], b[2 * 3 * 3], c[4 * 3 * 3], r[4 * 3 * 3];
+	blasint i;
+
+	utest_fill(a, 4 * 2 * 3, 7);
+	utest_fill(b, 2 * 3 * 3, 8);
+	utest_fill(c, 4 * 3 * 3, 9);
+	memcpy(r, c, sizeof(c));
+
+	cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+				  1.0, a, m, m * k, b, k, k * n, 0.0, c, m, m * n - 1, count);
+	cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+				  1.0, a, m, -1, b, k, k * n, 0.0, c, m, m * n, count);
+	cblas_dgemm_batch_strided(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+				  1.0, a, k, m * k, b, n, -1, 0.0, c, n, m * n, count);
+
+	for (i = 0; i < 4 * 3 * 3; i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], 0.0);
+}
@@ -0,0 +1,104 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+
+/* Beta is folded into the first K panel tile by tile; M is large enough */
+/* to take several GEMM_P steps and N covers several column chunks, and  */
+/* beta == 0 must overwrite NaNs in C without reading them               */
+static void check_zgemm_beta(char ta, char tb, blasint m, blasint n, blasint k,
+			     double beta_r, double beta_i)
+{
+	blasint lda = (ta == 'N' ? m : k), ldb = (tb == 'N' ? k : n), ldc = m + 3;
+	double alpha[2] = {1.0, -2.0}, beta[2] = {beta_r, beta_i};
+	double *a, *b, *c, *r;
+	blasint i, j, l;
+	int zero = (beta_r == 0.0 && beta_i == 0.0);
+
+	a = (double *)malloc(2 * m * k * sizeof(double));
+	b = (double *)malloc(2 * k * n * sizeof(double));
+	c = (double *)malloc(2 * ldc * n * sizeof(double));
+	r = (double *)malloc(2 * ldc * n * sizeof(double));
+
+	for (i = 0; i < 2 * m * k; i++) a[i] = (double)((i * 5) % 9) - 4.0;
+	for (i = 0; i < 2 * k * n; i++) b[i] = (double)((i * 3) % 7) - 3.0;
+	for (i = 0; i < 2 * ldc * n; i++) c[i] = r[i] = zero ? NAN : (double)(i % 13) - 6.0;
+
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < m; i++) {
+			double sr = 0.0, si = 0.0, *cr = r + 2 * (i + j * ldc);
+			for (l = 0; l < k; l++) {
+				double *x = a + 2 * (ta == 'N' ? i + l * lda : l + i * lda);
+				double *y = b + 2 * (tb == 'N' ? l + j * ldb : j + l * ldb);
+				sr += x[0] * y[0] - x[1] * y[1];
+				si += x[0] * y[1] + x[1] * y[0];
+			}
+			if (zero) {
+				cr[0] = alpha[0] * sr - alpha[1] * si;
+				cr[1] = alpha[0] * si + alpha[1] * sr;
+			} else {
+				double tr = beta[0] * cr[0] - beta[1] * cr[1];
+				double ti = beta[0] * cr[1] + beta[1] * cr[0];
+				cr[0] = tr + alpha[0] * sr - alpha[1] * si;
+				cr[1] = ti + alpha[0] * si + alpha[1] * sr;
+			}
+		}
+	}
+
+	BLASFUNC(zgemm)(&ta, &tb, &m, &n, &k, alpha, a, &lda, b, &ldb, beta, c, &ldc);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < 2 * m; i++)
+			ASSERT_DBL_NEAR_TOL(r[i + j * 2 * ldc], c[i + j * 2 * ldc], DOUBLE_EPS);
+
+	free(a); free(b); free(c); free(r);
+}
+
+CTEST(gemm_beta, zgemm_tiles)
+{
+	int nthreads = openblas_get_num_threads();
+
+	openblas_set_num_threads(1);
+	check_zgemm_beta('N', 'N', 700, 75, 33, 0.0, 0.0);
+	check_zgemm_beta('T', 'N', 530, 41, 300, 0.5, -1.0);
+
+	openblas_set_num_threads(4);
+	check_zgemm_beta('N', 'T', 700, 75, 33, 0.0, 0.0);
+	check_zgemm_beta('N', 'N', 611, 97, 300, -2.0, 0.0);
+
+	openblas_set_num_threads(nthreads);
+}
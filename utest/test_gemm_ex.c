@@ -0,0 +1,128 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <string.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+
+/* Checks cblas_dgemm_ex against the reference product followed by   */
+/* the epilogue as a separate pass; K spans several panels so the     */
+/* epilogue has to wait for the last one                              */
+static void check_dgemm_ex(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE ta, enum CBLAS_TRANSPOSE tb,
+			   blasint m, blasint n, blasint k, double beta, enum CBLAS_ACTIVATION act,
+			   int with_row, int with_col)
+{
+	int row_major = (order == CblasRowMajor);
+	blasint lda, ldb, ldc, i, j;
+	double *a, *b, *c, *r, *rb, *cb, *rs, *cs;
+	openblas_dgemm_epilogue_t ep;
+
+	lda = ((ta == CblasNoTrans) != row_major) ? m : k;
+	ldb = ((tb == CblasNoTrans) != row_major) ? k : n;
+	ldc = (row_major ? n : m) + 2;
+
+	a  = (double *)malloc(m * k * sizeof(double));
+	b  = (double *)malloc(k * n * sizeof(double));
+	c  = (double *)malloc(ldc * (row_major ? m : n) * sizeof(double));
+	r  = (double *)malloc(ldc * (row_major ? m : n) * sizeof(double));
+	rb = (double *)malloc(m * sizeof(double));
+	rs = (double *)malloc(m * sizeof(double));
+	cb = (double *)malloc(n * sizeof(double));
+	cs = (double *)malloc(n * sizeof(double));
+
+	utest_fill(a, m * k, 1);
+	utest_fill(b, k * n, 2);
+	utest_fill(c, ldc * (row_major ? m : n), 3);
+	memcpy(r, c, ldc * (row_major ? m : n) * sizeof(double));
+	utest_fill(rb, m, 4);
+	utest_fill(rs, m, 5);
+	utest_fill(cb, n, 6);
+	utest_fill(cs, n, 7);
+
+	ep.row_bias   = with_row ? rb : NULL;
+	ep.row_scale  = with_row ? rs : NULL;
+	ep.col_bias   = with_col ? cb : NULL;
+	ep.col_scale  = with_col ? cs : NULL;
+	ep.activation = act;
+
+	/* a row major product is the column major one of the transposes */
+	if (row_major)
+		utest_naive_dgemm(tb != CblasNoTrans, ta != CblasNoTrans, n, m, k, 0.75,
+				  b, ldb, a, lda, beta, r, ldc);
+	else
+		utest_naive_dgemm(ta != CblasNoTrans, tb != CblasNoTrans, m, n, k, 0.75,
+				  a, lda, b, ldb, beta, r, ldc);
+
+	for (i = 0; i < m; i++) {
+		for (j = 0; j < n; j++) {
+			double *x = row_major ? &r[i * ldc + j] : &r[i + j * ldc];
+			double v = *x;
+			if (with_row) v *= rs[i];
+			if (with_col) v *= cs[j];
+			if (with_row) v += rb[i];
+			if (with_col) v += cb[j];
+			if (act == CblasReLU && v < 0.0) v = 0.0;
+			if (act == CblasGELU) v = 0.5 * v * (1.0 + erf(v / sqrt(2.0)));
+			*x = v;
+		}
+	}
+
+	cblas_dgemm_ex(order, ta, tb, m, n, k, 0.75, a, lda, b, ldb, beta, c, ldc, &ep);
+
+	for (i = 0; i < ldc * (row_major ? m : n); i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], 1e-9);
+
+	free(a); free(b); free(c); free(r);
+	free(rb); free(rs); free(cb); free(cs);
+}
+
+CTEST(gemm_ex, dgemm_epilogue)
+{
+	int nthreads = openblas_get_num_threads();
+
+	openblas_set_num_threads(1);
+	check_dgemm_ex(CblasColMajor, CblasNoTrans, CblasNoTrans, 700, 53, 600, 0.0, CblasReLU, 1, 1);
+	check_dgemm_ex(CblasColMajor, CblasTrans, CblasNoTrans, 37, 90, 21, 0.5, CblasGELU, 1, 0);
+	check_dgemm_ex(CblasRowMajor, CblasNoTrans, CblasTrans, 45, 120, 300, 1.0, CblasNoActivation, 0, 1);
+	check_dgemm_ex(CblasColMajor, CblasNoTrans, CblasNoTrans, 20, 30, 0, 2.0, CblasReLU, 1, 1);
+
+	openblas_set_num_threads(4);
+	check_dgemm_ex(CblasRowMajor, CblasTrans, CblasTrans, 300, 257, 280, -1.0, CblasGELU, 1, 1);
+	check_dgemm_ex(CblasColMajor, CblasNoTrans, CblasTrans, 64, 512, 96, 0.0, CblasReLU, 0, 1);
+
+	openblas_set_num_threads(nthreads);
+}
@@ -0,0 +1,66 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+int openblas_get_last_num_threads(void);
+
+/* Small C with a long K goes through the K-split driver when threaded; */
+/* integer data keep every partial sum exact, whatever the slicing      */
+static void check_ksplit(int transa, int transb, blasint m, blasint n, blasint k,
+			 double beta)
+{
+	utest_check_dgemm(transa, transb, m, n, k, 2.0, beta);
+	ASSERT_TRUE(openblas_get_last_num_threads() > 1);
+}
+
+CTEST(gemm_ksplit, dgemm_long_k)
+{
+	int nthreads = openblas_get_num_threads();
+
+	/* On one thread the shapes never reach the K split */
+	openblas_set_num_threads(4);
+	if (openblas_get_num_threads() < 2) {
+		openblas_set_num_threads(nthreads);
+		return;
+	}
+
+	check_ksplit(0, 0, 24, 20, 6000, 0.5);
+	check_ksplit(0, 1, 17, 9, 4001, 0.0);
+	check_ksplit(1, 0, 8, 31, 5003, -1.0);
+	check_ksplit(1, 1, 33, 3, 3000, 0.0);
+
+	openblas_set_num_threads(nthreads);
+}
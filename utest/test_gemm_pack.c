@@ -0,0 +1,98 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+#define TOL 1e-9
+
+/* m and k chosen so that neither is a multiple of the unroll factors */
+/* and k spans more than one GEMM_Q block on every target             */
+static void check_pack(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE transa,
+		       enum CBLAS_TRANSPOSE transb, int pack_a, int pack_b)
+{
+	blasint m = 37, n = 29, k = 1031;
+	blasint lda = 1040, ldb = 1040, ldc = 41;
+	double alpha = 1.5, beta = -0.5;
+	double *a, *b, *c, *r, *pa = NULL, *pb = NULL;
+	blasint i;
+
+	a = (double *)malloc(lda * lda * sizeof(double));
+	b = (double *)malloc(ldb * ldb * sizeof(double));
+	c = (double *)malloc(ldc * ldc * sizeof(double));
+	r = (double *)malloc(ldc * ldc * sizeof(double));
+	utest_fill(a, lda * lda, 1);
+	utest_fill(b, ldb * ldb, 2);
+	utest_fill(c, ldc * ldc, 3);
+	memcpy(r, c, ldc * ldc * sizeof(double));
+
+	cblas_dgemm(order, transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, r, ldc);
+
+	if (pack_a) {
+		pa = (double *)malloc(cblas_dgemm_pack_get_size(CblasAMatrix, m, n, k));
+		cblas_dgemm_pack(order, CblasAMatrix, transa, m, n, k, alpha, a, lda, pa);
+	}
+	if (pack_b) {
+		pb = (double *)malloc(cblas_dgemm_pack_get_size(CblasBMatrix, m, n, k));
+		cblas_dgemm_pack(order, CblasBMatrix, transb, m, n, k, pack_a ? 1.0 : alpha, b, ldb, pb);
+	}
+
+	cblas_dgemm_compute(order, pack_a ? CblasPacked : transa, pack_b ? CblasPacked : transb,
+			    m, n, k, pack_a ? pa : a, lda, pack_b ? pb : b, ldb, beta, c, ldc);
+
+	for (i = 0; i < ldc * ldc; i++)
+		ASSERT_DBL_NEAR_TOL(r[i], c[i], TOL);
+
+	free(a); free(b); free(c); free(r);
+	if (pa) free(pa);
+	if (pb) free(pb);
+}
+
+CTEST(gemm_pack, dgemm_pack_a_colmajor)
+{
+	check_pack(CblasColMajor, CblasNoTrans, CblasNoTrans, 1, 0);
+	check_pack(CblasColMajor, CblasTrans, CblasTrans, 1, 0);
+}
+
+CTEST(gemm_pack, dgemm_pack_b_rowmajor)
+{
+	check_pack(CblasRowMajor, CblasNoTrans, CblasNoTrans, 0, 1);
+	check_pack(CblasRowMajor, CblasTrans, CblasTrans, 0, 1);
+}
+
+CTEST(gemm_pack, dgemm_pack_both)
+{
+	check_pack(CblasColMajor, CblasTrans, CblasNoTrans, 1, 1);
+	check_pack(CblasRowMajor, CblasNoTrans, CblasTrans, 1, 1);
+}
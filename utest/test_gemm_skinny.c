@@ -0,0 +1,91 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdlib.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+static void check_all(blasint m, blasint n, blasint k, double alpha, double beta)
+{
+	int t;
+	for (t = 0; t < 4; t++) utest_check_dgemm(t & 1, t >> 1, m, n, k, alpha, beta);
+}
+
+CTEST(gemm_skinny, narrow_n)
+{
+	blasint n;
+	for (n = 1; n <= 16; n++) check_all(203, n, 37, 1.5, 0.5);
+	check_all(1000, 4, 700, -1.0, 0.0);
+	check_all(77, 13, 301, 0.5, 1.0);
+}
+
+CTEST(gemm_skinny, narrow_m)
+{
+	blasint m;
+	for (m = 1; m <= 16; m++) check_all(m, 203, 37, 1.5, 0.5);
+	check_all(3, 1000, 700, -1.0, 0.0);
+	check_all(16, 16, 500, 2.0, -1.0);
+}
+
+CTEST(gemm_skinny, threaded)
+{
+	int nthreads = openblas_get_num_threads();
+
+	openblas_set_num_threads(4);
+	check_all(4099, 8, 300, 1.0, 2.0);
+	check_all(5, 3001, 400, -0.5, 0.0);
+	openblas_set_num_threads(nthreads);
+}
+
+CTEST(gemm_skinny, sgemm)
+{
+	blasint m = 301, n = 6, k = 90, lda = 301, ldb = 90, ldc = 301, i, j, l;
+	float alpha = 2.0f, beta = -1.0f;
+	float *a = malloc(sizeof(float) * m * k), *b = malloc(sizeof(float) * k * n);
+	float *c = malloc(sizeof(float) * m * n);
+
+	for (i = 0; i < m * k; i++) a[i] = (float)((i * 5) % 11) - 5.0f;
+	for (i = 0; i < k * n; i++) b[i] = (float)((i * 3) % 7) - 3.0f;
+	for (i = 0; i < m * n; i++) c[i] = (float)(i % 13);
+
+	cblas_sgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) {
+			float s = 0.0f;
+			for (l = 0; l < k; l++) s += a[i + l * lda] * b[l + j * ldb];
+			ASSERT_DBL_NEAR_TOL(alpha * s - (float)((i + j * ldc) % 13), c[i + j * ldc], SINGLE_EPS);
+		}
+
+	free(a); free(b); free(c);
+}
@@ -0,0 +1,78 @@
+/*****************************************************************************
+Copyright (c) 2011-2014, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+CTEST(gemm_small, dgemm_nn)
+{
+	utest_check_dgemm(0, 0, 7, 5, 9, 1.5, 0.5);
+	utest_check_dgemm(0, 0, 17, 3, 1, -1.0, 0.0);
+}
+
+CTEST(gemm_small, dgemm_nt)
+{
+	utest_check_dgemm(0, 1, 9, 13, 4, 2.0, 1.0);
+	utest_check_dgemm(0, 1, 32, 32, 32, 1.0, 0.0);
+}
+
+CTEST(gemm_small, dgemm_tn)
+{
+	utest_check_dgemm(1, 0, 5, 6, 19, 0.5, -1.0);
+	utest_check_dgemm(1, 0, 1, 1, 32, 1.0, 0.0);
+}
+
+CTEST(gemm_small, dgemm_tt)
+{
+	utest_check_dgemm(1, 1, 11, 10, 7, -0.5, 2.0);
+	utest_check_dgemm(1, 1, 3, 30, 2, 1.0, 0.0);
+}
+
+/* A and B are not referenced when alpha is zero */
+CTEST(gemm_small, dgemm_alpha_zero)
+{
+	blasint m = 6, n = 5, k = 4, lda = 6, ldb = 4, ldc = 6;
+	double a[6 * 4], b[4 * 5], c[6 * 5];
+	double alpha = 0.0, beta = 0.5;
+	blasint i;
+
+	for (i = 0; i < 6 * 4; i++) a[i] = 1.0;
+	for (i = 0; i < 4 * 5; i++) b[i] = 1.0;
+	for (i = 0; i < 6 * 5; i++) c[i] = (double)i;
+	a[3] = NAN;
+	b[7] = INFINITY;
+
+	BLASFUNC(dgemm)("N", "N", &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+
+	for (i = 0; i < 6 * 5; i++)
+		ASSERT_DBL_NEAR_TOL(0.5 * (double)i, c[i], DOUBLE_EPS);
+}
@@ -0,0 +1,298 @@
+/*****************************************************************************
+Copyright (c) 2011-2016, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "openblas_utest.h"
+
+/* The batched routines against one call per matrix.  Batches are   */
+/* not a multiple of the lane count, and mix sizes that take the    */
+/* compact kernels with sizes that do not.                          */
+
+static blasint sizes[] = { 1, 3, 4, 8, 17, 64, 65 };
+
+#define NSIZES (sizeof(sizes) / sizeof(sizes[0]))
+#define BATCH 19
+
+static double rnd(void)
+{
+	return (double)rand() / RAND_MAX - 0.5;
+}
+
+static double maxdiff(blasint n, double *x, double *y)
+{
+	double err = 0.0;
+	blasint i;
+
+	for (i = 0; i < n; i++) err = fmax(err, fabs(x[i] - y[i]));
+	return err;
+}
+
+/* random SPD matrix, with a negative diagonal entry if bad >= 0 */
+static void spd(blasint n, blasint lda, double *a, blasint bad)
+{
+	blasint i, j, k;
+	double *g = malloc(sizeof(double) * n * n);
+
+	for (i = 0; i < n * n; i++) g[i] = rnd();
+	for (j = 0; j < n; j++)
+		for (i = 0; i < lda; i++) {
+			double s = (i == j) ? n : 0.0;
+			if (i < n)
+				for (k = 0; k < n; k++) s += g[i + k * n] * g[j + k * n];
+			a[i + j * lda] = s;
+		}
+	if (bad >= 0) a[bad * (lda + 1)] = -1.0;
+	free(g);
+}
+
+CTEST(lapack_batch, dgetrf_strided)
+{
+	unsigned int s;
+	blasint n, lda, stride, batch = BATCH, info1, i, l;
+
+	for (s = 0; s < NSIZES; s++) {
+		n = sizes[s];
+		lda = n + 1;
+		stride = lda * n + 3;
+
+		double *a = malloc(sizeof(double) * stride * batch);
+		double *a0 = malloc(sizeof(double) * stride * batch);
+		blasint *ipiv = malloc(sizeof(blasint) * n * batch);
+		blasint *ipiv0 = malloc(sizeof(blasint) * n);
+		blasint info[BATCH];
+
+		for (i = 0; i < stride * batch; i++) a0[i] = a[i] = rnd();
+		/* one singular matrix in the batch */
+		if (n > 2)
+			for (i = 0; i < n; i++) a0[5 * stride + i + 2 * lda] = a[5 * stride + i + 2 * lda] = 0.0;
+
+		BLASFUNC(dgetrf_batch_strided)(&n, &n, a, &lda, &stride, ipiv, &n, &batch, info);
+
+		for (l = 0; l < batch; l++) {
+			BLASFUNC(dgetrf)(&n, &n, a0 + l * stride, &lda, ipiv0, &info1);
+			ASSERT_EQUAL(info1, info[l]);
+			for (i = 0; i < n; i++) ASSERT_EQUAL(ipiv0[i], ipiv[l * n + i]);
+			ASSERT_DBL_NEAR_TOL(0.0, maxdiff(lda * n, a + l * stride, a0 + l * stride), DOUBLE_EPS * 1000);
+		}
+
+		free(ipiv0); free(ipiv); free(a0); free(a);
+	}
+}
+
+CTEST(lapack_batch, dgetrs_grouped)
+{
+	blasint n_array[3] = { 6, 65, 6 }, nrhs_array[3] = { 2, 1, 3 };
+	blasint lda_array[3] = { 7, 65, 6 }, ldb_array[3] = { 6, 66, 8 };
+	blasint group_size[3] = { 11, 2, 9 }, group_count = 3;
+	char trans_array[3] = { 'N', 'T', 't' };
+	double *a_array[22], *a0[22], *b_array[22], *b0[22];
+	blasint *ipiv_array[22], info[22], info1;
+	blasint g, j, i, k, r, idx, n, nrhs, lda, ldb;
+	double s, err;
+
+	for (idx = 0, g = 0; g < group_count; g++)
+		for (j = 0; j < group_size[g]; j++, idx++) {
+			n = n_array[g]; lda = lda_array[g]; ldb = ldb_array[g]; nrhs = nrhs_array[g];
+			a_array[idx] = malloc(sizeof(double) * lda * n);
+			a0[idx] = malloc(sizeof(double) * lda * n);
+			b_array[idx] = malloc(sizeof(double) * ldb * nrhs);
+			b0[idx] = malloc(sizeof(double) * ldb * nrhs);
+			ipiv_array[idx] = malloc(sizeof(blasint) * n);
+			for (i = 0; i < lda * n; i++) a0[idx][i] = a_array[idx][i] = rnd();
+			for (i = 0; i < ldb * nrhs; i++) b0[idx][i] = b_array[idx][i] = rnd();
+			BLASFUNC(dgetrf)(&n, &n, a_array[idx], &lda, ipiv_array[idx], &info1);
+			ASSERT_EQUAL(0, info1);
+		}
+
+	BLASFUNC(dgetrs_batch)(trans_array, n_array, nrhs_array, a_array, lda_array, ipiv_array,
+			       b_array, ldb_array, &group_count, group_size, info);
+
+	for (idx = 0, g = 0; g < group_count; g++)
+		for (j = 0; j < group_size[g]; j++, idx++) {
+			n = n_array[g]; lda = lda_array[g]; ldb = ldb_array[g]; nrhs = nrhs_array[g];
+			ASSERT_EQUAL(0, info[idx]);
+			err = 0.0;
+			for (r = 0; r < nrhs; r++)
+				for (i = 0; i < n; i++) {
+					s = -b0[idx][i + r * ldb];
+					for (k = 0; k < n; k++)
+						s += ((g == 0) ? a0[idx][i + k * lda] : a0[idx][k + i * lda]) * b_array[idx][k + r * ldb];
+					err = fmax(err, fabs(s));
+				}
+			ASSERT_DBL_NEAR_TOL(0.0, err, DOUBLE_EPS * 1000);
+			free(ipiv_array[idx]); free(b0[idx]); free(b_array[idx]); free(a0[idx]); free(a_array[idx]);
+		}
+}
+
+static void check_dpotrf(char uplo)
+{
+	unsigned int s;
+	blasint n, lda, stride, batch = BATCH, info1, i, l;
+	blasint info[BATCH];
+
+	for (s = 0; s < NSIZES; s++) {
+		n = sizes[s];
+		lda = n + 2;
+		stride = lda * n;
+
+		double *a = malloc(sizeof(double) * stride * batch);
+		double *a0 = malloc(sizeof(double) * stride * batch);
+
+		for (l = 0; l < batch; l++)
+			spd(n, lda, a0 + l * stride, (l == 3) ? n / 2 : -1);
+		for (i = 0; i < stride * batch; i++) a[i] = a0[i];
+
+		BLASFUNC(dpotrf_batch_strided)(&uplo, &n, a, &lda, &stride, &batch, info);
+
+		for (l = 0; l < batch; l++) {
+			BLASFUNC(dpotrf)(&uplo, &n, a0 + l * stride, &lda, &info1);
+			ASSERT_EQUAL(info1, info[l]);
+			ASSERT_DBL_NEAR_TOL(0.0, maxdiff(stride, a + l * stride, a0 + l * stride), DOUBLE_EPS * 1000);
+		}
+
+		free(a0); free(a);
+	}
+}
+
+CTEST(lapack_batch, dpotrf_strided)
+{
+	check_dpotrf('U');
+	check_dpotrf('L');
+}
+
+/* uplo differs per group, an empty group in between */
+CTEST(lapack_batch, dpotrf_grouped)
+{
+	char uplo[3] = { 'U', 'L', 'L' };
+	blasint n[3] = { 5, 0, 17 }, lda[3] = { 6, 1, 17 }, group_size[3] = { 9, 2, 10 };
+	blasint group_count = 3, g, j, idx, info1, info[21];
+	double *a_array[21], *a0[21];
+
+	for (idx = 0; idx < 21; idx++) info[idx] = 99;
+
+	for (g = 0, idx = 0; g < group_count; g++)
+		for (j = 0; j < group_size[g]; j++, idx++) {
+			a_array[idx] = malloc(sizeof(double) * lda[g] * (n[g] + 1));
+			a0[idx] = malloc(sizeof(double) * lda[g] * (n[g] + 1));
+			spd(n[g], lda[g], a0[idx], (idx == 14) ? 3 : -1);
+			memcpy(a_array[idx], a0[idx], sizeof(double) * lda[g] * n[g]);
+		}
+
+	BLASFUNC(dpotrf_batch)(uplo, n, a_array, lda, &group_count, group_size, info);
+
+	for (g = 0, idx = 0; g < group_count; g++)
+		for (j = 0; j < group_size[g]; j++, idx++) {
+			BLASFUNC(dpotrf)(&uplo[g], &n[g], a0[idx], &lda[g], &info1);
+			ASSERT_EQUAL(info1, info[idx]);
+			ASSERT_DBL_NEAR_TOL(0.0, maxdiff(lda[g] * n[g], a_array[idx], a0[idx]), DOUBLE_EPS * 1000);
+			free(a0[idx]); free(a_array[idx]);
+		}
+}
+
+CTEST(lapack_batch, dpotrs_strided)
+{
+	unsigned int s;
+	blasint n, lda, ldb, nrhs = 2, stride, strideb, batch = BATCH, info1, i, k, r, l;
+	blasint info[BATCH];
+	char uplo[2] = { 'U', 'L' };
+	double t, err;
+	int u;
+
+	for (u = 0; u < 2; u++)
+		for (s = 0; s < NSIZES; s++) {
+			n = sizes[s];
+			lda = n;
+			ldb = n + 1;
+			stride = lda * n;
+			strideb = ldb * nrhs;
+
+			double *a = malloc(sizeof(double) * stride * batch);
+			double *a0 = malloc(sizeof(double) * stride * batch);
+			double *b = malloc(sizeof(double) * strideb * batch);
+			double *b0 = malloc(sizeof(double) * strideb * batch);
+
+			for (l = 0; l < batch; l++) spd(n, lda, a0 + l * stride, -1);
+			for (i = 0; i < stride * batch; i++) a[i] = a0[i];
+			for (i = 0; i < strideb * batch; i++) b0[i] = b[i] = rnd();
+
+			for (l = 0; l < batch; l++) {
+				BLASFUNC(dpotrf)(&uplo[u], &n, a + l * stride, &lda, &info1);
+				ASSERT_EQUAL(0, info1);
+			}
+
+			BLASFUNC(dpotrs_batch_strided)(&uplo[u], &n, &nrhs, a, &lda, &stride, b, &ldb, &strideb, &batch, info);
+
+			for (l = 0; l < batch; l++) {
+				ASSERT_EQUAL(0, info[l]);
+				err = 0.0;
+				for (r = 0; r < nrhs; r++)
+					for (i = 0; i < n; i++) {
+						t = -b0[l * strideb + i + r * ldb];
+						for (k = 0; k < n; k++)
+							t += a0[l * stride + i + k * lda] * b[l * strideb + k + r * ldb];
+						err = fmax(err, fabs(t) / n);
+					}
+				ASSERT_DBL_NEAR_TOL(0.0, err, DOUBLE_EPS * 1000);
+			}
+
+			free(b0); free(b); free(a0); free(a);
+		}
+}
+
+/* sixteen lanes in single precision, factor then solve */
+CTEST(lapack_batch, sgesv_strided)
+{
+	blasint n = 9, nrhs = 1, lda = 9, stride = 81, batch = 37, info[37], i, k, l;
+	blasint ipiv[9 * 37];
+	char trans = 'N';
+	float a[81 * 37], a0[81 * 37], b[9 * 37], b0[9 * 37], s, err = 0.0f;
+
+	for (i = 0; i < stride * batch; i++) a0[i] = a[i] = (float)rnd();
+	for (l = 0; l < batch; l++)
+		for (i = 0; i < n; i++) a0[l * stride + i * (lda + 1)] = a[l * stride + i * (lda + 1)] += 4.0f;
+	for (i = 0; i < n * batch; i++) b0[i] = b[i] = (float)rnd();
+
+	BLASFUNC(sgetrf_batch_strided)(&n, &n, a, &lda, &stride, ipiv, &n, &batch, info);
+	for (l = 0; l < batch; l++) ASSERT_EQUAL(0, info[l]);
+
+	BLASFUNC(sgetrs_batch_strided)(&trans, &n, &nrhs, a, &lda, &stride, ipiv, &n, b, &n, &n, &batch, info);
+
+	for (l = 0; l < batch; l++)
+		for (i = 0; i < n; i++) {
+			s = -b0[l * n + i];
+			for (k = 0; k < n; k++) s += a0[l * stride + i + k * lda] * b[l * n + k];
+			err = fmaxf(err, fabsf(s));
+		}
+
+	ASSERT_DBL_NEAR_TOL(0.0, err, SINGLE_EPS * 10);
+}
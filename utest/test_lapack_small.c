@@ -0,0 +1,238 @@
+/*****************************************************************************
+Copyright (c) 2011-2016, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include "openblas_utest.h"
+
+/* Sizes on both sides of the small-n threshold, so the unblocked    */
+/* kernels and the blocked drivers are checked against each other's  */
+/* residuals.                                                        */
+
+static blasint sizes[] = { 1, 2, 7, 16, 31, 48, 63, 64, 65, 97 };
+
+#define NSIZES (sizeof(sizes) / sizeof(sizes[0]))
+
+static double rnd(void)
+{
+	return (double)rand() / RAND_MAX - 0.5;
+}
+
+/* max |A x - b| / (|A| |x|) over the right hand sides */
+static double residual(char trans, blasint n, blasint nrhs, double *a, blasint lda,
+		       double *x, blasint ldx, double *b, blasint ldb)
+{
+	double err = 0.0, anorm = 0.0, xnorm, s;
+	blasint i, j, k;
+
+	for (i = 0; i < n * lda; i++) anorm = fmax(anorm, fabs(a[i]));
+
+	for (j = 0; j < nrhs; j++) {
+		xnorm = 0.0;
+		for (k = 0; k < n; k++) xnorm = fmax(xnorm, fabs(x[k + j * ldx]));
+		for (i = 0; i < n; i++) {
+			s = -b[i + j * ldb];
+			for (k = 0; k < n; k++)
+				s += ((trans == 'N') ? a[i + k * lda] : a[k + i * lda]) * x[k + j * ldx];
+			err = fmax(err, fabs(s) / (anorm * xnorm * n));
+		}
+	}
+
+	return err;
+}
+
+static double check_dpotrs(char uplo, blasint n, blasint nrhs)
+{
+	blasint lda = n + 1, ldb = n + 2, info, i, j, k;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double *g = malloc(sizeof(double) * n * n);
+	double *b = malloc(sizeof(double) * ldb * nrhs);
+	double *b0 = malloc(sizeof(double) * ldb * nrhs);
+	double err;
+
+	for (i = 0; i < n * n; i++) g[i] = rnd();
+	for (j = 0; j < n; j++)
+		for (i = 0; i < lda; i++) {
+			double s = (i == j) ? n : 0.0;
+			if (i < n)
+				for (k = 0; k < n; k++) s += g[i + k * n] * g[j + k * n];
+			a0[i + j * lda] = a[i + j * lda] = s;
+		}
+	for (i = 0; i < ldb * nrhs; i++) b0[i] = b[i] = rnd();
+
+	BLASFUNC(dpotrf)(&uplo, &n, a, &lda, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(dpotrs)(&uplo, &n, &nrhs, a, &lda, b, &ldb, &info);
+	ASSERT_EQUAL(0, info);
+
+	err = residual('N', n, nrhs, a0, lda, b, ldb, b0, ldb);
+
+	free(b0); free(b); free(g); free(a0); free(a);
+	return err;
+}
+
+static double check_dgetrs(char trans, blasint n, blasint nrhs)
+{
+	blasint lda = n + 3, ldb = n, info, i;
+	blasint *ipiv = malloc(sizeof(blasint) * n);
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double *b = malloc(sizeof(double) * ldb * nrhs);
+	double *b0 = malloc(sizeof(double) * ldb * nrhs);
+	double err;
+
+	for (i = 0; i < lda * n; i++) a0[i] = a[i] = rnd();
+	for (i = 0; i < ldb * nrhs; i++) b0[i] = b[i] = rnd();
+
+	BLASFUNC(dgetrf)(&n, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(dgetrs)(&trans, &n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+	ASSERT_EQUAL(0, info);
+
+	err = residual(trans, n, nrhs, a0, lda, b, ldb, b0, ldb);
+
+	free(b0); free(b); free(a0); free(a); free(ipiv);
+	return err;
+}
+
+/* P L U rebuilt from the factors of a rectangular A */
+static double check_dgetrf(blasint m, blasint n)
+{
+	blasint lda = m + 1, k = (m < n) ? m : n, info, i, j, l;
+	blasint *ipiv = malloc(sizeof(blasint) * k);
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double *lu = malloc(sizeof(double) * m * n);
+	double err = 0.0, s;
+
+	for (i = 0; i < lda * n; i++) a0[i] = a[i] = rnd();
+
+	BLASFUNC(dgetrf)(&m, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++) {
+			s = 0.0;
+			for (l = 0; l <= MIN(i, j); l++)
+				s += ((l == i) ? 1.0 : a[i + l * lda]) * a[l + j * lda];
+			lu[i + j * m] = s;
+		}
+
+	for (i = k - 1; i >= 0; i--)
+		for (j = 0; j < n; j++) {
+			s = lu[i + j * m];
+			lu[i + j * m] = lu[ipiv[i] - 1 + j * m];
+			lu[ipiv[i] - 1 + j * m] = s;
+		}
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++)
+			err = fmax(err, fabs(lu[i + j * m] - a0[i + j * lda]));
+
+	free(lu); free(a0); free(a); free(ipiv);
+	return err;
+}
+
+CTEST(lapack_small, dpotrs)
+{
+	unsigned int i;
+
+	for (i = 0; i < NSIZES; i++) {
+		ASSERT_DBL_NEAR_TOL(0.0, check_dpotrs('U', sizes[i], 1), DOUBLE_EPS * 10);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dpotrs('U', sizes[i], 5), DOUBLE_EPS * 10);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dpotrs('L', sizes[i], 1), DOUBLE_EPS * 10);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dpotrs('L', sizes[i], 5), DOUBLE_EPS * 10);
+	}
+}
+
+CTEST(lapack_small, dgetrs)
+{
+	unsigned int i;
+
+	for (i = 0; i < NSIZES; i++) {
+		ASSERT_DBL_NEAR_TOL(0.0, check_dgetrs('N', sizes[i], 1), DOUBLE_EPS * 100);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dgetrs('N', sizes[i], 3), DOUBLE_EPS * 100);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dgetrs('T', sizes[i], 1), DOUBLE_EPS * 100);
+		ASSERT_DBL_NEAR_TOL(0.0, check_dgetrs('T', sizes[i], 3), DOUBLE_EPS * 100);
+	}
+}
+
+CTEST(lapack_small, dgetrf_rect)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(20, 35), DOUBLE_EPS * 10);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(35, 20), DOUBLE_EPS * 10);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(1, 9), DOUBLE_EPS * 10);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dgetrf(9, 1), DOUBLE_EPS * 10);
+}
+
+CTEST(lapack_small, info)
+{
+	blasint n = 12, lda = 12, info, i;
+	blasint ipiv[12];
+	double a[144];
+	char uplo = 'L';
+
+	/* diag(1, 1, 1, -1, ...) is not positive definite at 4 */
+	for (i = 0; i < n * lda; i++) a[i] = 0.0;
+	for (i = 0; i < n; i++) a[i * (lda + 1)] = (i == 3) ? -1.0 : 1.0;
+	BLASFUNC(dpotrf)(&uplo, &n, a, &lda, &info);
+	ASSERT_EQUAL(4, info);
+
+	/* column 6 is zero, so U(6, 6) is an exact zero */
+	for (i = 0; i < n * lda; i++) a[i] = rnd();
+	for (i = 0; i < n; i++) a[i + 5 * lda] = 0.0;
+	BLASFUNC(dgetrf)(&n, &n, a, &lda, ipiv, &info);
+	ASSERT_EQUAL(6, info);
+}
+
+CTEST(lapack_small, sgesv)
+{
+	blasint n = 23, nrhs = 2, lda = 23, ldb = 23, info, i, j, k;
+	blasint ipiv[23];
+	float a[529], a0[529], b[46], b0[46], s, err = 0.0f;
+
+	for (i = 0; i < n * n; i++) a0[i] = a[i] = (float)rnd();
+	for (i = 0; i < n; i++) a0[i * (lda + 1)] = a[i * (lda + 1)] += 4.0f;
+	for (i = 0; i < n * nrhs; i++) b0[i] = b[i] = (float)rnd();
+
+	BLASFUNC(sgesv)(&n, &nrhs, a, &lda, ipiv, b, &ldb, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < nrhs; j++)
+		for (i = 0; i < n; i++) {
+			s = -b0[i + j * ldb];
+			for (k = 0; k < n; k++) s += a0[i + k * lda] * b[k + j * ldb];
+			err = fmaxf(err, fabsf(s));
+		}
+
+	ASSERT_DBL_NEAR_TOL(0.0, err, SINGLE_EPS * 10);
+}
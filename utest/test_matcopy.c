@@ -0,0 +1,158 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdlib.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+/* Element (i, j) of an order o matrix with leading dimension ld */
+#define AT(o, x, ld, i, j) ((o) == CblasColMajor ? (x)[(i) + (j) * (ld)] : (x)[(i) * (ld) + (j)])
+
+static void check_domatcopy(enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE trans,
+			    blasint rows, blasint cols, double alpha)
+{
+	blasint major = (order == CblasColMajor) ? cols : rows;
+	blasint lda = ((order == CblasColMajor) ? rows : cols) + 3;
+	blasint brows = (trans == CblasTrans) ? cols : rows;
+	blasint bcols = (trans == CblasTrans) ? rows : cols;
+	blasint ldb = ((order == CblasColMajor) ? brows : bcols) + 2;
+	blasint bmajor = (order == CblasColMajor) ? bcols : brows;
+	double *a = malloc(sizeof(double) * lda * major);
+	double *b = malloc(sizeof(double) * ldb * bmajor);
+	blasint i, j;
+
+	for (i = 0; i < lda * major; i++) a[i] = (double)(i % 97) - 40.0;
+	for (i = 0; i < ldb * bmajor; i++) b[i] = -1.0;
+
+	cblas_domatcopy(order, trans, rows, cols, alpha, a, lda, b, ldb);
+
+	for (i = 0; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			ASSERT_DBL_NEAR_TOL(alpha * AT(order, a, lda, i, j),
+					    (trans == CblasTrans) ? AT(order, b, ldb, j, i) : AT(order, b, ldb, i, j),
+					    DOUBLE_EPS);
+
+	/* the padding of B is left alone */
+	for (i = 0; i < bmajor; i++)
+		ASSERT_DBL_NEAR_TOL(-1.0, b[i * ldb + ldb - 1], DOUBLE_EPS);
+
+	free(a); free(b);
+}
+
+static void check_dimatcopy(enum CBLAS_ORDER order, blasint rows, blasint cols, double alpha)
+{
+	blasint lda = (order == CblasColMajor) ? rows : cols;
+	blasint ldb = (order == CblasColMajor) ? cols : rows;
+	double *a = malloc(sizeof(double) * rows * cols);
+	double *b = malloc(sizeof(double) * rows * cols);
+	blasint i, j;
+
+	for (i = 0; i < rows * cols; i++) a[i] = b[i] = (double)(i % 1013);
+
+	cblas_dimatcopy(order, CblasTrans, rows, cols, alpha, a, lda, ldb);
+
+	for (i = 0; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			ASSERT_DBL_NEAR_TOL(alpha * AT(order, b, lda, i, j), AT(order, a, ldb, j, i), DOUBLE_EPS);
+
+	free(a); free(b);
+}
+
+CTEST(matcopy, domatcopy)
+{
+	static const blasint sizes[][2] = { {1, 1}, {1, 9}, {7, 1}, {4, 8}, {37, 53}, {100, 7}, {64, 96} };
+	blasint s;
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		check_domatcopy(CblasColMajor, CblasTrans, sizes[s][0], sizes[s][1], 1.0);
+		check_domatcopy(CblasColMajor, CblasTrans, sizes[s][0], sizes[s][1], -2.5);
+		check_domatcopy(CblasRowMajor, CblasTrans, sizes[s][0], sizes[s][1], 1.0);
+		check_domatcopy(CblasRowMajor, CblasTrans, sizes[s][0], sizes[s][1], 0.5);
+		check_domatcopy(CblasColMajor, CblasNoTrans, sizes[s][0], sizes[s][1], 3.0);
+		check_domatcopy(CblasRowMajor, CblasNoTrans, sizes[s][0], sizes[s][1], 3.0);
+	}
+	check_domatcopy(CblasColMajor, CblasTrans, 33, 35, 0.0);
+	check_domatcopy(CblasRowMajor, CblasTrans, 33, 35, 0.0);
+}
+
+CTEST(matcopy, threaded)
+{
+	int nthreads = openblas_get_num_threads();
+
+	openblas_set_num_threads(4);
+	check_domatcopy(CblasColMajor, CblasTrans, 701, 903, 1.0);
+	check_domatcopy(CblasRowMajor, CblasTrans, 903, 701, -1.0);
+	check_domatcopy(CblasColMajor, CblasNoTrans, 701, 903, 2.0);
+	check_domatcopy(CblasRowMajor, CblasNoTrans, 701, 903, 2.0);
+	openblas_set_num_threads(nthreads);
+}
+
+CTEST(matcopy, dimatcopy_inplace)
+{
+	static const blasint sizes[][2] = { {1, 5}, {6, 1}, {12, 18}, {37, 53}, {64, 48}, {300, 7}, {50, 50}, {101, 101} };
+	blasint s;
+
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		check_dimatcopy(CblasColMajor, sizes[s][0], sizes[s][1], 1.0);
+		check_dimatcopy(CblasRowMajor, sizes[s][0], sizes[s][1], 1.5);
+	}
+	check_dimatcopy(CblasColMajor, 20, 30, 0.0);
+}
+
+CTEST(matcopy, somatcopy)
+{
+	blasint rows = 45, cols = 70, lda = 47, ldb = 71, i, j;
+	float *a = malloc(sizeof(float) * lda * cols), *b = malloc(sizeof(float) * ldb * rows);
+	float *c = malloc(sizeof(float) * 67 * 67);
+
+	for (i = 0; i < lda * cols; i++) a[i] = (float)(i % 31) - 15.0f;
+
+	cblas_somatcopy(CblasColMajor, CblasTrans, rows, cols, 2.0f, a, lda, b, ldb);
+	for (i = 0; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			ASSERT_DBL_NEAR_TOL(2.0f * a[i + j * lda], b[j + i * ldb], SINGLE_EPS);
+
+	for (i = 0; i < rows * cols; i++) c[i] = (float)(i % 29);
+	cblas_simatcopy(CblasRowMajor, CblasTrans, rows, cols, 1.0f, c, cols, rows);
+	for (i = 0; i < rows; i++)
+		for (j = 0; j < cols; j++)
+			ASSERT_DBL_NEAR_TOL((float)((i * cols + j) % 29), c[j * rows + i], SINGLE_EPS);
+
+	for (i = 0; i < 67 * 67; i++) c[i] = (float)(i % 29);
+	cblas_simatcopy(CblasColMajor, CblasTrans, 67, 67, -1.0f, c, 67, 67);
+	for (i = 0; i < 67; i++)
+		for (j = 0; j < 67; j++)
+			ASSERT_DBL_NEAR_TOL(-(float)((i + j * 67) % 29), c[j + i * 67], SINGLE_EPS);
+
+	free(a); free(b); free(c);
+}
@@ -0,0 +1,109 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <pthread.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+/* internal buffer allocator, see common.h */
+void *blas_memory_alloc(int);
+void  blas_memory_free(void *);
+
+/* a few more concurrent holders than the 50 slots of the first buffer */
+/* block; each buffer is mapped and touched in full, so keep it small  */
+#define MEMORY_THREADS 52
+
+static pthread_barrier_t memory_barrier;
+static int memory_errors;
+static size_t memory_peak;
+
+static void *memory_worker(void *arg)
+{
+	long id = (long)arg;
+	long *buffer;
+
+	buffer = (long *)blas_memory_alloc(0);
+	if (buffer == NULL) {
+		__sync_fetch_and_add(&memory_errors, 1);
+		pthread_barrier_wait(&memory_barrier);
+		pthread_barrier_wait(&memory_barrier);
+		return NULL;
+	}
+	buffer[0] = id;
+
+	/* every thread holds its buffer here, so none can be shared */
+	pthread_barrier_wait(&memory_barrier);
+	if (buffer[0] != id) __sync_fetch_and_add(&memory_errors, 1);
+	if (id == 0) memory_peak = openblas_get_memory_in_use();
+	pthread_barrier_wait(&memory_barrier);
+
+	blas_memory_free(buffer);
+	return NULL;
+}
+
+static void memory_round(void)
+{
+	pthread_t threads[MEMORY_THREADS];
+	long i;
+
+	pthread_barrier_init(&memory_barrier, NULL, MEMORY_THREADS);
+	for (i = 0; i < MEMORY_THREADS; i++)
+		pthread_create(&threads[i], NULL, memory_worker, (void *)i);
+	for (i = 0; i < MEMORY_THREADS; i++)
+		pthread_join(threads[i], NULL);
+	pthread_barrier_destroy(&memory_barrier);
+}
+
+/* The buffer table grows past its first block, and the grown slots are */
+/* released and reused by later callers instead of mapping new buffers */
+CTEST(memory, many_threads)
+{
+	size_t in_use = openblas_get_memory_in_use();
+	size_t high;
+
+	memory_errors = 0;
+	memory_round();
+	ASSERT_EQUAL(0, memory_errors);
+	ASSERT_TRUE(openblas_get_memory_in_use() == in_use);
+
+	/* all threads held a distinct buffer at the same time */
+	ASSERT_TRUE(memory_peak > in_use);
+	ASSERT_EQUAL(0, (memory_peak - in_use) % MEMORY_THREADS);
+	high = openblas_get_memory_high_water();
+	ASSERT_TRUE(high >= memory_peak);
+
+	memory_round();
+	ASSERT_EQUAL(0, memory_errors);
+	ASSERT_TRUE(openblas_get_memory_in_use() == in_use);
+	ASSERT_TRUE(openblas_get_memory_high_water() == high);
+}
@@ -0,0 +1,135 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+
+/* The norm of x[i] = s * (1 + i % 4) over n strided elements is */
+/* s * sqrt(n / 4 * 30) for n a multiple of 4; s takes values    */
+/* whose squares overflow or underflow in double                 */
+static void check_dnrm2(blasint n, blasint inc, double s)
+{
+	double *x = (double *)malloc(n * inc * sizeof(double));
+	double r, e = s * sqrt((double)n / 4.0 * 30.0);
+	blasint i;
+
+	for (i = 0; i < n * inc; i++) x[i] = 1e300;
+	for (i = 0; i < n; i++) x[i * inc] = ((i & 1) ? -s : s) * (double)(1 + i % 4);
+
+	r = BLASFUNC(dnrm2)(&n, x, &inc);
+	ASSERT_DBL_NEAR_TOL(1.0, r / e, DOUBLE_EPS);
+
+	free(x);
+}
+
+static void check_dznrm2(blasint n, blasint inc, double s)
+{
+	double *x = (double *)malloc(2 * n * inc * sizeof(double));
+	double r, e = s * sqrt((double)n / 4.0 * 30.0 * 2.0);
+	blasint i;
+
+	for (i = 0; i < 2 * n * inc; i++) x[i] = 1e300;
+	for (i = 0; i < n; i++) {
+		x[2 * i * inc    ] = s * (double)(1 + i % 4);
+		x[2 * i * inc + 1] = -s * (double)(1 + i % 4);
+	}
+
+	r = BLASFUNC(dznrm2)(&n, x, &inc);
+	ASSERT_DBL_NEAR_TOL(1.0, r / e, DOUBLE_EPS);
+
+	free(x);
+}
+
+CTEST(nrm2, dnrm2_range)
+{
+	int nthreads = openblas_get_num_threads();
+	double s[] = {1.0, 1e-170, 1e170, 1e-310};
+	int i;
+
+	openblas_set_num_threads(4);
+	for (i = 0; i < 4; i++) {
+		check_dnrm2(4000, 1, s[i]);
+		check_dnrm2(4000, 3, s[i]);
+		check_dnrm2(40000, 1, s[i]);
+		check_dnrm2(40000, 2, s[i]);
+		check_dznrm2(2000, 1, s[i]);
+		check_dznrm2(20000, 2, s[i]);
+	}
+	openblas_set_num_threads(nthreads);
+}
+
+/* Mixed magnitudes across blocks, NaN anywhere, and the trivial sizes */
+CTEST(nrm2, dnrm2_special)
+{
+	blasint n = 3000, inc = 1, zero = 0, neg = -1;
+	double *x = (double *)malloc(n * sizeof(double));
+	double r;
+	blasint i;
+
+	for (i = 0; i < n; i++) x[i] = 1e-200;
+	x[2500] = 1e200;
+	r = BLASFUNC(dnrm2)(&n, x, &inc);
+	ASSERT_DBL_NEAR_TOL(1.0, r / 1e200, DOUBLE_EPS);
+
+	x[2500] = 0.0;
+	x[10] = 3.0;
+	r = BLASFUNC(dnrm2)(&n, x, &inc);
+	ASSERT_DBL_NEAR_TOL(3.0, r, DOUBLE_EPS);
+
+	x[1500] = NAN;
+	r = BLASFUNC(dnrm2)(&n, x, &inc);
+	ASSERT_TRUE(isnan(r));
+
+	ASSERT_DBL_NEAR_TOL(0.0, BLASFUNC(dnrm2)(&zero, x, &inc), DOUBLE_EPS);
+	ASSERT_DBL_NEAR_TOL(0.0, BLASFUNC(dnrm2)(&n, x, &neg), DOUBLE_EPS);
+
+	free(x);
+}
+
+CTEST(nrm2, snrm2)
+{
+	blasint n = 5000, inc = 1, inc2 = 2;
+	float *x = (float *)malloc(2 * n * sizeof(float));
+	double e = 1e20 * sqrt((double)n / 4.0 * 30.0);
+	blasint i;
+
+	for (i = 0; i < 2 * n; i++) x[i] = 1e20f * (float)(1 + (i / 2) % 4);
+
+	ASSERT_DBL_NEAR_TOL(1.0, BLASFUNC(snrm2)(&n, x, &inc2) / e, SINGLE_EPS);
+	ASSERT_DBL_NEAR_TOL(1.0, BLASFUNC(scnrm2)(&n, x, &inc) / (e * sqrt(2.0)), SINGLE_EPS);
+
+	free(x);
+}
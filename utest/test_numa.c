@@ -0,0 +1,58 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <cblas.h>
+#include "openblas_utest.h"
+
+/* Forcing more groups than there are nodes takes the node-local path on */
+/* any machine; every group must still cover its own column slab of C    */
+CTEST(numa, dgemm_groups)
+{
+	int threads = openblas_get_num_threads();
+	int numa = openblas_get_numa_level3();
+	int groups;
+
+	openblas_set_num_threads(4);
+	for (groups = 1; groups <= 4; groups++) {
+		openblas_set_numa_level3(groups);
+		utest_check_dgemm(0, 0, 421, 389, 96, 1.0, 0.0);
+		utest_check_dgemm(0, 0, 421, 389, 96, 1.5, -0.5);
+		utest_check_dgemm(1, 0, 200, 301, 150, 1.0, 1.0);
+		utest_check_dgemm(0, 1, 37, 512, 64, 2.0, 0.0);
+		utest_check_dgemm(1, 1, 300, 33, 80, 1.0, 0.25);
+	}
+	openblas_set_numa_level3(numa);
+	openblas_set_num_threads(threads);
+
+	ASSERT_EQUAL(numa, openblas_get_numa_level3());
+}
@@ -0,0 +1,76 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <cblas.h>
+#include <unistd.h>
+#include "openblas_utest.h"
+
+/* Parked workers must wake up for the next threaded call */
+CTEST(park, dgemm_after_park)
+{
+	blasint m = 240, n = 224, k = 200, i;
+	int threads = openblas_get_num_threads();
+	int round, used = 0;
+	double *a, *b, *c, *r;
+
+	a = (double *)malloc(m * k * sizeof(double));
+	b = (double *)malloc(k * n * sizeof(double));
+	c = (double *)malloc(m * n * sizeof(double));
+	r = (double *)malloc(m * n * sizeof(double));
+	utest_fill(a, m * k, 1);
+	utest_fill(b, k * n, 2);
+
+	utest_naive_dgemm(0, 0, m, n, k, 1.0, a, m, b, k, 0.0, r, m);
+
+	openblas_set_num_threads(4);
+
+	for (round = 0; round < 4; round++) {
+		openblas_park_threads();
+		usleep(20 * 1000);
+
+		for (i = 0; i < m * n; i++) c[i] = NAN;
+		cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+			    1.0, a, m, b, k, 0.0, c, m);
+		if (openblas_get_last_num_threads() > 1) used = 1;
+
+		utest_compare_dmatrix(m, n, r, m, c, m, 1e-10);
+	}
+
+	openblas_set_num_threads(threads);
+
+	/* at least one sleeping worker was woken and timed */
+	if (used)
+		ASSERT_TRUE(openblas_get_wakeup_latency() > 0.);
+
+	free(a); free(b); free(c); free(r);
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+#define PROFILE_PATH "openblas_utest_profile.txt"
+
+#ifdef _WIN32
+#define set_profile(path) _putenv_s("OPENBLAS_PROFILE", path)
+#define clear_profile()   _putenv_s("OPENBLAS_PROFILE", "")
+#else
+#define set_profile(path) setenv("OPENBLAS_PROFILE", path, 1)
+#define clear_profile()   unsetenv("OPENBLAS_PROFILE")
+#endif
+
+/* Counts the sections named key (any section for an empty key), */
+/* -1 if a section does not start with four well formed entries   */
+static int count_sections(const char *key, char *last)
+{
+	static const char *name[4] = {"sgemm", "dgemm", "cgemm", "zgemm"};
+	char line[256], entry[16];
+	long p, q, r;
+	int ratio, count = 0, row = -1, bad = 0;
+	FILE *fp = fopen(PROFILE_PATH, "r");
+
+	if (fp == NULL) return -1;
+	while (fgets(line, sizeof(line), fp)) {
+		if (line[0] == '[') {
+			if (!key[0] || !strcmp(line, key)) count ++;
+			if (last != NULL) strcpy(last, line);
+			row = 0;
+			continue;
+		}
+		if ((row < 0) || (row >= 4)) continue;
+		if ((sscanf(line, "%15s %ld %ld %ld %d", entry, &p, &q, &r, &ratio) != 5) ||
+		    strcmp(entry, name[row]) || (p < 0) || (q < 0) || (r < 0) || (ratio < 0))
+			bad = 1;
+		row ++;
+	}
+	fclose(fp);
+
+	return bad ? -1 : count;
+}
+
+/* A second run replaces this CPU's section and keeps the others */
+CTEST(profile, autotune)
+{
+	char key[256];
+	int ratio[4];
+	FILE *fp;
+
+	memcpy(ratio, blas_switch_ratio, sizeof(ratio));
+	remove(PROFILE_PATH);
+
+	ASSERT_EQUAL(0, openblas_autotune(PROFILE_PATH));
+	ASSERT_EQUAL(1, count_sections("", key));
+
+	fp = fopen(PROFILE_PATH, "a");
+	ASSERT_TRUE(fp != NULL);
+	fprintf(fp, "[OTHER GenuineIntel 00000000]\nsgemm 0 0 0 0\ndgemm 0 0 0 0\n"
+		"cgemm 0 0 0 0\nzgemm 0 0 0 0\n");
+	fclose(fp);
+
+	ASSERT_EQUAL(0, openblas_autotune(PROFILE_PATH));
+	ASSERT_EQUAL(1, count_sections(key, NULL));
+	ASSERT_EQUAL(1, count_sections("[OTHER GenuineIntel 00000000]\n", NULL));
+	if (getenv("OPENBLAS_PROFILE") == NULL) ASSERT_EQUAL(-1, openblas_autotune(NULL));
+
+	memcpy(blas_switch_ratio, ratio, sizeof(ratio));
+	remove(PROFILE_PATH);
+}
+
+/* Only this CPU's section applies; short lines and absent entries */
+/* leave the current values alone                                 */
+CTEST(profile, load)
+{
+	char key[256];
+	int ratio[4];
+	FILE *fp;
+
+	memcpy(ratio, blas_switch_ratio, sizeof(ratio));
+	remove(PROFILE_PATH);
+
+	ASSERT_EQUAL(0, openblas_autotune(PROFILE_PATH));
+	ASSERT_EQUAL(1, count_sections("", key));
+
+	fp = fopen(PROFILE_PATH, "w");
+	ASSERT_TRUE(fp != NULL);
+	fprintf(fp, "# comment\n[OTHER GenuineIntel 00000000]\ndgemm 0 0 0 3\n");
+	fprintf(fp, "%sdgemm 0 0 0 12\nzgemm 0 0\nzgemm 0 0 0 24\n", key);
+	fprintf(fp, "[OTHER GenuineIntel 00000001]\ndgemm 0 0 0 5\n");
+	fclose(fp);
+
+	blas_switch_ratio[0] = 7;
+	blas_switch_ratio[1] = blas_switch_ratio[3] = 0;
+	ASSERT_EQUAL(0, set_profile(PROFILE_PATH));
+	blas_load_profile();
+
+	ASSERT_EQUAL(7,  blas_switch_ratio[0]);
+	ASSERT_EQUAL(12, blas_switch_ratio[1]);
+	ASSERT_EQUAL(24, blas_switch_ratio[3]);
+
+	clear_profile();
+	memcpy(blas_switch_ratio, ratio, sizeof(ratio));
+	remove(PROFILE_PATH);
+}
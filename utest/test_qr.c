@@ -0,0 +1,271 @@
+/*****************************************************************************
+Copyright (c) 2011-2016, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <string.h>
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+
+/* A = Q R is rebuilt by applying Q to R with ?ormqr; for a tall or  */
+/* square A the explicit Q from ?orgqr must be orthonormal and Q^T A */
+/* must give R back.                                                 */
+
+static double rnd(void)
+{
+	return (double)rand() / RAND_MAX - 0.5;
+}
+
+static double check_dqr(blasint m, blasint n)
+{
+	blasint lda = m + 3, k = (m < n) ? m : n, lwork = -1, info, i, j, l;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a0 = malloc(sizeof(double) * lda * n);
+	double *r = malloc(sizeof(double) * lda * n);
+	double *tau = malloc(sizeof(double) * k);
+	double query, *work, err = 0.0, s;
+	char left = 'L', notrans = 'N', trans = 'T';
+
+	for (i = 0; i < lda * n; i++) a0[i] = a[i] = rnd();
+
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, &query, &lwork, &info);
+	lwork = (blasint)query;
+	work = malloc(sizeof(double) * lwork);
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < lda; i++)
+			r[i + j * lda] = (i <= j && i < m) ? a[i + j * lda] : 0.0;
+
+	BLASFUNC(dormqr)(&left, &notrans, &m, &n, &k, a, &lda, tau, r, &lda, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++)
+			err = fmax(err, fabs(r[i + j * lda] - a0[i + j * lda]));
+
+	if (n <= m) {
+		/* Q^T A0 = R */
+		for (i = 0; i < lda * n; i++) r[i] = a0[i];
+		BLASFUNC(dormqr)(&left, &trans, &m, &n, &k, a, &lda, tau, r, &lda, work, &lwork, &info);
+		ASSERT_EQUAL(0, info);
+		for (j = 0; j < n; j++)
+			for (i = 0; i < m; i++)
+				err = fmax(err, fabs(r[i + j * lda] - ((i <= j) ? a[i + j * lda] : 0.0)));
+
+		BLASFUNC(dorgqr)(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+		ASSERT_EQUAL(0, info);
+		for (j = 0; j < n; j++)
+			for (l = 0; l <= j; l++) {
+				s = 0.0;
+				for (i = 0; i < m; i++) s += a[i + l * lda] * a[i + j * lda];
+				err = fmax(err, fabs(s - ((l == j) ? 1.0 : 0.0)));
+			}
+	}
+
+	free(work); free(tau); free(r); free(a0); free(a);
+	return err;
+}
+
+/* The right side : C Q^T Q = C */
+static double check_dormqr_right(blasint m, blasint n)
+{
+	blasint lda = n + 1, ldc = m + 2, k = n / 2, lwork = -1, info, i;
+	double *a = malloc(sizeof(double) * lda * k);
+	double *c = malloc(sizeof(double) * ldc * n);
+	double *c0 = malloc(sizeof(double) * ldc * n);
+	double *tau = malloc(sizeof(double) * k);
+	double query, *work, err = 0.0;
+	char right = 'R', notrans = 'N', trans = 'T';
+
+	for (i = 0; i < lda * k; i++) a[i] = rnd();
+	for (i = 0; i < ldc * n; i++) c0[i] = c[i] = rnd();
+
+	BLASFUNC(dgeqrf)(&n, &k, a, &lda, tau, &query, &lwork, &info);
+	lwork = (blasint)query + m * 64;
+	work = malloc(sizeof(double) * lwork);
+	BLASFUNC(dgeqrf)(&n, &k, a, &lda, tau, work, &lwork, &info);
+
+	BLASFUNC(dormqr)(&right, &trans, &m, &n, &k, a, &lda, tau, c, &ldc, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(dormqr)(&right, &notrans, &m, &n, &k, a, &lda, tau, c, &ldc, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (i = 0; i < ldc * n; i++)
+		if (i % ldc < m) err = fmax(err, fabs(c[i] - c0[i]));
+
+	free(work); free(tau); free(c0); free(c); free(a);
+	return err;
+}
+
+static double check_zqr(blasint m, blasint n)
+{
+	blasint lda = m + 1, k = (m < n) ? m : n, lwork = -1, info, i, j, l;
+	double *a = malloc(sizeof(double) * 2 * lda * n);
+	double *a0 = malloc(sizeof(double) * 2 * lda * n);
+	double *r = malloc(sizeof(double) * 2 * lda * n);
+	double *tau = malloc(sizeof(double) * 2 * k);
+	double query[2], *work, err = 0.0, sr, si;
+	char left = 'L', notrans = 'N';
+
+	for (i = 0; i < 2 * lda * n; i++) a0[i] = a[i] = rnd();
+
+	BLASFUNC(zgeqrf)(&m, &n, a, &lda, tau, query, &lwork, &info);
+	lwork = (blasint)query[0];
+	work = malloc(sizeof(double) * 2 * lwork);
+	BLASFUNC(zgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (j = 0; j < n; j++)
+		for (i = 0; i < lda; i++) {
+			r[2 * (i + j * lda) + 0] = (i <= j && i < m) ? a[2 * (i + j * lda) + 0] : 0.0;
+			r[2 * (i + j * lda) + 1] = (i <= j && i < m) ? a[2 * (i + j * lda) + 1] : 0.0;
+		}
+
+	BLASFUNC(zunmqr)(&left, &notrans, &m, &n, &k, a, &lda, tau, r, &lda, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+
+	for (i = 0; i < 2 * lda * n; i++)
+		if ((i / 2) % lda < m) err = fmax(err, fabs(r[i] - a0[i]));
+
+	if (n <= m) {
+		BLASFUNC(zungqr)(&m, &n, &k, a, &lda, tau, work, &lwork, &info);
+		ASSERT_EQUAL(0, info);
+		for (j = 0; j < n; j++)
+			for (l = 0; l <= j; l++) {
+				sr = si = 0.0;
+				for (i = 0; i < m; i++) {
+					double *x = a + 2 * (i + l * lda), *y = a + 2 * (i + j * lda);
+					sr += x[0] * y[0] + x[1] * y[1];
+					si += x[0] * y[1] - x[1] * y[0];
+				}
+				err = fmax(err, fabs(sr - ((l == j) ? 1.0 : 0.0)));
+				err = fmax(err, fabs(si));
+			}
+	}
+
+	free(work); free(tau); free(r); free(a0); free(a);
+	return err;
+}
+
+CTEST(qr, dgeqrf_small)
+{
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(17, 9), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(9, 17), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(1, 1), DOUBLE_EPS * 100);
+}
+
+CTEST(qr, dgeqrf_blocked)
+{
+	int threads = openblas_get_num_threads();
+
+	/* large enough for the look-ahead driver */
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(437, 351), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(130, 600), DOUBLE_EPS * 1000);
+
+	openblas_set_num_threads(4);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(437, 351), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dqr(130, 600), DOUBLE_EPS * 1000);
+	openblas_set_num_threads(threads);
+}
+
+/* With the minimal lwork the drivers allocate T and W, with the     */
+/* optimal one they use work; both must give the same factors and Q, */
+/* and leave the optimal size in work[0]                             */
+static void check_dqr_lwork(blasint m, blasint n)
+{
+	blasint lda = m, lwork = -1, lmin = n, info, i;
+	double *a = malloc(sizeof(double) * lda * n);
+	double *a1 = malloc(sizeof(double) * lda * n);
+	double *tau = malloc(sizeof(double) * n);
+	double *tau1 = malloc(sizeof(double) * n);
+	double query, *work;
+
+	for (i = 0; i < lda * n; i++) a1[i] = a[i] = rnd();
+
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, &query, &lwork, &info);
+	lwork = (blasint)query;
+	work = malloc(sizeof(double) * lwork);
+
+	BLASFUNC(dgeqrf)(&m, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+	ASSERT_DBL_NEAR_TOL(query, work[0], 0.0);
+	BLASFUNC(dgeqrf)(&m, &n, a1, &lda, tau1, work, &lmin, &info);
+	ASSERT_EQUAL(0, info);
+	ASSERT_EQUAL(0, memcmp(a, a1, sizeof(double) * lda * n));
+	ASSERT_EQUAL(0, memcmp(tau, tau1, sizeof(double) * n));
+
+	BLASFUNC(dorgqr)(&m, &n, &n, a, &lda, tau, work, &lwork, &info);
+	ASSERT_EQUAL(0, info);
+	BLASFUNC(dorgqr)(&m, &n, &n, a1, &lda, tau1, work, &lmin, &info);
+	ASSERT_EQUAL(0, info);
+	ASSERT_EQUAL(0, memcmp(a, a1, sizeof(double) * lda * n));
+
+	free(work); free(tau1); free(tau); free(a1); free(a);
+}
+
+CTEST(qr, dgeqrf_lwork)
+{
+	int threads = openblas_get_num_threads();
+
+	check_dqr_lwork(437, 351);
+
+	openblas_set_num_threads(4);
+	check_dqr_lwork(437, 351);
+	openblas_set_num_threads(threads);
+}
+
+CTEST(qr, dormqr_right)
+{
+	int threads = openblas_get_num_threads();
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr_right(205, 300), DOUBLE_EPS * 1000);
+
+	openblas_set_num_threads(4);
+	ASSERT_DBL_NEAR_TOL(0.0, check_dormqr_right(205, 300), DOUBLE_EPS * 1000);
+	openblas_set_num_threads(threads);
+}
+
+CTEST(qr, zgeqrf)
+{
+	int threads = openblas_get_num_threads();
+
+	ASSERT_DBL_NEAR_TOL(0.0, check_zqr(13, 7), DOUBLE_EPS * 100);
+	ASSERT_DBL_NEAR_TOL(0.0, check_zqr(301, 277), DOUBLE_EPS * 1000);
+
+	openblas_set_num_threads(4);
+	ASSERT_DBL_NEAR_TOL(0.0, check_zqr(301, 277), DOUBLE_EPS * 1000);
+	ASSERT_DBL_NEAR_TOL(0.0, check_zqr(90, 250), DOUBLE_EPS * 1000);
+	openblas_set_num_threads(threads);
+}
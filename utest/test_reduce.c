@@ -0,0 +1,117 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <cblas.h>
+#include "openblas_utest.h"
+
+void openblas_set_num_threads(int);
+int openblas_get_num_threads(void);
+
+/* Long enough for every reduction to split across four threads; the */
+/* extremum is placed in a late chunk and repeated in a later one so  */
+/* that the combination has to keep the first occurrence              */
+#define N 200000
+
+CTEST(reduce, dot_asum)
+{
+	int nthreads = openblas_get_num_threads();
+	blasint n = N, inc = 1, inc2 = 2, ninc = -1;
+	double *x = (double *)malloc(2 * N * sizeof(double));
+	double *y = (double *)malloc(2 * N * sizeof(double));
+	double sd = 0.0, sa = 0.0, sr = 0.0, si = 0.0, r, z[2];
+	blasint i;
+
+	for (i = 0; i < 2 * N; i++) {
+		x[i] = (double)(i % 7) - 3.0;
+		y[i] = (double)(i % 5) - 2.0;
+	}
+	for (i = 0; i < N; i++) {
+		sd += x[i] * y[N - 1 - i];
+		sa += fabs(x[2 * i]);
+		sr += x[2 * i] * y[2 * i] + x[2 * i + 1] * y[2 * i + 1];
+		si += x[2 * i] * y[2 * i + 1] - x[2 * i + 1] * y[2 * i];
+	}
+
+	openblas_set_num_threads(4);
+
+	r = BLASFUNC(ddot)(&n, x, &inc, y, &ninc);
+	ASSERT_DBL_NEAR_TOL(sd, r, DOUBLE_EPS);
+
+	r = BLASFUNC(dasum)(&n, x, &inc2);
+	ASSERT_DBL_NEAR_TOL(sa, r, DOUBLE_EPS);
+
+	cblas_zdotc_sub(n, x, 1, y, 1, z);
+	ASSERT_DBL_NEAR_TOL(sr, z[0], DOUBLE_EPS);
+	ASSERT_DBL_NEAR_TOL(si, z[1], DOUBLE_EPS);
+
+	openblas_set_num_threads(nthreads);
+	free(x); free(y);
+}
+
+CTEST(reduce, iamax_nrm2)
+{
+	int nthreads = openblas_get_num_threads();
+	blasint n = N, inc = 1, p = N / 2 + 17;
+	double *x = (double *)malloc(2 * N * sizeof(double));
+	float *s = (float *)malloc(N * sizeof(float));
+	double r;
+	blasint i;
+
+	openblas_set_num_threads(4);
+
+	for (i = 0; i < 2 * N; i++) x[i] = (double)(i % 5) - 2.0;
+	x[p] = -5.0; x[N - 3] = 5.0;
+	ASSERT_EQUAL(p + 1, BLASFUNC(idamax)(&n, x, &inc));
+	ASSERT_EQUAL(p, cblas_idamax(n, x, 1));
+
+	for (i = 0; i < 2 * N; i++) x[i] = (double)(i % 5) - 2.0;
+	x[2 * p] = 0.0; x[2 * p + 1] = 6.0;
+	x[2 * N - 6] = 0.0; x[2 * N - 5] = -6.0;
+	ASSERT_EQUAL(p + 1, BLASFUNC(izamax)(&n, x, &inc));
+
+	for (i = 0; i < N; i++) x[i] = 1.0 + (double)(i % 7);
+	x[p] = 0.5; x[N - 3] = -0.5;
+	ASSERT_EQUAL(p + 1, BLASFUNC(idamin)(&n, x, &inc));
+
+	for (i = 0; i < N; i++) s[i] = 1.0f;
+	s[p] = 3.0f; s[N - 1] = 3.0f;
+	ASSERT_EQUAL(p + 1, BLASFUNC(isamax)(&n, s, &inc));
+
+	for (i = 0; i < N; i++) x[i] = 1e200 * (double)(1 + i % 4);
+	r = BLASFUNC(dnrm2)(&n, x, &inc);
+	ASSERT_DBL_NEAR_TOL(1.0, r / (1e200 * sqrt((double)N / 4.0 * 30.0)), DOUBLE_EPS);
+
+	openblas_set_num_threads(nthreads);
+	free(x); free(s);
+}
@@ -0,0 +1,137 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include <string.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+/* In reproducible mode every thread count has to give the same bits. */
+/* The GEMM shapes cover the M/N split and the long-K shape that is   */
+/* otherwise split along K; the GEMV shapes the x split of gemv_n.    */
+
+static double *fill(blasint len, int seed)
+{
+	double *p = (double *)malloc(len * sizeof(double));
+	blasint i;
+
+	for (i = 0; i < len; i++)
+		p[i] = (double)((i % 2003 * 7919 + seed * 104729) % 2003) / 1001.0 - 1.0;
+
+	return p;
+}
+
+static void check_dgemm(blasint m, blasint n, blasint k)
+{
+	double *a = fill(m * k, 1), *b = fill(k * n, 2);
+	double *c = (double *)malloc(m * n * sizeof(double));
+	double *r = (double *)malloc(m * n * sizeof(double));
+	int t;
+
+	for (t = 1; t <= 4; t++) {
+		openblas_set_num_threads(t);
+		memset(c, 0, m * n * sizeof(double));
+		cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+			    1.0, a, m, b, k, 0.0, c, m);
+		if (t == 1) memcpy(r, c, m * n * sizeof(double));
+		else ASSERT_DATA((unsigned char *)r, m * n * sizeof(double),
+				 (unsigned char *)c, m * n * sizeof(double));
+	}
+
+	free(a); free(b); free(c); free(r);
+}
+
+static void check_dgemv(enum CBLAS_TRANSPOSE trans, blasint m, blasint n)
+{
+	blasint ly = (trans == CblasNoTrans) ? m : n;
+	double *a = fill(m * n, 3), *x = fill(m + n, 4);
+	double *y = (double *)malloc(ly * sizeof(double));
+	double *r = (double *)malloc(ly * sizeof(double));
+	int t;
+
+	for (t = 1; t <= 4; t++) {
+		openblas_set_num_threads(t);
+		memset(y, 0, ly * sizeof(double));
+		cblas_dgemv(CblasColMajor, trans, m, n, 1.0, a, m, x, 1, 0.0, y, 1);
+		if (t == 1) memcpy(r, y, ly * sizeof(double));
+		else ASSERT_DATA((unsigned char *)r, ly * sizeof(double),
+				 (unsigned char *)y, ly * sizeof(double));
+	}
+
+	free(a); free(x); free(y); free(r);
+}
+
+CTEST(reproducible, gemm_gemv)
+{
+	int nthreads = openblas_get_num_threads();
+
+	openblas_set_reproducible(1);
+	ASSERT_EQUAL(1, openblas_get_reproducible());
+
+	check_dgemm(300, 200, 700);
+	check_dgemm(24, 24, 20000);
+	check_dgemv(CblasNoTrans, 1001, 900);
+	check_dgemv(CblasNoTrans, 30, 40000);
+	check_dgemv(CblasTrans, 900, 1001);
+
+	openblas_set_reproducible(0);
+	openblas_set_num_threads(nthreads);
+}
+
+CTEST(reproducible, level1)
+{
+	int nthreads = openblas_get_num_threads();
+	blasint n = 300007;
+	double *x = fill(2 * n, 5), *y = fill(2 * n, 6);
+	double d[3][4], z[2];
+	int t;
+
+	openblas_set_reproducible(1);
+
+	for (t = 1; t <= 4; t++) {
+		openblas_set_num_threads(t);
+		d[0][t - 1] = cblas_ddot(n, x, 1, y, 1);
+		d[1][t - 1] = cblas_dnrm2(n, x, 2);
+		cblas_zdotu_sub(n, x, 1, y, 1, z);
+		d[2][t - 1] = z[0] + z[1];
+	}
+	for (t = 1; t < 4; t++) {
+		ASSERT_DATA((unsigned char *)&d[0][0], sizeof(double), (unsigned char *)&d[0][t], sizeof(double));
+		ASSERT_DATA((unsigned char *)&d[1][0], sizeof(double), (unsigned char *)&d[1][t], sizeof(double));
+		ASSERT_DATA((unsigned char *)&d[2][0], sizeof(double), (unsigned char *)&d[2][t], sizeof(double));
+	}
+
+	openblas_set_reproducible(0);
+	openblas_set_num_threads(nthreads);
+	free(x); free(y);
+}
@@ -0,0 +1,77 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+#include <stdlib.h>
+#include <cblas.h>
+#include "openblas_utest.h"
+
+/* Large enough for the non-temporal stores once the threshold is lowered */
+#define N	(300 * 1024 + 5)
+
+/* Odd offsets leave y unaligned, so the scalar heads and tails run too */
+CTEST(stream, copy_scal_axpby)
+{
+	double *x = malloc(sizeof(double) * (N + 1)), *y = malloc(sizeof(double) * (N + 1));
+	float *sx = malloc(sizeof(float) * (N + 3)), *sy = malloc(sizeof(float) * (N + 3));
+	blasint i;
+
+	openblas_set_stream_threshold(1);
+	ASSERT_EQUAL(1, openblas_get_stream_threshold());
+
+	for (i = 0; i <= N; i++) x[i] = (double)(i % 1000) - 500.0;
+	for (i = 0; i < N + 3; i++) sx[i] = (float)(i % 1000) - 500.0f;
+
+	cblas_dcopy(N, x, 1, y + 1, 1);
+	for (i = 0; i < N; i++) ASSERT_DBL_NEAR_TOL(x[i], y[i + 1], 0.0);
+
+	cblas_scopy(N, sx + 1, 1, sy + 3, 1);
+	for (i = 0; i < N; i++) ASSERT_DBL_NEAR_TOL(sx[i + 1], sy[i + 3], 0.0);
+
+	/* strided copies stay on the asm kernel */
+	cblas_dcopy(N / 2, x, 2, y, 2);
+	for (i = 0; i < N / 2; i++) ASSERT_DBL_NEAR_TOL(x[2 * i], y[2 * i], 0.0);
+
+	cblas_daxpby(N, -2.0, x + 1, 1, 0.0, y + 1, 1);
+	for (i = 0; i < N; i++) ASSERT_DBL_NEAR_TOL(-2.0 * x[i + 1], y[i + 1], 0.0);
+
+	cblas_saxpby(N, 0.0f, sx, 1, 0.0f, sy + 1, 1);
+	for (i = 0; i < N; i++) ASSERT_DBL_NEAR_TOL(0.0, sy[i + 1], 0.0);
+
+	cblas_dscal(N, 0.0, y + 1, 1);
+	for (i = 0; i < N; i++) ASSERT_DBL_NEAR_TOL(0.0, y[i + 1], 0.0);
+
+	openblas_set_stream_threshold(0);
+	ASSERT_TRUE(openblas_get_stream_threshold() > 1);
+
+	free(x); free(y); free(sx); free(sy);
+}
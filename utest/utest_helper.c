@@ -0,0 +1,97 @@
+/*****************************************************************************
+Copyright (c) 2011-2019, The OpenBLAS Project
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in
+      the documentation and/or other materials provided with the
+      distribution.
+   3. Neither the name of the OpenBLAS project nor the names of 
+      its contributors may be used to endorse or promote products 
+      derived from this software without specific prior written 
+      permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+
+#include "openblas_utest.h"
+
+/* Helpers shared by the GEMM-based tests, see openblas_utest.h */
+
+void utest_fill(double *x, blasint n, int seed)
+{
+	blasint i;
+	for (i = 0; i < n; i++)
+		x[i] = (double)((i * 7 + seed * 13) % 17) / 8.0 - 1.0;
+}
+
+void utest_naive_dgemm(int transa, int transb, blasint m, blasint n, blasint k,
+		       double alpha, double *a, blasint lda, double *b, blasint ldb,
+		       double beta, double *c, blasint ldc)
+{
+	blasint i, j, l;
+	for (j = 0; j < n; j++) {
+		for (i = 0; i < m; i++) {
+			double s = 0.0;
+			for (l = 0; l < k; l++)
+				s += (transa ? a[l + i * lda] : a[i + l * lda]) *
+				     (transb ? b[j + l * ldb] : b[l + j * ldb]);
+			c[i + j * ldc] = (beta == 0.0) ? alpha * s : alpha * s + beta * c[i + j * ldc];
+		}
+	}
+}
+
+void utest_compare_dmatrix(blasint m, blasint n, double *r, blasint ldr,
+			   double *c, blasint ldc, double tol)
+{
+	blasint i, j;
+	for (j = 0; j < n; j++)
+		for (i = 0; i < m; i++)
+			ASSERT_DBL_NEAR_TOL(r[i + j * ldr], c[i + j * ldc], tol);
+}
+
+/* Small integers keep every sum exact, whatever the summation order */
+void utest_check_dgemm(int transa, int transb, blasint m, blasint n, blasint k,
+		       double alpha, double beta)
+{
+	char ta = transa ? 'T' : 'N', tb = transb ? 'T' : 'N';
+	blasint lda = (transa ? k : m) + 1, ldb = (transb ? n : k) + 2, ldc = m + 3;
+	double *a = malloc(sizeof(double) * lda * (transa ? m : k));
+	double *b = malloc(sizeof(double) * ldb * (transb ? k : n));
+	double *c = malloc(sizeof(double) * ldc * n);
+	double *r = malloc(sizeof(double) * ldc * n);
+	blasint i;
+
+	for (i = 0; i < lda * (transa ? m : k); i++) a[i] = (double)((i * 5) % 11) - 5.0;
+	for (i = 0; i < ldb * (transb ? k : n); i++) b[i] = (double)((i * 3) % 7) - 3.0;
+	for (i = 0; i < ldc * n; i++) c[i] = r[i] = (double)(i % 13);
+
+	/* C must not be read when beta is zero */
+	if (beta == 0.0)
+		for (i = 0; i < ldc * n; i++) c[i] = r[i] = NAN;
+
+	utest_naive_dgemm(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, r, ldc);
+	BLASFUNC(dgemm)(&ta, &tb, &m, &n, &k, &alpha, a, &lda, b, &ldb, &beta, c, &ldc);
+
+	utest_compare_dmatrix(m, n, r, ldc, c, ldc, DOUBLE_EPS);
+
+	free(a); free(b); free(c); free(r);
+}